@@ -0,0 +1,233 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "perf_counters.hpp"
+
+/// \brief GW benchmark namespace
+namespace gw::benchmark {
+
+//
+// Optimization barriers
+//
+
+/// \brief Force the compiler to materialize `value`, so that the computation of it is not optimized away.
+template <typename T>
+inline void do_not_optimize(const T& value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static_cast<void>(*static_cast<const volatile char*>(static_cast<const volatile void*>(&value)));
+#endif
+}
+
+/// \brief Force the compiler to assume that all memory may have been read and written.
+inline void clobber_memory() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+//
+// Results
+//
+
+/// \brief The result of one benchmark.
+struct result {
+  std::string group;         ///< The component under test, e.g. `inplace_string`.
+  std::string name;          ///< The operation under test, e.g. `append`.
+  std::string parameter;     ///< The variant of the operation, e.g. the capacity or the wrapped type.
+  std::uint64_t iterations;  ///< The number of iterations per repetition.
+  double ns_per_item;        ///< The median time per item over all repetitions, in nanoseconds.
+  double min_ns_per_item;    ///< The fastest repetition, in nanoseconds per item.
+  double max_ns_per_item;    ///< The slowest repetition, in nanoseconds per item.
+  counter_values counters;   ///< The hardware events per item over all repetitions, where available.
+};
+
+namespace detail {
+
+inline auto json_escape(std::string_view str) -> std::string {
+  auto escaped = std::string{};
+  for (const auto ch : str) {
+    if (ch == '"' || ch == '\\') {
+      escaped.push_back('\\');
+    }
+    escaped.push_back(ch);
+  }
+  return escaped;
+}
+
+inline auto compiler() -> std::string {
+#if defined(__clang__)
+  return std::format("clang {}.{}.{}", __clang_major__, __clang_minor__, __clang_patchlevel__);
+#elif defined(__GNUC__)
+  return std::format("gcc {}.{}.{}", __GNUC__, __GNUC_MINOR__, __GNUC_PATCHLEVEL__);
+#elif defined(_MSC_VER)
+  return std::format("msvc {}", _MSC_VER);
+#else
+  return "unknown";
+#endif
+}
+
+}  // namespace detail
+
+//
+// Suite
+//
+
+/// \brief A suite of micro-benchmarks that reports its results as JSON.
+/// \details The suite does not depend on a benchmark library, so it builds offline. Each benchmark is calibrated by
+/// doubling the number of iterations until one repetition takes at least the minimum time, and then repeated; the
+/// median is reported. The command line accepts `--filter=<substring>`, which runs only the benchmarks whose
+/// `group/name/parameter` contains the substring, `--min-time=<milliseconds>`, `--repetitions=<count>`,
+/// `--out=<file>`, which writes the JSON to a file instead of the standard output, and `--counters=off`. Unless they
+/// are turned off, the hardware events of gw::benchmark::perf_counters are counted during the repetitions and reported
+/// per item; events that are not available are left out.
+class suite {
+ public:
+  /// \brief constructs the suite from the command line
+  suite(int argc, char** argv) {
+    for (const auto argument : std::vector<std::string_view>(argv + 1, argv + argc)) {
+      const auto option = [argument](std::string_view prefix) { return std::string{argument.substr(prefix.size())}; };
+      if (argument.starts_with("--filter=")) {
+        m_filter = option("--filter=");
+      } else if (argument.starts_with("--out=")) {
+        m_out = option("--out=");
+      } else if (argument.starts_with("--min-time=")) {
+        m_min_time = std::chrono::milliseconds{std::stoll(option("--min-time="))};
+      } else if (argument.starts_with("--repetitions=")) {
+        m_repetitions = std::max(std::stoull(option("--repetitions=")), 1ULL);
+      } else if (argument == "--counters=off") {
+        m_counters.reset();
+      }
+    }
+  }
+
+  /// \brief runs `function`, which processes `items` items per call, unless it is filtered out
+  template <typename Function>
+  void run(std::string_view group, std::string_view name, std::string_view parameter, std::size_t items,
+           Function function) {
+    if (std::format("{}/{}/{}", group, name, parameter).find(m_filter) == std::string::npos) {
+      return;
+    }
+
+    auto iterations = std::uint64_t{1};
+    while (measure(iterations, function) < m_min_time && iterations < (std::uint64_t{1} << 40U)) {
+      iterations *= 2U;
+    }
+
+    auto samples = std::vector<double>{};
+    auto counters = counter_values{};
+    for (auto repetition = std::uint64_t{}; repetition < m_repetitions; ++repetition) {
+      auto elapsed = std::chrono::steady_clock::duration{};
+      auto values = counter_values{};
+      if (m_counters) {
+        const auto count = scoped_count{*m_counters, values};
+        elapsed = measure(iterations, function);
+      } else {
+        elapsed = measure(iterations, function);
+      }
+      samples.push_back(std::chrono::duration<double, std::nano>(elapsed).count() /
+                        static_cast<double>(iterations * items));
+      if (repetition == 0U) {
+        counters = values;
+      } else {
+        counters += values;
+      }
+    }
+    std::ranges::sort(samples);
+    counters /= static_cast<double>(m_repetitions * iterations * items);
+
+    m_results.push_back(result{std::string{group}, std::string{name}, std::string{parameter}, iterations,
+                               samples[samples.size() / 2U], samples.front(), samples.back(), counters});
+
+    auto line = std::format("{:<16} {:<16} {:<24} {:>12.3f} ns", group, name, parameter, m_results.back().ns_per_item);
+    for (const auto event : {counter::cycles, counter::instructions, counter::branch_misses}) {
+      if (counters[event]) {
+        line += std::format(" {:>10.2f} {}", *counters[event], counter_name(event));
+      }
+    }
+    std::clog << line << '\n';
+  }
+
+  /// \brief returns the results of the benchmarks that ran so far
+  [[nodiscard]] auto results() const noexcept -> const std::vector<result>& { return m_results; }
+
+  /// \brief writes the results as JSON to the file given by `--out`, or to the standard output
+  void report() const {
+    if (m_out.empty()) {
+      write_json(std::cout);
+    } else {
+      auto file = std::ofstream{m_out};
+      write_json(file);
+    }
+  }
+
+  /// \brief writes the results as JSON to `ostream`
+  void write_json(std::ostream& ostream) const {
+    ostream << "{\n";
+    auto available = std::string{};
+    for (const auto event : k_counters) {
+      if (m_counters && m_counters->available(event)) {
+        available += std::format("{}\"{}\"", available.empty() ? "" : ", ", counter_name(event));
+      }
+    }
+    ostream << std::format("  \"context\": {{\"compiler\": \"{}\", \"optimized\": {}, \"counters\": [{}]}},\n",
+                           detail::json_escape(detail::compiler()), k_optimized, available);
+    ostream << "  \"benchmarks\": [";
+    for (std::size_t index = 0U; index < m_results.size(); ++index) {
+      const auto& result = m_results[index];
+      ostream << (index == 0U ? "\n" : ",\n");
+      ostream << std::format(
+          "    {{\"group\": \"{}\", \"name\": \"{}\", \"parameter\": \"{}\", \"iterations\": {}, "
+          "\"ns_per_item\": {:.4f}, \"min_ns_per_item\": {:.4f}, \"max_ns_per_item\": {:.4f}",
+          detail::json_escape(result.group), detail::json_escape(result.name), detail::json_escape(result.parameter),
+          result.iterations, result.ns_per_item, result.min_ns_per_item, result.max_ns_per_item);
+      for (const auto event : k_counters) {
+        if (result.counters[event]) {
+          ostream << std::format(", \"{}_per_item\": {:.4f}", counter_name(event), *result.counters[event]);
+        }
+      }
+      ostream << '}';
+    }
+    ostream << "\n  ]\n}\n";
+  }
+
+ private:
+#if defined(NDEBUG)
+  static constexpr bool k_optimized = true;
+#else
+  static constexpr bool k_optimized = false;
+#endif
+
+  template <typename Function>
+  static auto measure(std::uint64_t iterations, Function& function) -> std::chrono::steady_clock::duration {
+    const auto start = std::chrono::steady_clock::now();
+    for (auto iteration = std::uint64_t{}; iteration < iterations; ++iteration) {
+      do_not_optimize(function());
+    }
+    return std::chrono::steady_clock::now() - start;
+  }
+
+  std::string m_filter;
+  std::string m_out;
+  std::chrono::steady_clock::duration m_min_time = std::chrono::milliseconds{50};
+  std::uint64_t m_repetitions = 5U;
+  std::optional<perf_counters> m_counters{std::in_place};
+  std::vector<result> m_results;
+};
+
+}  // namespace gw::benchmark
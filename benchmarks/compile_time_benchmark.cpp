@@ -0,0 +1,264 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+#include "benchmark.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+extern char** environ;  // NOLINT(readability-redundant-declaration)
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+namespace {
+
+/// \brief How the generated translation units spell their N distinct types.
+struct type_variant {
+  std::string_view name;
+  std::string_view type_format;  ///< The type with index `{0}`.
+  std::string_view declaration;  ///< What precedes the type, e.g. the declaration of a tag, with index `{0}`.
+};
+
+constexpr auto k_variants = std::array{
+    type_variant{"int", "int", ""},
+    type_variant{"strong_type", "gw::strong_type<int, tag_{0}>", "struct tag_{0};\n"},
+    type_variant{"strong_type_skills",
+                 "gw::strong_type<int, tag_{0}, gw::skills::with<gw::skills::addable, gw::skills::comparable>>",
+                 "struct tag_{0};\n"},
+    type_variant{"named_type", "gw::named_type<int, \"name_{0}\">", ""},
+    type_variant{"named_type_long", "gw::named_type<int, \"a_long_descriptive_name_of_the_quantity_{0}\">", ""},
+    type_variant{"named_type_name_id", "gw::named_type<int, gw::name_of<name_{0}>>",
+                 "struct name_{0} : gw::name_id<\"a_long_descriptive_name_of_the_quantity_{0}\"> {{}};\n"},
+};
+
+/// \brief The outcome of one compiler run.
+struct measurement {
+  double seconds{};
+  std::optional<long> max_rss_kb;  ///< The peak resident set size of the compiler, where it can be measured.
+  std::optional<std::uintmax_t> object_bytes;  ///< The size of the object file, with `--object`.
+  bool succeeded{};
+};
+
+/// \brief Return the source of a translation unit that instantiates and uses `count` distinct types.
+auto generate(const type_variant& variant, std::size_t count) -> std::string {
+  auto source = std::string{"#include \"gw/named_type.hpp\"\n#include \"gw/strong_type.hpp\"\n\n"};
+  for (std::size_t index = 0U; index < count; ++index) {
+    const auto type = std::vformat(variant.type_format, std::make_format_args(index));
+    source += std::vformat(variant.declaration, std::make_format_args(index));
+    source += std::format("using type_{0} = {1};\nstatic_assert(sizeof(type_{0}) == sizeof(int));\n", index, type);
+    source += std::format(
+        "auto use_{0}(type_{0} lhs, type_{0} rhs) -> bool {{\n"
+        "  auto sum = lhs + rhs;\n"
+        "  sum += rhs;\n"
+        "  return sum == lhs || sum < rhs;\n"
+        "}}\n\n",
+        index);
+  }
+  return source;
+}
+
+/// \brief Split `str` at `separator`, dropping empty parts.
+auto split(std::string_view str, char separator) -> std::vector<std::string> {
+  auto parts = std::vector<std::string>{};
+  auto stream = std::istringstream{std::string{str}};
+  for (auto part = std::string{}; std::getline(stream, part, separator);) {
+    if (!part.empty()) {
+      parts.push_back(part);
+    }
+  }
+  return parts;
+}
+
+/// \brief Run `arguments`, and measure the wall time and the peak memory of it and of its child processes.
+auto run(const std::vector<std::string>& arguments) -> measurement {
+  const auto start = std::chrono::steady_clock::now();
+  auto result = measurement{};
+#if defined(__unix__) || defined(__APPLE__)
+  auto argv = std::vector<char*>{};
+  for (const auto& argument : arguments) {
+    argv.push_back(const_cast<char*>(argument.c_str()));  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+  }
+  argv.push_back(nullptr);
+
+  auto pid = pid_t{};
+  if (::posix_spawnp(&pid, argv.front(), nullptr, nullptr, argv.data(), environ) != 0) {
+    return result;
+  }
+  auto status = 0;
+  auto usage = rusage{};
+  ::wait4(pid, &status, 0, &usage);
+  result.succeeded = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#if defined(__APPLE__)
+  result.max_rss_kb = usage.ru_maxrss / 1024;  // Bytes on macOS
+#else
+  result.max_rss_kb = usage.ru_maxrss;
+#endif  // defined(__APPLE__)
+#else
+  auto command = std::string{};
+  for (const auto& argument : arguments) {
+    command += std::format("\"{}\" ", argument);
+  }
+  result.succeeded = std::system(command.c_str()) == 0;  // NOLINT(cert-env33-c,concurrency-mt-unsafe)
+#endif  // defined(__unix__) || defined(__APPLE__)
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
+
+}  // namespace
+
+/// \brief Measure the frontend cost of instantiating gw::strong_type, with and without skills, and gw::named_type.
+/// \details For every variant and count, a translation unit that declares and uses `count` distinct types is generated
+/// and compiled with `-fsyntax-only`, so that only the frontend runs. The `int` variant includes the same headers, so
+/// that the difference to it is the cost of the instantiations. The command line accepts `--compiler=<path>`,
+/// `--flags=<space separated flags>`, e.g. `-std=c++20 -ftime-trace`, `--include=<gw include directory>`,
+/// `--counts=<comma separated counts>`, `--repetitions=<count>`, `--work-dir=<directory>` for the generated sources
+/// and traces, `--filter=<substring>` and `--out=<file>`. With `--object`, the translation units are compiled to object
+/// files instead, and their sizes, which grow with the length of the symbols, are reported as well. The results are
+/// written as JSON.
+auto main(int argc, char** argv) -> int {
+  auto compiler = std::string{"c++"};
+  auto flags = std::string{"-std=c++20"};
+  auto include = std::string{};
+  auto counts = std::vector<std::size_t>{100U, 500U, 1000U};
+  auto repetitions = std::size_t{3};
+  auto work_dir = std::filesystem::temp_directory_path() / "gw_compile_time_benchmark";
+  auto filter = std::string{};
+  auto out = std::string{};
+  auto object = false;
+
+  for (const auto argument : std::vector<std::string_view>(argv + 1, argv + argc)) {
+    const auto option = [argument](std::string_view prefix) { return std::string{argument.substr(prefix.size())}; };
+    if (argument.starts_with("--compiler=")) {
+      compiler = option("--compiler=");
+    } else if (argument.starts_with("--flags=")) {
+      flags = option("--flags=");
+    } else if (argument.starts_with("--include=")) {
+      include = option("--include=");
+    } else if (argument.starts_with("--counts=")) {
+      counts.clear();
+      for (const auto& count : split(option("--counts="), ',')) {
+        counts.push_back(std::stoull(count));
+      }
+    } else if (argument.starts_with("--repetitions=")) {
+      repetitions = std::max<std::size_t>(std::stoull(option("--repetitions=")), 1U);
+    } else if (argument.starts_with("--work-dir=")) {
+      work_dir = option("--work-dir=");
+    } else if (argument.starts_with("--filter=")) {
+      filter = option("--filter=");
+    } else if (argument.starts_with("--out=")) {
+      out = option("--out=");
+    } else if (argument == "--object") {
+      object = true;
+    }
+  }
+  std::filesystem::create_directories(work_dir);
+
+  auto results = std::string{};
+  auto baselines = std::map<std::size_t, measurement>{};
+  for (const auto& variant : k_variants) {
+    for (const auto count : counts) {
+      if (std::format("{}/{}", variant.name, count).find(filter) == std::string::npos) {
+        continue;
+      }
+
+      const auto source = work_dir / std::format("{}_{}.cpp", variant.name, count);
+      std::ofstream{source} << generate(variant, count);
+
+      auto arguments = std::vector<std::string>{compiler};
+      std::ranges::move(split(flags, ' '), std::back_inserter(arguments));
+      if (!include.empty()) {
+        arguments.push_back("-I" + include);
+      }
+      const auto object_file = work_dir / std::format("{}_{}.o", variant.name, count);
+      if (object) {
+        arguments.insert(arguments.end(), {"-c", "-o", object_file.string()});
+      } else {
+        arguments.emplace_back("-fsyntax-only");
+      }
+      arguments.push_back(source.string());
+
+      auto samples = std::vector<measurement>{};
+      for (std::size_t repetition = 0U; repetition < repetitions; ++repetition) {
+        samples.push_back(run(arguments));
+        if (!samples.back().succeeded) {
+          std::cerr << std::format("compile_time_benchmark: compiling {} failed\n", source.string());
+          return EXIT_FAILURE;
+        }
+        if (object) {
+          samples.back().object_bytes = std::filesystem::file_size(object_file);
+        }
+      }
+      std::ranges::sort(samples, {}, &measurement::seconds);
+      const auto& median = samples[samples.size() / 2U];
+
+      std::clog << std::format("{:<20} {:>8} {:>10.3f} s", variant.name, count, median.seconds);
+      results += std::format(
+          "{}    {{\"group\": \"compile_time\", \"name\": \"{}\", \"parameter\": \"{}\", \"seconds\": {:.4f}, "
+          "\"min_seconds\": {:.4f}, \"max_seconds\": {:.4f}",
+          results.empty() ? "\n" : ",\n", variant.name, count, median.seconds, samples.front().seconds,
+          samples.back().seconds);
+      if (median.max_rss_kb) {
+        std::clog << std::format(" {:>10} kB", *median.max_rss_kb);
+        results += std::format(", \"max_rss_kb\": {}", *median.max_rss_kb);
+      }
+      if (median.object_bytes) {
+        std::clog << std::format(" {:>10} B object", *median.object_bytes);
+        results += std::format(", \"object_bytes\": {}", *median.object_bytes);
+      }
+
+      // The cost of one type over the int variant, which includes the same headers
+      if (variant.name == "int") {
+        baselines[count] = median;
+      } else if (const auto baseline = baselines.find(count); baseline != baselines.end()) {
+        const auto per_type = static_cast<double>(count);
+        const auto ms_per_type = (median.seconds - baseline->second.seconds) * 1'000.0 / per_type;
+        std::clog << std::format(" {:>8.3f} ms/type", ms_per_type);
+        results += std::format(", \"ms_per_type\": {:.4f}", ms_per_type);
+        if (median.max_rss_kb && baseline->second.max_rss_kb) {
+          const auto kb_per_type = static_cast<double>(*median.max_rss_kb - *baseline->second.max_rss_kb) / per_type;
+          std::clog << std::format(" {:>8.1f} kB/type", kb_per_type);
+          results += std::format(", \"kb_per_type\": {:.1f}", kb_per_type);
+        }
+        if (median.object_bytes && baseline->second.object_bytes) {
+          const auto object_bytes_per_type =
+              (static_cast<double>(*median.object_bytes) - static_cast<double>(*baseline->second.object_bytes)) /
+              per_type;
+          std::clog << std::format(" {:>8.1f} B/type", object_bytes_per_type);
+          results += std::format(", \"object_bytes_per_type\": {:.1f}", object_bytes_per_type);
+        }
+      }
+      std::clog << '\n';
+      results += '}';
+    }
+  }
+
+  const auto json =
+      std::format("{{\n  \"context\": {{\"compiler\": \"{}\", \"flags\": \"{}\"}},\n  \"benchmarks\": [{}\n  ]\n}}\n",
+                  gw::benchmark::detail::json_escape(compiler), gw::benchmark::detail::json_escape(flags), results);
+  if (out.empty()) {
+    std::cout << json;
+  } else {
+    std::ofstream{out} << json;
+  }
+}
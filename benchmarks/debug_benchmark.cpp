@@ -0,0 +1,105 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "gw/named_type.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+constexpr auto k_element_count = std::size_t{1024};
+
+// Both builds report their results under their own group, so that their JSON can be merged
+#if defined(GW_DEBUG_INLINE)
+constexpr auto k_group = std::string_view{"debug_inline"};
+#else
+constexpr auto k_group = std::string_view{"debug"};
+#endif  // defined(GW_DEBUG_INLINE)
+
+using skills_t = gw::skills::with<gw::skills::addable, gw::skills::multipliable, gw::skills::comparable>;
+
+/// \brief Return the contained value of `value`, which is the raw type or a wrapper of it.
+template <typename T>
+auto raw(const T& value) {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return value;
+  } else {
+    return value.value();
+  }
+}
+
+/// \brief Benchmark numeric kernels on `T`, which is the raw type or a wrapper of it, over `k_element_count` elements.
+template <typename T>
+void debug_benchmarks(gw::benchmark::suite& suite, std::string_view parameter) {
+  auto lhs = std::vector<T>{};
+  auto rhs = std::vector<T>{};
+  for (std::size_t index = 0U; index < k_element_count; ++index) {
+    lhs.push_back(T{static_cast<std::int64_t>(index * 3U + 1U)});
+    rhs.push_back(T{static_cast<std::int64_t>(index * 5U + 2U)});
+  }
+
+  suite.run(k_group, "add", parameter, k_element_count, [&] {
+    auto sum = T{};
+    for (std::size_t index = 0U; index < k_element_count; ++index) {
+      sum += lhs[index];
+    }
+    return raw(sum);
+  });
+  suite.run(k_group, "multiply_add", parameter, k_element_count, [&] {
+    auto sum = T{};
+    for (std::size_t index = 0U; index < k_element_count; ++index) {
+      sum = sum + lhs[index] * rhs[index];
+    }
+    return raw(sum);
+  });
+  suite.run(k_group, "compare", parameter, k_element_count, [&] {
+    auto count = std::size_t{};
+    for (std::size_t index = 0U; index < k_element_count; ++index) {
+      count += lhs[index] < rhs[index] ? 1U : 0U;
+    }
+    return count;
+  });
+  suite.run(k_group, "value", parameter, k_element_count, [&] {
+    auto sum = std::int64_t{};
+    for (std::size_t index = 0U; index < k_element_count; ++index) {
+      sum += raw(lhs[index]);
+    }
+    return sum;
+  });
+}
+
+}  // namespace
+
+/// \brief Measure how much slower unoptimized code runs on gw::strong_type and gw::named_type than on the raw type.
+/// \details Built with `-O0` as debug_benchmark, and with `-O0` and GW_DEBUG_INLINE as debug_inline_benchmark. Besides
+/// the JSON of gw::benchmark::suite, the time of every wrapper relative to the raw type is written to the log.
+auto main(int argc, char** argv) -> int {
+  auto suite = gw::benchmark::suite{argc, argv};
+
+  debug_benchmarks<std::int64_t>(suite, "int64_t");
+  debug_benchmarks<gw::strong_type<std::int64_t, struct integer_tag>>(suite, "strong_type<int64_t>");
+  debug_benchmarks<gw::strong_type<std::int64_t, struct skilled_tag, skills_t>>(suite, "strong_type<int64_t, skills>");
+  debug_benchmarks<gw::named_type<std::int64_t, "integer">>(suite, "named_type<int64_t>");
+
+  auto raw_ns_per_item = std::map<std::string, double>{};
+  for (const auto& result : suite.results()) {
+    if (result.parameter == "int64_t") {
+      raw_ns_per_item[result.name] = result.ns_per_item;
+    } else if (const auto raw_result = raw_ns_per_item.find(result.name); raw_result != raw_ns_per_item.end()) {
+      std::clog << std::format("{:<16} {:<16} {:<32} {:>8.2f}x int64_t\n", result.group, result.name, result.parameter,
+                               result.ns_per_item / raw_result->second);
+    }
+  }
+
+  suite.report();
+}
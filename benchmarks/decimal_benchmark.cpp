@@ -0,0 +1,118 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "gw/decimal.hpp"
+
+namespace {
+
+using price_t = gw::decimal<std::int64_t, 4, struct usd_tag>;
+using rate_t = gw::decimal<std::int64_t, 6, struct usd_tag>;
+
+/// \brief Run `function` over `count` elements and return the average time per element in nanoseconds.
+template <typename Function>
+auto measure(std::size_t count, Function function) -> double {
+  const auto start = std::chrono::steady_clock::now();
+  const auto checksum = function();
+  const auto stop = std::chrono::steady_clock::now();
+
+  // Keep the results observable
+  if (checksum == 0) {
+    std::cout << "";
+  }
+  return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(count);
+}
+
+void report(std::string_view name, std::string_view representation, double nanoseconds) {
+  std::cout << std::format("{:<10} {:<10} {:>12.2f}\n", name, representation, nanoseconds);
+}
+
+}  // namespace
+
+auto main() -> int {
+  constexpr auto k_count = std::size_t{1U} << 22U;
+
+  auto engine = std::mt19937{42U};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+  auto price_distribution = std::uniform_int_distribution<std::int64_t>{1, 100'000'000};
+  auto rate_distribution = std::uniform_int_distribution<std::int64_t>{900'000, 1'100'000};
+  auto prices = std::vector<price_t>{};
+  auto rates = std::vector<rate_t>{};
+  auto double_prices = std::vector<double>{};
+  auto double_rates = std::vector<double>{};
+  for (std::size_t index = 0U; index < k_count; ++index) {
+    prices.emplace_back(price_distribution(engine));
+    rates.emplace_back(rate_distribution(engine));
+    double_prices.push_back(static_cast<double>(prices.back().value()) / 1e4);
+    double_rates.push_back(static_cast<double>(rates.back().value()) / 1e6);
+  }
+
+  std::cout << std::format("{:<10} {:<10} {:>12}\n", "operation", "type", "ns/element");
+
+  report("multiply", "double", measure(k_count, [&] {
+           auto sum = 0.0;
+           for (std::size_t index = 0U; index < k_count; ++index) {
+             sum += std::round(double_prices[index] * double_rates[index] * 1e4) / 1e4;
+           }
+           return static_cast<std::int64_t>(sum);
+         }));
+  report("multiply", "decimal", measure(k_count, [&] {
+           auto sum = price_t{};
+           for (std::size_t index = 0U; index < k_count; ++index) {
+             sum += prices[index] * rates[index];
+           }
+           return sum.value();
+         }));
+
+  auto buffer = std::array<char, 32>{};
+  report("format", "double", measure(k_count, [&] {
+           auto length = std::int64_t{};
+           for (const auto price : double_prices) {
+             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+             length += std::snprintf(buffer.data(), buffer.size(), "%.4f", price);
+           }
+           return length;
+         }));
+  report("format", "decimal", measure(k_count, [&] {
+           auto length = std::int64_t{};
+           for (const auto price : prices) {
+             length += gw::to_chars(buffer.data(), buffer.data() + buffer.size(), price).ptr - buffer.data();
+           }
+           return length;
+         }));
+
+  auto texts = std::vector<std::array<char, 32>>(k_count);
+  auto lengths = std::vector<std::size_t>(k_count);
+  for (std::size_t index = 0U; index < k_count; ++index) {
+    lengths[index] = static_cast<std::size_t>(
+        gw::to_chars(texts[index].data(), texts[index].data() + texts[index].size(), prices[index]).ptr -
+        texts[index].data());
+  }
+  report("parse", "double", measure(k_count, [&] {
+           auto sum = 0.0;
+           for (std::size_t index = 0U; index < k_count; ++index) {
+             sum += std::strtod(texts[index].data(), nullptr);
+           }
+           return static_cast<std::int64_t>(sum);
+         }));
+  report("parse", "decimal", measure(k_count, [&] {
+           auto sum = price_t{};
+           for (std::size_t index = 0U; index < k_count; ++index) {
+             auto price = price_t{};
+             gw::from_chars(texts[index].data(), texts[index].data() + lengths[index], price);
+             sum += price;
+           }
+           return sum.value();
+         }));
+}
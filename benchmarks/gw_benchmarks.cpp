@@ -0,0 +1,154 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "gw/inplace_string.hpp"
+#include "gw/named_type.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+constexpr auto k_pool_size = std::size_t{64};  // A power of two, so that the next index is a mask
+constexpr auto k_element_count = std::size_t{1024};
+
+/// \brief Return `k_pool_size` distinct printable strings of `length` characters.
+auto make_texts(std::size_t length) -> std::vector<std::string> {
+  auto texts = std::vector<std::string>(k_pool_size);
+  for (std::size_t index = 0U; index < k_pool_size; ++index) {
+    for (std::size_t position = 0U; position < length; ++position) {
+      texts[index].push_back(static_cast<char>('a' + (index * 7U + position * 13U) % 26U));
+    }
+  }
+  return texts;
+}
+
+/// \brief Benchmark the operations of `gw::inplace_string<N>` on full strings.
+template <std::size_t N>
+void inplace_string_benchmarks(gw::benchmark::suite& suite) {
+  using string_t = gw::inplace_string<N>;
+
+  const auto parameter = std::format("{}", N);
+  const auto texts = make_texts(N);
+  const auto half_texts = make_texts(N / 2U);
+  auto strings = std::vector<string_t>{};
+  auto copies = std::vector<string_t>{};
+  auto halves = std::vector<string_t>{};
+  for (std::size_t index = 0U; index < k_pool_size; ++index) {
+    strings.emplace_back(std::string_view{texts[index]});
+    copies.emplace_back(std::string_view{texts[index]});
+    halves.emplace_back(std::string_view{half_texts[index]});
+  }
+
+  auto index = std::size_t{};
+  const auto next = [&index] { return index = (index + 1U) & (k_pool_size - 1U); };
+
+  suite.run("inplace_string", "construct", parameter, 1U, [&] { return string_t{std::string_view{texts[next()]}}; });
+  suite.run("inplace_string", "size", parameter, 1U, [&] { return strings[next()].size(); });
+  suite.run("inplace_string", "append", parameter, 1U, [&] {
+    auto result = halves[next()];
+    result.append(halves[next()]);
+    return result;
+  });
+  suite.run("inplace_string", "find", parameter, 1U, [&] { return strings[next()].find("#!"sv); });
+  suite.run("inplace_string", "compare", parameter, 1U, [&] {
+    const auto position = next();
+    return strings[position] == copies[position];
+  });
+  suite.run("inplace_string", "hash", parameter, 1U, [&] { return std::hash<string_t>{}(strings[next()]); });
+
+  auto buffer = std::array<char, N + 1U>{};
+  suite.run("inplace_string", "format", parameter, 1U, [&] {
+    gw::benchmark::do_not_optimize(buffer);
+    return std::format_to(buffer.data(), "{}", strings[next()]) - buffer.data();
+  });
+}
+
+/// \brief Benchmark edits that alternate between strings of `k_capacity_count` different capacities.
+/// \details Every capacity is a distinct instantiation of gw::basic_inplace_string, so the instruction cache misses
+/// show how much code the capacities do not share.
+template <std::size_t... Index>
+void inplace_string_capacity_benchmarks(gw::benchmark::suite& suite, std::index_sequence<Index...> /*indices*/) {
+  auto strings = std::tuple{gw::inplace_string<16U + Index * 8U>{"abcdefgh"sv}...};
+  suite.run("inplace_string", "edit", std::format("{} capacities", sizeof...(Index)), sizeof...(Index), [&] {
+    auto found = std::size_t{};
+    const auto edit = [&found](auto& str) {
+      str.insert(1U, "xy");
+      str.append(gw::inplace_string<2>{"z!"sv});
+      found += str.find('!');
+      str.erase(1U, 2U);
+      str.resize(8U);
+    };
+    (edit(std::get<Index>(strings)), ...);
+    return found;
+  });
+}
+
+/// \brief Benchmark arithmetic on `T`, which is the raw type or a wrapper of it, over `k_element_count` elements.
+template <typename T, typename Raw>
+void arithmetic_benchmarks(gw::benchmark::suite& suite, std::string_view parameter) {
+  auto lhs = std::vector<T>{};
+  auto rhs = std::vector<T>{};
+  for (std::size_t index = 0U; index < k_element_count; ++index) {
+    lhs.push_back(T{static_cast<Raw>(index * 3U + 1U)});
+    rhs.push_back(T{static_cast<Raw>(index * 5U + 2U)});
+  }
+
+  suite.run("arithmetic", "add", parameter, k_element_count, [&] {
+    auto sum = T{};
+    for (std::size_t index = 0U; index < k_element_count; ++index) {
+      sum += lhs[index];
+    }
+    return sum;
+  });
+  suite.run("arithmetic", "multiply_add", parameter, k_element_count, [&] {
+    auto sum = T{};
+    for (std::size_t index = 0U; index < k_element_count; ++index) {
+      sum += lhs[index] * rhs[index];
+    }
+    return sum;
+  });
+  suite.run("arithmetic", "compare", parameter, k_element_count, [&] {
+    auto count = std::size_t{};
+    for (std::size_t index = 0U; index < k_element_count; ++index) {
+      count += lhs[index] < rhs[index] ? 1U : 0U;
+    }
+    return count;
+  });
+}
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  auto suite = gw::benchmark::suite{argc, argv};
+
+  inplace_string_benchmarks<7U>(suite);
+  inplace_string_benchmarks<15U>(suite);
+  inplace_string_benchmarks<31U>(suite);
+  inplace_string_benchmarks<63U>(suite);
+  inplace_string_benchmarks<127U>(suite);
+  inplace_string_benchmarks<255U>(suite);
+  inplace_string_capacity_benchmarks(suite, std::make_index_sequence<32U>{});
+
+  // The wrappers should perform exactly like the raw types
+  arithmetic_benchmarks<std::uint64_t, std::uint64_t>(suite, "uint64_t");
+  arithmetic_benchmarks<gw::strong_type<std::uint64_t, struct integer_tag>, std::uint64_t>(suite, "strong_type<uint64_t>");
+  arithmetic_benchmarks<gw::named_type<std::uint64_t, "integer">, std::uint64_t>(suite, "named_type<uint64_t>");
+  arithmetic_benchmarks<double, double>(suite, "double");
+  arithmetic_benchmarks<gw::strong_type<double, struct real_tag>, double>(suite, "strong_type<double>");
+  arithmetic_benchmarks<gw::named_type<double, "real">, double>(suite, "named_type<double>");
+
+  suite.report();
+}
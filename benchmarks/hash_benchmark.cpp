@@ -0,0 +1,78 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+#include "gw/hash.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+using order_id_t = gw::strong_type<std::uint64_t, struct order_id_tag>;
+
+struct probe_stats {
+  std::size_t collisions{};    ///< Number of keys whose home bucket was already occupied.
+  std::size_t total_probes{};  ///< Sum of the probe lengths of all keys.
+  std::size_t max_probes{};    ///< Longest probe sequence of any key.
+};
+
+/// \brief Insert `count` ids spaced `stride` apart into a linear probing table with `capacity` buckets.
+template <typename Hash>
+auto simulate(std::size_t count, std::uint64_t stride, std::size_t capacity, Hash hash) -> probe_stats {
+  auto occupied = std::vector<bool>(capacity);
+  auto stats = probe_stats{};
+  const auto mask = capacity - 1U;
+
+  for (auto i = std::uint64_t{}; i < count; ++i) {
+    auto bucket = hash(order_id_t{i * stride}) & mask;
+    auto probes = std::size_t{1};
+    if (occupied[bucket]) {
+      ++stats.collisions;
+    }
+    while (occupied[bucket]) {
+      bucket = (bucket + 1U) & mask;
+      ++probes;
+    }
+    occupied[bucket] = true;
+    stats.total_probes += probes;
+    stats.max_probes = std::max(stats.max_probes, probes);
+  }
+
+  return stats;
+}
+
+/// \brief The hash used before gw::hash_combine: a plain XOR of the tag and value hashes.
+auto xor_hash(const order_id_t& order_id) -> std::size_t {
+  constexpr auto tag_hash = static_cast<std::size_t>(gw::type_hash_v<order_id_tag>);
+  return tag_hash ^ std::hash<std::uint64_t>{}(order_id.value());
+}
+
+void report(std::string_view name, std::size_t count, std::uint64_t stride, std::size_t capacity,
+            const probe_stats& stats) {
+  std::cout << std::format("{:<14} {:>10} {:>8} {:>10} {:>12} {:>12.3f} {:>12}\n", name, count, stride, capacity,
+                           stats.collisions, static_cast<double>(stats.total_probes) / static_cast<double>(count),
+                           stats.max_probes);
+}
+
+}  // namespace
+
+auto main() -> int {
+  std::cout << std::format("{:<14} {:>10} {:>8} {:>10} {:>12} {:>12} {:>12}\n", "hash", "keys", "stride", "buckets",
+                           "collisions", "avg probes", "max probes");
+
+  for (const auto capacity : {std::size_t{1} << 10U, std::size_t{1} << 16U, std::size_t{1} << 20U}) {
+    for (const auto count : {capacity / 2U, capacity / 8U * 7U}) {
+      for (const auto stride : {std::uint64_t{1}, std::uint64_t{64}, std::uint64_t{4096}}) {
+        report("xor", count, stride, capacity, simulate(count, stride, capacity, xor_hash));
+        report("hash_combine", count, stride, capacity, simulate(count, stride, capacity, std::hash<order_id_t>{}));
+      }
+    }
+  }
+}
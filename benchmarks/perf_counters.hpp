@@ -0,0 +1,273 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // defined(__linux__)
+
+/// \brief GW benchmark namespace
+namespace gw::benchmark {
+
+//
+// Counters
+//
+
+/// \brief The hardware events that gw::benchmark::perf_counters count.
+enum class counter : std::size_t {
+  cycles,         ///< CPU cycles.
+  instructions,   ///< Retired instructions.
+  branch_misses,  ///< Mispredicted branches.
+  l1d_misses,     ///< Level 1 data cache read misses.
+  l1i_misses,     ///< Level 1 instruction cache read misses.
+  llc_misses,     ///< Last level cache misses.
+};
+
+/// \brief The number of hardware events.
+inline constexpr std::size_t k_counter_count = 6U;
+
+/// \brief All hardware events, in the order of their values.
+inline constexpr auto k_counters = std::array{counter::cycles,     counter::instructions, counter::branch_misses,
+                                              counter::l1d_misses, counter::l1i_misses,   counter::llc_misses};
+
+/// \brief Return the name of `event`, as used in reports.
+constexpr auto counter_name(counter event) noexcept -> std::string_view {
+  constexpr auto k_names =
+      std::array<std::string_view, k_counter_count>{"cycles",     "instructions", "branch_misses",
+                                                    "l1d_misses", "l1i_misses",   "llc_misses"};
+  return k_names[static_cast<std::size_t>(event)];
+}
+
+/// \brief The counts of the hardware events, which are empty for events that could not be counted.
+struct counter_values {
+  std::array<std::optional<double>, k_counter_count> counts;  ///< The counts, indexed by gw::benchmark::counter.
+
+  /// \brief returns the count of `event`
+  [[nodiscard]] constexpr auto operator[](counter event) const noexcept -> const std::optional<double>& {
+    return counts[static_cast<std::size_t>(event)];
+  }
+
+  /// \brief returns the count of `event`
+  [[nodiscard]] constexpr auto operator[](counter event) noexcept -> std::optional<double>& {
+    return counts[static_cast<std::size_t>(event)];
+  }
+
+  /// \brief adds the counts of `rhs` to the counts that are present in both
+  constexpr auto operator+=(const counter_values& rhs) noexcept -> counter_values& {
+    for (std::size_t index = 0U; index < k_counter_count; ++index) {
+      counts[index] = counts[index] && rhs.counts[index] ? std::optional{*counts[index] + *rhs.counts[index]}
+                                                         : std::nullopt;
+    }
+    return *this;
+  }
+
+  /// \brief divides the counts by `divisor`
+  constexpr auto operator/=(double divisor) noexcept -> counter_values& {
+    for (auto& count : counts) {
+      if (count) {
+        *count /= divisor;
+      }
+    }
+    return *this;
+  }
+};
+
+//
+// Performance counters
+//
+
+/// \brief Hardware performance counters of the calling thread.
+/// \details On Linux the events are opened with `perf_event_open` when the object is constructed, and closed when it
+/// is destroyed. Events that the kernel, the hardware or the permissions (see `/proc/sys/kernel/perf_event_paranoid`)
+/// do not allow are not available, and have no values; on other platforms no event is available. The events are
+/// opened one by one, so that a missing event does not disable the others, and their counts are scaled when the
+/// kernel multiplexes them.
+class perf_counters {
+ public:
+  /// \brief opens the available events, which are stopped
+  perf_counters() noexcept {
+#if defined(__linux__)
+    for (const auto event : k_counters) {
+      m_descriptors[static_cast<std::size_t>(event)] = open(event);
+    }
+#endif  // defined(__linux__)
+  }
+
+  perf_counters(const perf_counters&) = delete;
+  auto operator=(const perf_counters&) -> perf_counters& = delete;
+
+  /// \brief takes over the events of `other`
+  perf_counters(perf_counters&& other) noexcept : m_descriptors(std::exchange(other.m_descriptors, k_closed)) {}
+
+  /// \brief closes the events, and takes over the events of `other`
+  auto operator=(perf_counters&& other) noexcept -> perf_counters& {
+    if (this != &other) {
+      close();
+      m_descriptors = std::exchange(other.m_descriptors, k_closed);
+    }
+    return *this;
+  }
+
+  /// \brief closes the events
+  ~perf_counters() { close(); }
+
+  /// \brief checks whether `event` is counted
+  [[nodiscard]] auto available(counter event) const noexcept -> bool {
+    return m_descriptors[static_cast<std::size_t>(event)] >= 0;
+  }
+
+  /// \brief checks whether any event is counted
+  [[nodiscard]] auto any_available() const noexcept -> bool {
+    for (const auto event : k_counters) {
+      if (available(event)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// \brief resets the counts to zero and starts counting
+  void start() noexcept {
+#if defined(__linux__)
+    for (const auto descriptor : m_descriptors) {
+      if (descriptor >= 0) {
+        ::ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);   // NOLINT(cppcoreguidelines-pro-type-vararg)
+        ::ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+      }
+    }
+#endif  // defined(__linux__)
+  }
+
+  /// \brief stops counting
+  void stop() noexcept {
+#if defined(__linux__)
+    for (const auto descriptor : m_descriptors) {
+      if (descriptor >= 0) {
+        ::ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+      }
+    }
+#endif  // defined(__linux__)
+  }
+
+  /// \brief returns the counts since the last start
+  [[nodiscard]] auto read() const noexcept -> counter_values {
+    auto values = counter_values{};
+#if defined(__linux__)
+    for (const auto event : k_counters) {
+      const auto descriptor = m_descriptors[static_cast<std::size_t>(event)];
+      // The count, the time enabled and the time running, as requested by read_format
+      auto buffer = std::array<std::uint64_t, 3>{};
+      if (descriptor < 0 || ::read(descriptor, buffer.data(), sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer))) {
+        continue;
+      }
+      const auto [count, enabled, running] = buffer;
+      if (running != 0U) {
+        values[event] = static_cast<double>(count) * static_cast<double>(enabled) / static_cast<double>(running);
+      }
+    }
+#endif  // defined(__linux__)
+    return values;
+  }
+
+ private:
+  static constexpr auto k_closed = std::array<int, k_counter_count>{-1, -1, -1, -1, -1, -1};
+
+#if defined(__linux__)
+  static auto open(counter event) noexcept -> int {
+    auto attributes = perf_event_attr{};
+    attributes.size = sizeof(attributes);
+    attributes.disabled = 1U;
+    attributes.exclude_kernel = 1U;
+    attributes.exclude_hv = 1U;
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    constexpr auto k_cache = [](std::uint64_t cache) {
+      return cache | (std::uint64_t{PERF_COUNT_HW_CACHE_OP_READ} << 8U) |
+             (std::uint64_t{PERF_COUNT_HW_CACHE_RESULT_MISS} << 16U);
+    };
+    switch (event) {
+      case counter::cycles:
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case counter::instructions:
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case counter::branch_misses:
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      case counter::l1d_misses:
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.config = k_cache(PERF_COUNT_HW_CACHE_L1D);
+        break;
+      case counter::l1i_misses:
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.config = k_cache(PERF_COUNT_HW_CACHE_L1I);
+        break;
+      case counter::llc_misses:
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+    }
+
+    // Count the calling thread on any CPU
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    const auto descriptor = ::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+    return descriptor < 0 ? -1 : static_cast<int>(descriptor);
+  }
+#endif  // defined(__linux__)
+
+  void close() noexcept {
+#if defined(__linux__)
+    for (auto& descriptor : m_descriptors) {
+      if (descriptor >= 0) {
+        ::close(descriptor);
+      }
+      descriptor = -1;
+    }
+#endif  // defined(__linux__)
+  }
+
+  std::array<int, k_counter_count> m_descriptors = k_closed;
+};
+
+/// \brief Counts the hardware events while it is alive.
+/// \details Starts `counters` when it is constructed, and stops them and stores their counts in `values` when it is
+/// destroyed.
+class scoped_count {
+ public:
+  /// \brief starts `counters`
+  scoped_count(perf_counters& counters, counter_values& values) noexcept : m_counters(counters), m_values(values) {
+    m_counters.start();
+  }
+
+  scoped_count(const scoped_count&) = delete;
+  scoped_count(scoped_count&&) = delete;
+  auto operator=(const scoped_count&) -> scoped_count& = delete;
+  auto operator=(scoped_count&&) -> scoped_count& = delete;
+
+  /// \brief stops the counters and stores their counts
+  ~scoped_count() {
+    m_counters.stop();
+    m_values = m_counters.read();
+  }
+
+ private:
+  perf_counters& m_counters;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+  counter_values& m_values;   // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+};
+
+}  // namespace gw::benchmark
@@ -0,0 +1,80 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "gw/slot_map.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+using order_id_t = gw::strong_type<std::uint32_t, struct order_id_tag>;
+
+struct order {
+  std::uint64_t quantity;
+  double price;
+};
+
+/// \brief Run `lookups` random lookups through `find` and return the average time per lookup in nanoseconds.
+template <typename Keys, typename Find>
+auto measure(const Keys& keys, std::size_t lookups, Find find) -> double {
+  auto engine = std::mt19937{42U};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+  auto distribution = std::uniform_int_distribution<std::size_t>{0U, keys.size() - 1U};
+  auto indices = std::vector<std::size_t>(lookups);
+  for (auto& index : indices) {
+    index = distribution(engine);
+  }
+
+  auto checksum = std::uint64_t{};
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto index : indices) {
+    checksum += find(keys[index]).quantity;
+  }
+  const auto stop = std::chrono::steady_clock::now();
+
+  // Keep the lookups observable
+  if (checksum == 0U) {
+    std::cout << "";
+  }
+  return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(lookups);
+}
+
+void report(std::string_view name, std::size_t count, double nanoseconds) {
+  std::cout << std::format("{:<14} {:>10} {:>12.2f}\n", name, count, nanoseconds);
+}
+
+}  // namespace
+
+auto main() -> int {
+  constexpr auto k_lookups = std::size_t{1U} << 22U;
+
+  std::cout << std::format("{:<14} {:>10} {:>12}\n", "container", "orders", "ns/lookup");
+  for (const auto count : {std::size_t{1U} << 10U, std::size_t{1U} << 16U, std::size_t{1U} << 20U}) {
+    auto map = std::unordered_map<order_id_t, order>{};
+    auto map_keys = std::vector<order_id_t>{};
+    auto slots = gw::slot_map<order, order_id_tag>{};
+    auto slot_keys = std::vector<gw::slot_key<order_id_tag>>{};
+
+    for (auto index = std::uint32_t{}; index < count; ++index) {
+      const auto value = order{index + 1U, 100.0};
+      map_keys.emplace_back(index);
+      map.emplace(map_keys.back(), value);
+      slot_keys.push_back(slots.insert(value));
+    }
+
+    report("unordered_map", count, measure(map_keys, k_lookups, [&](order_id_t id) -> const order& {
+             return map.find(id)->second;
+           }));
+    report("slot_map", count, measure(slot_keys, k_lookups, [&](gw::slot_key<order_id_tag> key) -> const order& {
+             return slots[key];
+           }));
+  }
+}
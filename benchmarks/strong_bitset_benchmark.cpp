@@ -0,0 +1,103 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "gw/strong_bitset.hpp"
+
+namespace {
+
+using customers_t = gw::dynamic_strong_bitset<struct customer_tag>;
+
+/// \brief Run `function` `repetitions` times and return the average time per run in microseconds.
+template <typename Function>
+auto measure(std::size_t repetitions, Function function) -> double {
+  auto checksum = std::size_t{};
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t repetition = 0U; repetition < repetitions; ++repetition) {
+    checksum += function();
+  }
+  const auto stop = std::chrono::steady_clock::now();
+
+  // Keep the results observable
+  if (checksum == 0U) {
+    std::cout << "";
+  }
+  return std::chrono::duration<double, std::micro>(stop - start).count() / static_cast<double>(repetitions);
+}
+
+void report(std::string_view name, std::string_view container, double microseconds) {
+  std::cout << std::format("{:<10} {:<22} {:>12.1f}\n", name, container, microseconds);
+}
+
+}  // namespace
+
+auto main() -> int {
+  constexpr auto k_bits = std::size_t{1U} << 24U;
+  constexpr auto k_repetitions = std::size_t{20U};
+
+  // Sparse masks: about one bit in 64 is set
+  auto engine = std::mt19937{42U};  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+  auto distribution = std::uniform_int_distribution<std::size_t>{0U, 63U};
+  auto entitled = customers_t{k_bits};
+  auto suspended = customers_t{k_bits};
+  auto entitled_bools = std::vector<bool>(k_bits);
+  auto suspended_bools = std::vector<bool>(k_bits);
+  for (std::size_t pos = 0U; pos < k_bits; ++pos) {
+    if (distribution(engine) == 0U) {
+      entitled.set(pos);
+      entitled_bools[pos] = true;
+    }
+    if (distribution(engine) == 0U) {
+      suspended.set(pos);
+      suspended_bools[pos] = true;
+    }
+  }
+
+  std::cout << std::format("{:<10} {:<22} {:>12}\n", "operation", "container", "us/run");
+
+  report("and_not", "std::vector<bool>", measure(k_repetitions, [&] {
+           auto result = entitled_bools;
+           for (std::size_t pos = 0U; pos < k_bits; ++pos) {
+             result[pos] = entitled_bools[pos] && !suspended_bools[pos];
+           }
+           return static_cast<std::size_t>(result[k_bits - 1U]);
+         }));
+  report("and_not", "dynamic_strong_bitset", measure(k_repetitions, [&] {
+           auto result = entitled;
+           result.reset(suspended);
+           return static_cast<std::size_t>(result[k_bits - 1U]);
+         }));
+
+  report("count", "std::vector<bool>", measure(k_repetitions, [&] {
+           auto count = std::size_t{};
+           for (const auto bit : entitled_bools) {
+             count += bit ? 1U : 0U;
+           }
+           return count;
+         }));
+  report("count", "dynamic_strong_bitset", measure(k_repetitions, [&] { return entitled.count(); }));
+
+  report("scan", "std::vector<bool>", measure(k_repetitions, [&] {
+           auto sum = std::size_t{};
+           for (std::size_t pos = 0U; pos < k_bits; ++pos) {
+             if (entitled_bools[pos]) {
+               sum += pos;
+             }
+           }
+           return sum;
+         }));
+  report("scan", "dynamic_strong_bitset", measure(k_repetitions, [&] {
+           auto sum = std::size_t{};
+           for (const auto pos : entitled.set_bits()) {
+             sum += pos;
+           }
+           return sum;
+         }));
+}
@@ -0,0 +1,37 @@
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <format>
+#include <gw/atomic_strong_type.hpp>
+#include <gw/strong_type.hpp>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using orders_t = gw::strong_type<std::uint64_t, struct orders_tag>;
+
+// One counter per worker, each on its own cache line to avoid false sharing
+using order_counter_t = gw::padded_atomic_strong_type<std::uint64_t, orders_tag>;
+
+auto main() -> int {
+  constexpr auto k_workers = 4U;
+  auto counters = std::array<order_counter_t, k_workers>{};
+
+  {
+    auto workers = std::vector<std::jthread>{};
+    for (auto& counter : counters) {
+      workers.emplace_back([&counter] {
+        for (auto order = 0U; order < 1'000U; ++order) {
+          // The counter only accepts orders_t, not raw integers or other strong types
+          counter.fetch_add(orders_t{1U}, std::memory_order_relaxed);
+        }
+      });
+    }
+  }
+
+  auto total = orders_t{};
+  for (const auto& counter : counters) {
+    total += counter.load(std::memory_order_relaxed);
+  }
+  std::cout << std::format("orders: {}\n", total);
+}
@@ -0,0 +1,33 @@
+#include <array>
+#include <cstddef>
+#include <format>
+#include <gw/bounded.hpp>
+#include <iostream>
+
+// Discounts are validated once, when they enter the system
+using discount_t = gw::bounded<int, 0, 100, struct percent_tag>;
+
+// Weekdays index a week of prices without range checks
+using weekday_t = gw::bounded<std::size_t, 0, 6, struct weekday_tag>;
+
+auto main() -> int {
+  const auto prices = std::array<int, 7>{100, 100, 120, 120, 150, 200, 180};
+
+  auto discount = discount_t{};
+  try {
+    discount = discount_t{120};
+  } catch (const std::out_of_range& error) {
+    std::cout << error.what() << '\n';
+  }
+  discount = discount_t{25};
+
+  // The bounds of the result follow from the bounds of the operands: [0, 100] + [0, 100] is [0, 200]
+  const auto combined = discount + discount_t{10};
+  std::cout << std::format("combined discount: {} in [{}, {}]\n", combined, combined.min_value, combined.max_value);
+
+  for (auto day = std::size_t{}; day < prices.size(); ++day) {
+    // Checked once here, then the index into the week is proven in range
+    const auto weekday = weekday_t{day};
+    std::cout << std::format("day {}: {}\n", weekday, gw::index(prices, weekday) * (100 - discount.value()) / 100);
+  }
+}
@@ -0,0 +1,33 @@
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <gw/compact_optional.hpp>
+#include <gw/strong_type.hpp>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <vector>
+
+// The tag reserves the largest id as the empty state
+struct manager_id_tag {
+  static constexpr auto sentinel = std::numeric_limits<std::uint32_t>::max();
+};
+using manager_id_t = gw::strong_type<std::uint32_t, manager_id_tag>;
+
+auto main() -> int {
+  // A sparse column: most employees have no manager
+  auto managers = std::vector<gw::compact_optional<manager_id_t>>(1'000);
+  managers[3] = manager_id_t{1U};
+  managers[7] = manager_id_t{3U};
+
+  const auto optional_bytes = managers.size() * sizeof(std::optional<manager_id_t>);
+  const auto compact_bytes = managers.size() * sizeof(managers.front());
+  std::cout << std::format("std::optional column:        {} bytes\n", optional_bytes);
+  std::cout << std::format("gw::compact_optional column: {} bytes\n", compact_bytes);
+
+  for (auto employee = std::size_t{}; employee < 10U; ++employee) {
+    if (const auto& manager = managers[employee]) {
+      std::cout << std::format("employee {} reports to {}\n", employee, manager->value());
+    }
+  }
+}
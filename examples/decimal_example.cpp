@@ -0,0 +1,28 @@
+#include <cstdint>
+#include <format>
+#include <gw/decimal.hpp>
+#include <iostream>
+#include <string_view>
+
+// Prices in USD with four decimal places, rates with six
+using price_t = gw::decimal<std::int64_t, 4, struct usd_tag>;
+using rate_t = gw::decimal<std::int64_t, 6, struct usd_tag>;
+
+// Amounts in EUR do not mix with amounts in USD
+using euro_t = gw::decimal<std::int64_t, 4, struct eur_tag>;
+
+auto main() -> int {
+  auto price = price_t{};
+  const auto text = std::string_view{"20.00"};
+  gw::from_chars(text.data(), text.data() + text.size(), price);
+
+  // 20.0000 * 1.075000 = 21.5000
+  const auto gross = price * rate_t{1'075'000};
+  std::cout << std::format("gross: {}\n", gross);
+
+  // Split into three payments, the last one takes the remainder
+  const auto installment = gw::decimal_divide<gw::rounding::toward_zero>(gross, price_t{30'000});
+  std::cout << std::format("installments: {}, {}, {}\n", installment, installment, gross - installment * 2);
+
+  // price + euro_t{10'000};  // does not compile
+}
@@ -0,0 +1,36 @@
+// Build with GW_INPLACE_STRING_INSTRUMENTATION defined, e.g. with the CMake option of the same name.
+#include <array>
+#include <gw/inplace_string.hpp>
+#include <gw/inplace_string_statistics.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+
+using symbol_t = gw::inplace_string<7>;
+using venue_t = gw::inplace_string<15>;
+
+auto main() -> int {
+  using namespace std::string_view_literals;
+
+  // Report the events of all strings to the statistics
+  auto statistics = gw::inplace_string_statistics{};
+  gw::set_inplace_string_sink(&statistics);
+
+  for (const auto text : std::array{"AAPL"sv, "MSFT"sv, "BRK.B"sv, "GOOGL"sv}) {
+    auto symbol = symbol_t{text};
+    try {
+      symbol.append(gw::inplace_string<3>{".US"sv});
+    } catch (const std::length_error& error) {
+      std::cerr << error.what() << '\n';
+    }
+  }
+  for (const auto text : std::array{"XNAS"sv, "XNYS"sv, "BATS"sv}) {
+    const auto venue = venue_t{text};
+    static_cast<void>(venue.size());
+  }
+
+  gw::set_inplace_string_sink(nullptr);
+
+  // symbol_t overflows and needs 8 characters, and venue_t would fit in 4
+  statistics.report(std::cout);
+}
@@ -9,6 +9,11 @@ static constexpr auto k_string_size = 20U;
 using name_t = gw::named_type<gw::inplace_string<k_string_size>, "name">;
 using address_t = gw::named_type<gw::inplace_string<k_string_size>, "address">;
 
+// Long names can be kept out of the symbols by naming a type instead
+struct email_address : gw::name_id<"primary_email_address_of_the_account_holder"> {};
+using email_address_t = gw::named_type<gw::inplace_string<k_string_size>, gw::name_of<email_address>>;
+static_assert(email_address_t::name() == "primary_email_address_of_the_account_holder");
+
 // gw::named_types are distinct types
 static_assert(!std::is_same_v<name_t, address_t>);
 
@@ -0,0 +1,44 @@
+#include <cstdint>
+#include <format>
+#include <gw/packed_record.hpp>
+#include <gw/strong_type.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+enum class side : std::uint8_t { buy, sell };
+
+using quantity_t = gw::strong_type<std::uint32_t, struct quantity_tag>;
+using venue_t = gw::strong_type<std::uint32_t, struct venue_tag>;
+
+// 20 + 12 + 1 bits are stored in one 64-bit word
+using order_t =
+    gw::packed_record<gw::field<"qty", quantity_t, 20>, gw::field<"venue", venue_t, 12>, gw::field<"side", side, 1>>;
+
+struct unpacked_order {
+  quantity_t quantity;
+  venue_t venue;
+  side direction;
+};
+
+auto main() -> int {
+  auto orders = std::vector<order_t>{};
+  orders.emplace_back(quantity_t{500U}, venue_t{42U}, side::buy);
+  orders.emplace_back(quantity_t{1'200U}, venue_t{7U}, side::sell);
+
+  // Fields keep their types: this is a quantity_t, not an integer
+  auto total = quantity_t{};
+  for (const auto& order : orders) {
+    total += order.get<"qty">();
+  }
+  std::cout << std::format("total quantity: {}\n", total);
+
+  try {
+    orders.front().set<"qty">(quantity_t{2'000'000U});
+  } catch (const std::out_of_range& error) {
+    std::cout << error.what() << '\n';
+  }
+
+  std::cout << std::format("{} bytes per packed order, {} bytes per unpacked order\n", sizeof(order_t),
+                           sizeof(unpacked_order));
+}
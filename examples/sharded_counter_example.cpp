@@ -0,0 +1,28 @@
+#include <cstdint>
+#include <format>
+#include <gw/sharded_counter.hpp>
+#include <gw/strong_type.hpp>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using requests_t = gw::strong_type<std::uint64_t, struct requests_tag>;
+
+auto main() -> int {
+  // Increments from different CPUs go to different cache lines
+  auto requests = gw::sharded_counter<requests_t>{};
+
+  {
+    auto workers = std::vector<std::jthread>{};
+    for (auto worker = 0U; worker < 4U; ++worker) {
+      workers.emplace_back([&requests] {
+        for (auto request = 0U; request < 1'000U; ++request) {
+          ++requests;
+        }
+      });
+    }
+  }
+
+  // Reads aggregate all shards
+  std::cout << std::format("requests: {} ({} shards)\n", requests.load(), requests.shard_count());
+}
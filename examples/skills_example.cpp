@@ -0,0 +1,32 @@
+#include <format>
+#include <gw/skills.hpp>
+#include <gw/strong_type.hpp>
+#include <iostream>
+#include <unordered_map>
+
+// An amount can be added, compared and printed, but not multiplied
+using amount_t = gw::strong_type<long, struct amount_tag,
+                                 gw::skills::with<gw::skills::addable, gw::skills::comparable, gw::skills::printable>>;
+
+// An account id can only be compared for equality and hashed
+using account_id_t = gw::strong_type<unsigned, struct account_id_tag,
+                                     gw::skills::with<gw::skills::equality_comparable, gw::skills::hashable>>;
+
+template <typename T>
+concept multipliable = requires(T lhs, T rhs) { lhs * rhs; };
+
+static_assert(!multipliable<amount_t>);
+static_assert(sizeof(amount_t) == sizeof(long));
+
+auto main() -> int {
+  auto balances = std::unordered_map<account_id_t, amount_t>{};
+  balances[account_id_t{1U}] += amount_t{100};
+  balances[account_id_t{1U}] += amount_t{50};
+  balances[account_id_t{2U}] += amount_t{20};
+
+  for (const auto& [account_id, balance] : balances) {
+    if (balance > amount_t{100}) {
+      std::cout << std::format("account {} has a balance of {}\n", account_id.value(), balance);
+    }
+  }
+}
@@ -0,0 +1,36 @@
+#include <cstdint>
+#include <format>
+#include <gw/slot_map.hpp>
+#include <gw/strong_type.hpp>
+#include <iostream>
+
+using quantity_t = gw::strong_type<std::uint32_t, struct quantity_tag>;
+
+struct order {
+  quantity_t quantity;
+  double price;
+};
+
+using order_book_t = gw::slot_map<order, struct order_id_tag>;
+
+auto main() -> int {
+  auto book = order_book_t{};
+
+  // Insertion hands out generational keys
+  const auto bid = book.insert(order{quantity_t{100U}, 99.5});
+  const auto ask = book.insert(order{quantity_t{200U}, 100.5});
+
+  // Lookup is two array accesses, no hashing
+  book[bid].quantity -= quantity_t{40U};
+
+  // Keys to erased orders are detected, even after their slot is reused
+  book.erase(ask);
+  const auto replacement = book.insert(order{quantity_t{50U}, 100.25});
+  std::cout << std::format("ask still valid: {}, replacement valid: {}\n", book.contains(ask),
+                           book.contains(replacement));
+
+  // Iteration covers a contiguous array
+  for (const auto& [quantity, price] : book) {
+    std::cout << std::format("{} @ {}\n", quantity, price);
+  }
+}
@@ -0,0 +1,31 @@
+#include <format>
+#include <gw/strong_bitset.hpp>
+#include <iostream>
+
+// Sets of customers, one bit per customer id
+using customers_t = gw::dynamic_strong_bitset<struct customer_tag>;
+
+// Sets of features, one bit per feature id
+using features_t = gw::strong_bitset<256, struct feature_tag>;
+
+auto main() -> int {
+  constexpr auto k_customers = 1'000'000U;
+
+  auto entitled = customers_t{k_customers};
+  auto suspended = customers_t{k_customers};
+  entitled.set(42U).set(4'242U).set(424'242U);
+  suspended.set(4'242U);
+
+  // Entitled customers that are not suspended
+  const auto active = and_not(entitled, suspended);
+  std::cout << std::format("active: {}\n", active.count());
+  for (const auto customer : active.set_bits()) {
+    std::cout << std::format("customer {}\n", customer);
+  }
+
+  // Sets of features cannot be combined with sets of customers
+  auto features = features_t{};
+  features.set(7U);
+  // active & features;  // does not compile
+  std::cout << std::format("first feature: {}\n", features.find_first());
+}
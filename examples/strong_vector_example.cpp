@@ -0,0 +1,31 @@
+#include <format>
+#include <gw/strong_type.hpp>
+#include <gw/strong_vector.hpp>
+#include <iostream>
+#include <stdexcept>
+
+using notional_t = gw::strong_type<double, struct notional_tag>;
+using notionals_t = gw::strong_vector<double, notional_tag>;
+
+auto main() -> int {
+  try {
+    const auto notionals = notionals_t{notional_t{1'000.0}, notional_t{2'500.0}, notional_t{750.0}};
+    const auto hedges = notionals_t{notional_t{-400.0}, notional_t{-2'500.0}, notional_t{0.0}};
+
+    // Whole-array operations keep the tag
+    const auto net = notionals + hedges;
+    const auto stressed = net * 1.1;
+
+    std::cout << std::format("total: {}\n", stressed.sum());
+    std::cout << std::format("largest: {}\n", stressed.max());
+
+    const auto open = net.greater(notional_t{0.0});
+    for (auto idx = 0U; idx < open.size(); ++idx) {
+      if (open[idx] != 0U) {
+        std::cout << std::format("position {} is open: {}\n", idx, net[idx]);
+      }
+    }
+  } catch (const std::invalid_argument& ex) {
+    std::cerr << ex.what() << '\n';
+  }
+}
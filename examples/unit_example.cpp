@@ -0,0 +1,26 @@
+#include <format>
+#include <gw/strong_type.hpp>
+#include <gw/unit.hpp>
+#include <iostream>
+
+using kilometers_t = gw::quantity<double, gw::kilometer>;
+using meters_t = gw::quantity<double, gw::meter>;
+using hours_t = gw::quantity<double, gw::hour>;
+using meters_per_second = gw::unit_divide<gw::meter, gw::second>;
+
+auto main() -> int {
+  constexpr auto distance = kilometers_t{42.195};
+  constexpr auto duration = hours_t{2.0};
+
+  // The unit of the speed is derived at compile time: kilometers per hour
+  constexpr auto speed = distance / duration;
+
+  // Conversions between units of the same dimension use compile-time ratios
+  constexpr auto speed_si = gw::quantity_cast<meters_per_second>(speed);
+
+  // Quantities of the same dimension are added in their common unit
+  constexpr auto total = distance + meters_t{805.0};
+
+  std::cout << std::format("{} km/h = {} m/s\n", speed, speed_si);
+  std::cout << std::format("{} m\n", total);
+}
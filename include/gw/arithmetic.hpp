@@ -0,0 +1,481 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+
+#include "gw/config.hpp"
+#include "gw/error.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+namespace detail {
+
+/// \brief Concept for the integer types that the overflow-aware arithmetic policies operate on.
+template <typename T>
+concept overflow_integral = std::integral<T> && !std::same_as<T, bool>;
+
+/// \brief Calculate `lhs + rhs`, wrapping on overflow, with plain integer operations.
+/// \details Unlike the compiler's overflow builtins, this formulation vectorizes.
+/// \return True if the operation overflowed, false otherwise.
+template <overflow_integral T>
+constexpr auto add_overflow_bitwise(T lhs, T rhs, T& result) noexcept -> bool {
+  using unsigned_type = std::make_unsigned_t<T>;
+  result = static_cast<T>(static_cast<unsigned_type>(lhs) + static_cast<unsigned_type>(rhs));
+  if constexpr (std::is_signed_v<T>) {
+    return ((lhs ^ result) & (rhs ^ result)) < 0;  // NOLINT(hicpp-signed-bitwise)
+  } else {
+    return result < lhs;
+  }
+}
+
+/// \brief Calculate `lhs - rhs`, wrapping on overflow, with plain integer operations.
+/// \details Unlike the compiler's overflow builtins, this formulation vectorizes.
+/// \return True if the operation overflowed, false otherwise.
+template <overflow_integral T>
+constexpr auto sub_overflow_bitwise(T lhs, T rhs, T& result) noexcept -> bool {
+  using unsigned_type = std::make_unsigned_t<T>;
+  result = static_cast<T>(static_cast<unsigned_type>(lhs) - static_cast<unsigned_type>(rhs));
+  if constexpr (std::is_signed_v<T>) {
+    return ((lhs ^ rhs) & (lhs ^ result)) < 0;  // NOLINT(hicpp-signed-bitwise)
+  } else {
+    return lhs < rhs;
+  }
+}
+
+/// \brief Calculate `lhs + rhs`, wrapping on overflow.
+/// \return True if the operation overflowed, false otherwise.
+template <overflow_integral T>
+constexpr auto add_overflow(T lhs, T rhs, T& result) noexcept -> bool {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_add_overflow(lhs, rhs, &result);
+#else
+  return add_overflow_bitwise(lhs, rhs, result);
+#endif
+}
+
+/// \brief Calculate `lhs - rhs`, wrapping on overflow.
+/// \return True if the operation overflowed, false otherwise.
+template <overflow_integral T>
+constexpr auto sub_overflow(T lhs, T rhs, T& result) noexcept -> bool {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_sub_overflow(lhs, rhs, &result);
+#else
+  return sub_overflow_bitwise(lhs, rhs, result);
+#endif
+}
+
+/// \brief Calculate `lhs * rhs`, wrapping on overflow.
+/// \return True if the operation overflowed, false otherwise.
+template <overflow_integral T>
+constexpr auto mul_overflow(T lhs, T rhs, T& result) noexcept -> bool {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(lhs, rhs, &result);
+#else
+  using unsigned_type = std::make_unsigned_t<std::common_type_t<T, unsigned int>>;
+  result = static_cast<T>(static_cast<unsigned_type>(lhs) * static_cast<unsigned_type>(rhs));
+  if (lhs == 0 || rhs == 0) {
+    return false;
+  }
+  if constexpr (std::is_signed_v<T>) {
+    if ((lhs == -1 && rhs == std::numeric_limits<T>::min()) || (rhs == -1 && lhs == std::numeric_limits<T>::min())) {
+      return true;
+    }
+  }
+  return result / rhs != lhs;
+#endif
+}
+
+/// \brief Calculate `lhs / rhs`, wrapping on overflow.
+/// \return True if the operation overflowed, false otherwise.
+/// \pre `rhs != 0`
+template <overflow_integral T>
+constexpr auto div_overflow(T lhs, T rhs, T& result) noexcept -> bool {
+  if constexpr (std::is_signed_v<T>) {
+    if (lhs == std::numeric_limits<T>::min() && rhs == -1) {
+      result = lhs;
+      return true;
+    }
+  }
+  result = static_cast<T>(lhs / rhs);
+  return false;
+}
+
+/// \brief The operations covered by the arithmetic policies.
+enum class arithmetic_operation { add, subtract, multiply, divide };
+
+/// \brief Return the name of an arithmetic operation.
+constexpr auto operation_name(arithmetic_operation operation) noexcept -> const char* {
+  switch (operation) {
+    case arithmetic_operation::add:
+      return "add";
+    case arithmetic_operation::subtract:
+      return "subtract";
+    case arithmetic_operation::multiply:
+      return "multiply";
+    case arithmetic_operation::divide:
+      return "divide";
+  }
+  return "";
+}
+
+/// \brief Whether the raw operation on `T` does not throw.
+/// \details Only the operation itself is checked, so that e.g. `std::string`, which has no `-`, can still be added.
+template <arithmetic_operation Operation, typename T>
+consteval auto nothrow_raw_operation() noexcept -> bool {
+  if constexpr (Operation == arithmetic_operation::add) {
+    return noexcept(std::declval<const T&>() + std::declval<const T&>());
+  } else if constexpr (Operation == arithmetic_operation::subtract) {
+    return noexcept(std::declval<const T&>() - std::declval<const T&>());
+  } else if constexpr (Operation == arithmetic_operation::multiply) {
+    return noexcept(std::declval<const T&>() * std::declval<const T&>());
+  } else {
+    return noexcept(std::declval<const T&>() / std::declval<const T&>());
+  }
+}
+
+/// \brief Perform the raw operation.
+template <arithmetic_operation Operation, typename T>
+GW_FORWARDING constexpr auto raw_operation(const T& lhs, const T& rhs) noexcept(
+    nothrow_raw_operation<Operation, T>()) {
+  if constexpr (Operation == arithmetic_operation::add) {
+    return lhs + rhs;
+  } else if constexpr (Operation == arithmetic_operation::subtract) {
+    return lhs - rhs;
+  } else if constexpr (Operation == arithmetic_operation::multiply) {
+    return lhs * rhs;
+  } else {
+    return lhs / rhs;
+  }
+}
+
+/// \brief Perform the operation, wrapping on overflow.
+/// \return True if the operation overflowed, false otherwise.
+template <arithmetic_operation Operation, overflow_integral T>
+constexpr auto overflow_operation(T lhs, T rhs, T& result) noexcept -> bool {
+  if constexpr (Operation == arithmetic_operation::add) {
+    return add_overflow(lhs, rhs, result);
+  } else if constexpr (Operation == arithmetic_operation::subtract) {
+    return sub_overflow(lhs, rhs, result);
+  } else if constexpr (Operation == arithmetic_operation::multiply) {
+    return mul_overflow(lhs, rhs, result);
+  } else {
+    return div_overflow(lhs, rhs, result);
+  }
+}
+
+/// \brief Return the value an overflowing operation saturates to.
+/// \details The value is computed with integer arithmetic from the sign of the exact result instead of a branch:
+/// sums and differences overflow towards the sign of `lhs`, products and quotients towards the product of the signs.
+template <arithmetic_operation Operation, overflow_integral T>
+constexpr auto saturation_value(T lhs, T rhs) noexcept -> T {
+  if constexpr (std::is_signed_v<T>) {
+    using unsigned_type = std::make_unsigned_t<T>;
+    const auto negative = (Operation == arithmetic_operation::add || Operation == arithmetic_operation::subtract)
+                              ? lhs < T{}
+                              : (lhs < T{}) != (rhs < T{});
+    return static_cast<T>(static_cast<unsigned_type>(std::numeric_limits<T>::max()) +
+                          static_cast<unsigned_type>(negative));
+  } else {
+    return Operation == arithmetic_operation::subtract ? T{} : std::numeric_limits<T>::max();
+  }
+}
+
+}  // namespace detail
+
+//
+// Arithmetic policies
+//
+
+/// \brief Arithmetic policy that performs the raw operations of the contained type.
+struct unchecked_arithmetic {
+  /// \brief Perform the operation.
+  template <detail::arithmetic_operation Operation, typename T>
+  GW_FORWARDING static constexpr auto apply(const T& lhs, const T& rhs) noexcept(
+      noexcept(detail::raw_operation<Operation>(lhs, rhs))) {
+    return detail::raw_operation<Operation>(lhs, rhs);
+  }
+};
+
+/// \brief Arithmetic policy that throws `std::overflow_error` if an integer operation overflows.
+struct checked_arithmetic {
+  /// \brief Perform the operation.
+  /// \throw std::overflow_error If the operation overflows.
+  template <detail::arithmetic_operation Operation, typename T>
+  static constexpr auto apply(const T& lhs, const T& rhs) -> T {
+    if constexpr (detail::overflow_integral<T>) {
+      auto result = T{};
+      if (detail::overflow_operation<Operation>(lhs, rhs, result)) {
+        detail::throw_error<std::overflow_error>(
+            std::format("checked_arithmetic: {} of {} and {} overflows", detail::operation_name(Operation), lhs, rhs));
+      }
+      return result;
+    } else {
+      return detail::raw_operation<Operation>(lhs, rhs);
+    }
+  }
+};
+
+/// \brief Arithmetic policy that clamps the result of an overflowing integer operation to the representable range.
+/// \details The overflow is detected with the compiler's overflow builtins and the saturated value is selected without
+/// a branch, so the operations vectorize in batch loops.
+struct saturating_arithmetic {
+  /// \brief Perform the operation, saturating on overflow.
+  template <detail::arithmetic_operation Operation, typename T>
+  static constexpr auto apply(const T& lhs, const T& rhs) noexcept(
+      noexcept(detail::raw_operation<Operation>(lhs, rhs))) -> T {
+    if constexpr (detail::overflow_integral<T>) {
+      auto result = T{};
+      const auto overflow = detail::overflow_operation<Operation>(lhs, rhs, result);
+      return overflow ? detail::saturation_value<Operation>(lhs, rhs) : result;
+    } else {
+      return detail::raw_operation<Operation>(lhs, rhs);
+    }
+  }
+};
+
+/// \brief Arithmetic policy that wraps the result of an overflowing integer operation modulo 2^N.
+/// \details Unlike the raw operations on signed integers, wrapping is well-defined.
+struct wrapping_arithmetic {
+  /// \brief Perform the operation, wrapping on overflow.
+  template <detail::arithmetic_operation Operation, typename T>
+  static constexpr auto apply(const T& lhs, const T& rhs) noexcept(
+      noexcept(detail::raw_operation<Operation>(lhs, rhs))) -> T {
+    if constexpr (detail::overflow_integral<T>) {
+      auto result = T{};
+      detail::overflow_operation<Operation>(lhs, rhs, result);
+      return result;
+    } else {
+      return detail::raw_operation<Operation>(lhs, rhs);
+    }
+  }
+};
+
+#if defined(__cpp_lib_expected)
+
+/// \brief Arithmetic policy that returns `std::unexpected{std::errc::result_out_of_range}` if an integer operation
+/// overflows.
+struct expected_arithmetic {
+  /// \brief Perform the operation.
+  template <detail::arithmetic_operation Operation, typename T>
+  static constexpr auto apply(const T& lhs, const T& rhs) noexcept(
+      noexcept(detail::raw_operation<Operation>(lhs, rhs))) -> std::expected<T, std::errc> {
+    if constexpr (detail::overflow_integral<T>) {
+      auto result = T{};
+      if (detail::overflow_operation<Operation>(lhs, rhs, result)) {
+        return std::unexpected{std::errc::result_out_of_range};
+      }
+      return result;
+    } else {
+      return detail::raw_operation<Operation>(lhs, rhs);
+    }
+  }
+};
+
+#endif  // defined(__cpp_lib_expected)
+
+/// \brief Concept for arithmetic policies.
+template <typename Policy>
+concept arithmetic_policy = requires(int value) {
+  Policy::template apply<detail::arithmetic_operation::add>(value, value);
+  Policy::template apply<detail::arithmetic_operation::subtract>(value, value);
+  Policy::template apply<detail::arithmetic_operation::multiply>(value, value);
+  Policy::template apply<detail::arithmetic_operation::divide>(value, value);
+};
+
+namespace detail {
+
+/// \brief Whether the policy reports overflow instead of producing a value.
+template <typename Policy>
+inline constexpr bool k_reports_overflow = std::same_as<Policy, checked_arithmetic>;
+
+/// \brief The type of the result of an operation of type `R` under the policy.
+template <typename Policy, typename R>
+struct arithmetic_result {
+  using type = R;
+};
+
+/// \brief The type of the result of a batch operation under the policy.
+template <typename Policy>
+struct batch_result {
+  using type = void;
+};
+
+#if defined(__cpp_lib_expected)
+
+template <>
+inline constexpr bool k_reports_overflow<expected_arithmetic> = true;
+
+template <typename R>
+struct arithmetic_result<expected_arithmetic, R> {
+  using type = std::expected<R, std::errc>;
+};
+
+template <>
+struct batch_result<expected_arithmetic> {
+  using type = std::expected<void, std::errc>;
+};
+
+#endif  // defined(__cpp_lib_expected)
+
+template <typename Policy, typename R>
+using arithmetic_result_t = typename arithmetic_result<Policy, R>::type;
+
+template <typename Policy>
+using batch_result_t = typename batch_result<Policy>::type;
+
+/// \brief Perform the operation under the policy and wrap the result in `R`.
+template <typename Policy, arithmetic_operation Operation, typename R, typename T>
+GW_FORWARDING constexpr auto apply_arithmetic(const T& lhs, const T& rhs) noexcept(
+    noexcept(Policy::template apply<Operation>(lhs, rhs))) -> arithmetic_result_t<Policy, R> {
+#if defined(__cpp_lib_expected)
+  if constexpr (std::same_as<Policy, expected_arithmetic>) {
+    auto result = Policy::template apply<Operation>(lhs, rhs);
+    if (!result) {
+      return std::unexpected{result.error()};
+    }
+    return R{*result};
+  } else {
+    return R{Policy::template apply<Operation>(lhs, rhs)};
+  }
+#else
+  return R{Policy::template apply<Operation>(lhs, rhs)};
+#endif  // defined(__cpp_lib_expected)
+}
+
+/// \brief The arithmetic policy declared by the tag, or gw::unchecked_arithmetic if there is none.
+template <typename Tag>
+struct tag_arithmetic_policy {
+  using type = unchecked_arithmetic;
+};
+
+template <typename Tag>
+  requires requires { typename Tag::arithmetic_policy; }
+struct tag_arithmetic_policy<Tag> {
+  static_assert(arithmetic_policy<typename Tag::arithmetic_policy>, "gw: Tag::arithmetic_policy is not a policy");
+  using type = typename Tag::arithmetic_policy;
+};
+
+template <typename Tag>
+using tag_arithmetic_policy_t = typename tag_arithmetic_policy<Tag>::type;
+
+/// \brief Apply the operation element-wise to `lhs` and `rhs`, storing the results in `lhs`.
+/// \details Sums and differences detect overflow with plain integer operations instead of the overflow builtins, and
+/// policies that report overflow accumulate an overflow flag over the whole range and report it once after the loop.
+/// The loop body has neither branches nor an early exit, so it vectorizes.
+template <typename Policy, arithmetic_operation Operation, typename T, std::size_t Extent>
+constexpr auto batch_apply(std::span<T, Extent> lhs, std::span<const T> rhs) -> batch_result_t<Policy> {
+  if (lhs.size() != rhs.size()) {
+    detail::throw_error<std::invalid_argument>(
+        std::format("gw::batch_{}: size mismatch ({} != {})", operation_name(Operation), lhs.size(), rhs.size()));
+  }
+
+  if constexpr (overflow_integral<T> && !std::same_as<Policy, unchecked_arithmetic>) {
+    auto overflow = 0U;
+    for (std::size_t index = 0U; index < lhs.size(); ++index) {
+      const auto left = lhs[index];
+      const auto right = rhs[index];
+      auto result = T{};
+      auto element_overflow = false;
+      if constexpr (Operation == arithmetic_operation::add) {
+        element_overflow = add_overflow_bitwise(left, right, result);
+      } else if constexpr (Operation == arithmetic_operation::subtract) {
+        element_overflow = sub_overflow_bitwise(left, right, result);
+      } else {
+        element_overflow = overflow_operation<Operation>(left, right, result);
+      }
+      if constexpr (std::same_as<Policy, saturating_arithmetic>) {
+        result = element_overflow ? saturation_value<Operation>(left, right) : result;
+      }
+      lhs[index] = result;
+      overflow |= static_cast<unsigned int>(element_overflow);
+    }
+
+    if constexpr (std::same_as<Policy, checked_arithmetic>) {
+      if (overflow != 0U) {
+        detail::throw_error<std::overflow_error>(
+            std::format("checked_arithmetic: batch {} overflows", operation_name(Operation)));
+      }
+    }
+#if defined(__cpp_lib_expected)
+    if constexpr (std::same_as<Policy, expected_arithmetic>) {
+      if (overflow != 0U) {
+        return std::unexpected{std::errc::result_out_of_range};
+      }
+      return {};
+    }
+#endif  // defined(__cpp_lib_expected)
+  } else {
+    for (std::size_t index = 0U; index < lhs.size(); ++index) {
+      lhs[index] = raw_operation<Operation>(lhs[index], rhs[index]);
+    }
+#if defined(__cpp_lib_expected)
+    if constexpr (std::same_as<Policy, expected_arithmetic>) {
+      return {};
+    }
+#endif  // defined(__cpp_lib_expected)
+  }
+}
+
+}  // namespace detail
+
+//
+// Batch operations
+//
+
+/// \brief Add `rhs` to `lhs` element-wise under the arithmetic policy.
+/// \throw std::invalid_argument If the sizes of `lhs` and `rhs` differ.
+/// \throw std::overflow_error If any element overflows under gw::checked_arithmetic. All elements are still computed.
+/// \return `std::unexpected{std::errc::result_out_of_range}` if any element overflows under gw::expected_arithmetic.
+template <arithmetic_policy Policy, typename T, std::size_t Extent>
+constexpr auto batch_add(std::span<T, Extent> lhs, std::span<const std::type_identity_t<T>> rhs)
+    -> detail::batch_result_t<Policy> {
+  return detail::batch_apply<Policy, detail::arithmetic_operation::add>(lhs, rhs);
+}
+
+/// \brief Subtract `rhs` from `lhs` element-wise under the arithmetic policy.
+/// \throw std::invalid_argument If the sizes of `lhs` and `rhs` differ.
+/// \throw std::overflow_error If any element overflows under gw::checked_arithmetic. All elements are still computed.
+/// \return `std::unexpected{std::errc::result_out_of_range}` if any element overflows under gw::expected_arithmetic.
+template <arithmetic_policy Policy, typename T, std::size_t Extent>
+constexpr auto batch_subtract(std::span<T, Extent> lhs, std::span<const std::type_identity_t<T>> rhs)
+    -> detail::batch_result_t<Policy> {
+  return detail::batch_apply<Policy, detail::arithmetic_operation::subtract>(lhs, rhs);
+}
+
+/// \brief Multiply `lhs` by `rhs` element-wise under the arithmetic policy.
+/// \throw std::invalid_argument If the sizes of `lhs` and `rhs` differ.
+/// \throw std::overflow_error If any element overflows under gw::checked_arithmetic. All elements are still computed.
+/// \return `std::unexpected{std::errc::result_out_of_range}` if any element overflows under gw::expected_arithmetic.
+template <arithmetic_policy Policy, typename T, std::size_t Extent>
+constexpr auto batch_multiply(std::span<T, Extent> lhs, std::span<const std::type_identity_t<T>> rhs)
+    -> detail::batch_result_t<Policy> {
+  return detail::batch_apply<Policy, detail::arithmetic_operation::multiply>(lhs, rhs);
+}
+
+/// \brief Divide `lhs` by `rhs` element-wise under the arithmetic policy.
+/// \throw std::invalid_argument If the sizes of `lhs` and `rhs` differ.
+/// \throw std::overflow_error If any element overflows under gw::checked_arithmetic. All elements are still computed.
+/// \return `std::unexpected{std::errc::result_out_of_range}` if any element overflows under gw::expected_arithmetic.
+/// \pre No element of `rhs` is zero.
+template <arithmetic_policy Policy, typename T, std::size_t Extent>
+constexpr auto batch_divide(std::span<T, Extent> lhs, std::span<const std::type_identity_t<T>> rhs)
+    -> detail::batch_result_t<Policy> {
+  return detail::batch_apply<Policy, detail::arithmetic_operation::divide>(lhs, rhs);
+}
+
+}  // namespace gw
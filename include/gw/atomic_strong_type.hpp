@@ -0,0 +1,516 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "gw/arithmetic.hpp"
+#include "gw/strong_type.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+//
+// Cache line isolation
+//
+
+#if defined(__cpp_lib_hardware_interference_size)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+/// \brief The minimum offset between two objects to avoid false sharing.
+inline constexpr std::size_t k_cache_line_size = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+/// \brief The minimum offset between two objects to avoid false sharing.
+inline constexpr std::size_t k_cache_line_size = 64U;
+#endif  // defined(__cpp_lib_hardware_interference_size)
+
+/// \brief The padding of a gw::atomic_strong_type.
+enum class atomic_padding {
+  none,        ///< The object has the size and alignment of `std::atomic<T>`.
+  cache_line,  ///< The object occupies whole cache lines, so that neighbouring objects never share a cache line.
+};
+
+namespace detail {
+
+/// \brief Concept for the types that `std::atomic` provides `fetch_add` and `fetch_sub` for.
+template <typename T>
+concept atomic_arithmetic = (std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T>;
+
+/// \brief Concept for the types that `std::atomic` provides `fetch_and`, `fetch_or` and `fetch_xor` for.
+template <typename T>
+concept atomic_bitwise = std::integral<T> && !std::same_as<T, bool>;
+
+/// \brief Whether the arithmetic policy of `Tag` is what the hardware read-modify-write operations implement.
+/// \details `std::atomic` defines `fetch_add` and `fetch_sub` to wrap on overflow, also for signed integers.
+template <typename Tag>
+inline constexpr bool k_native_atomic_arithmetic =
+    std::same_as<tag_arithmetic_policy_t<Tag>, unchecked_arithmetic> ||
+    std::same_as<tag_arithmetic_policy_t<Tag>, wrapping_arithmetic>;
+
+/// \brief Concept for the tags whose arithmetic policy produces a value for every operation.
+template <typename T, typename Tag>
+concept atomic_policy = std::same_as<typename strong_type<T, Tag>::arithmetic_result_type, strong_type<T, Tag>>;
+
+/// \brief Whether the arithmetic policy of `Tag` never throws for `T`.
+template <typename T, typename Tag>
+inline constexpr bool k_nothrow_atomic_arithmetic = noexcept(
+    tag_arithmetic_policy_t<Tag>::template apply<arithmetic_operation::add>(std::declval<T>(), std::declval<T>()));
+
+/// \brief Atomically replace the value of `atomic` with `value op operand` under the arithmetic policy of `Tag`.
+/// \details Policies that the hardware does not implement, such as saturation, are applied in a compare-and-exchange
+/// loop.
+/// \return The value before the operation.
+template <typename Tag, arithmetic_operation Operation, typename Atomic, typename T>
+auto atomic_fetch_apply(Atomic& atomic, T operand, std::memory_order order) -> T {
+  if constexpr (k_native_atomic_arithmetic<Tag> && Operation == arithmetic_operation::add) {
+    return atomic.fetch_add(operand, order);
+  } else if constexpr (k_native_atomic_arithmetic<Tag> && Operation == arithmetic_operation::subtract) {
+    return atomic.fetch_sub(operand, order);
+  } else {
+    using policy = tag_arithmetic_policy_t<Tag>;
+    auto expected = atomic.load(std::memory_order_relaxed);
+    while (!atomic.compare_exchange_weak(expected, policy::template apply<Operation>(expected, operand), order,
+                                         std::memory_order_relaxed)) {
+    }
+    return expected;
+  }
+}
+
+/// \brief Atomically replace the value of `atomic` with `value op operand` under the arithmetic policy of `Tag`.
+/// \details The result of the hardware operations is recomputed with gw::wrapping_arithmetic, which wraps like they do,
+/// without the undefined behaviour of a signed overflow. The other policies return the value stored by the loop.
+/// \return The value after the operation.
+template <typename Tag, arithmetic_operation Operation, typename Atomic, typename T>
+auto atomic_apply_fetch(Atomic& atomic, T operand, std::memory_order order = std::memory_order_seq_cst) -> T {
+  if constexpr (k_native_atomic_arithmetic<Tag>) {
+    return wrapping_arithmetic::apply<Operation>(atomic_fetch_apply<Tag, Operation>(atomic, operand, order), operand);
+  } else {
+    using policy = tag_arithmetic_policy_t<Tag>;
+    auto expected = atomic.load(std::memory_order_relaxed);
+    auto desired = policy::template apply<Operation>(expected, operand);
+    while (!atomic.compare_exchange_weak(expected, desired, order, std::memory_order_relaxed)) {
+      desired = policy::template apply<Operation>(expected, operand);
+    }
+    return desired;
+  }
+}
+
+}  // namespace detail
+
+/// \example atomic_strong_type_example.cpp
+//
+/// \brief An atomic gw::strong_type.
+//
+/// \details The class template `gw::atomic_strong_type` wraps a `std::atomic<T>` and takes and returns
+/// `gw::strong_type<T, Tag>` in every operation, so that atomics keep the type safety of the tag. Read-modify-write
+/// operations follow the arithmetic policy of the tag: unchecked and wrapping tags use the hardware `fetch_add` and
+/// `fetch_sub`, other policies, such as saturation, are applied in a compare-and-exchange loop. With
+/// `gw::atomic_padding::cache_line` every object occupies whole cache lines, which avoids false sharing in arrays of
+/// counters that are updated by different threads.
+/// \tparam T The type of the contained value.
+/// \tparam Tag The tag type.
+/// \tparam Padding The padding of the object.
+template <typename T, typename Tag, atomic_padding Padding = atomic_padding::none>
+class atomic_strong_type {
+ public:
+  //
+  // Public types
+  //
+
+  using value_type = strong_type<T, Tag>;  ///< The type of the contained value.
+  using underlying_type = T;               ///< The type of the underlying atomic value.
+  using tag_type = Tag;                    ///< The tag type.
+
+  //
+  // Public constants
+  //
+
+  /// \brief Whether the object is always lock-free.
+  static constexpr bool is_always_lock_free = std::atomic<T>::is_always_lock_free;
+
+  /// \brief The padding of the object.
+  static constexpr atomic_padding padding = Padding;
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct the object with a value-initialized value.
+  constexpr atomic_strong_type() noexcept(std::is_nothrow_default_constructible_v<T>) = default;
+
+  /// \brief Construct the object with `desired`.
+  /// \param desired The value to initialize the object with.
+  constexpr explicit atomic_strong_type(value_type desired) noexcept : m_value(desired.value()) {}
+
+  atomic_strong_type(const atomic_strong_type&) = delete;
+  auto operator=(const atomic_strong_type&) -> atomic_strong_type& = delete;
+  auto operator=(const atomic_strong_type&) volatile -> atomic_strong_type& = delete;
+
+  //
+  // Destructor
+  //
+
+  /// \brief Destroy the object.
+  ~atomic_strong_type() = default;
+
+  //
+  // Operations
+  //
+
+  /// \brief Whether the operations on the object are lock-free.
+  [[nodiscard]] auto is_lock_free() const noexcept -> bool { return m_value.is_lock_free(); }
+
+  /// \brief Atomically replace the value with `desired`.
+  void store(value_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept {
+    m_value.store(desired.value(), order);
+  }
+
+  /// \brief Atomically replace the value with `desired`.
+  auto operator=(value_type desired) noexcept -> value_type {
+    store(desired);
+    return desired;
+  }
+
+  /// \brief Atomically load the value.
+  [[nodiscard]] auto load(std::memory_order order = std::memory_order_seq_cst) const noexcept -> value_type {
+    return value_type{m_value.load(order)};
+  }
+
+  /// \brief Atomically load the value.
+  explicit(false) operator value_type() const noexcept { return load(); }  // NOLINT(google-explicit-constructor)
+
+  /// \brief Atomically replace the value with `desired`.
+  /// \return The value before the operation.
+  auto exchange(value_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept -> value_type {
+    return value_type{m_value.exchange(desired.value(), order)};
+  }
+
+  /// \brief Atomically replace the value with `desired` if it equals `expected`, otherwise load it into `expected`.
+  /// \details The operation may fail spuriously.
+  /// \return True if the value was replaced, false otherwise.
+  auto compare_exchange_weak(value_type& expected, value_type desired, std::memory_order success,
+                             std::memory_order failure) noexcept -> bool {
+    return m_value.compare_exchange_weak(*expected, desired.value(), success, failure);
+  }
+
+  /// \brief Atomically replace the value with `desired` if it equals `expected`, otherwise load it into `expected`.
+  /// \details The operation may fail spuriously.
+  /// \return True if the value was replaced, false otherwise.
+  auto compare_exchange_weak(value_type& expected, value_type desired,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept -> bool {
+    return m_value.compare_exchange_weak(*expected, desired.value(), order);
+  }
+
+  /// \brief Atomically replace the value with `desired` if it equals `expected`, otherwise load it into `expected`.
+  /// \return True if the value was replaced, false otherwise.
+  auto compare_exchange_strong(value_type& expected, value_type desired, std::memory_order success,
+                               std::memory_order failure) noexcept -> bool {
+    return m_value.compare_exchange_strong(*expected, desired.value(), success, failure);
+  }
+
+  /// \brief Atomically replace the value with `desired` if it equals `expected`, otherwise load it into `expected`.
+  /// \return True if the value was replaced, false otherwise.
+  auto compare_exchange_strong(value_type& expected, value_type desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept -> bool {
+    return m_value.compare_exchange_strong(*expected, desired.value(), order);
+  }
+
+  /// \brief Block until the value is no longer equal to `old` and the object is notified.
+  void wait(value_type old, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    m_value.wait(old.value(), order);
+  }
+
+  /// \brief Unblock at least one thread waiting on the object.
+  void notify_one() noexcept { m_value.notify_one(); }
+
+  /// \brief Unblock all threads waiting on the object.
+  void notify_all() noexcept { m_value.notify_all(); }
+
+  //
+  // Arithmetic operations
+  //
+
+  /// \brief Atomically add `arg` to the value under the arithmetic policy of the tag.
+  /// \return The value before the operation.
+  auto fetch_add(value_type arg, std::memory_order order = std::memory_order_seq_cst)
+      noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> value_type
+    requires detail::atomic_arithmetic<T> && detail::atomic_policy<T, Tag>
+  {
+    return value_type{detail::atomic_fetch_apply<Tag, detail::arithmetic_operation::add>(m_value, *arg, order)};
+  }
+
+  /// \brief Atomically subtract `arg` from the value under the arithmetic policy of the tag.
+  /// \return The value before the operation.
+  auto fetch_sub(value_type arg, std::memory_order order = std::memory_order_seq_cst)
+      noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> value_type
+    requires detail::atomic_arithmetic<T> && detail::atomic_policy<T, Tag>
+  {
+    return value_type{detail::atomic_fetch_apply<Tag, detail::arithmetic_operation::subtract>(m_value, *arg, order)};
+  }
+
+  /// \brief Atomically add `arg` to the value under the arithmetic policy of the tag.
+  /// \return The value after the operation.
+  auto operator+=(value_type arg) noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> value_type
+    requires detail::atomic_arithmetic<T> && detail::atomic_policy<T, Tag>
+  {
+    return value_type{detail::atomic_apply_fetch<Tag, detail::arithmetic_operation::add>(m_value, *arg)};
+  }
+
+  /// \brief Atomically subtract `arg` from the value under the arithmetic policy of the tag.
+  /// \return The value after the operation.
+  auto operator-=(value_type arg) noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> value_type
+    requires detail::atomic_arithmetic<T> && detail::atomic_policy<T, Tag>
+  {
+    return value_type{detail::atomic_apply_fetch<Tag, detail::arithmetic_operation::subtract>(m_value, *arg)};
+  }
+
+  //
+  // Bitwise operations
+  //
+
+  /// \brief Atomically replace the value with the bitwise AND of the value and `arg`.
+  /// \return The value before the operation.
+  auto fetch_and(value_type arg, std::memory_order order = std::memory_order_seq_cst) noexcept -> value_type
+    requires detail::atomic_bitwise<T>
+  {
+    return value_type{m_value.fetch_and(*arg, order)};
+  }
+
+  /// \brief Atomically replace the value with the bitwise OR of the value and `arg`.
+  /// \return The value before the operation.
+  auto fetch_or(value_type arg, std::memory_order order = std::memory_order_seq_cst) noexcept -> value_type
+    requires detail::atomic_bitwise<T>
+  {
+    return value_type{m_value.fetch_or(*arg, order)};
+  }
+
+  /// \brief Atomically replace the value with the bitwise XOR of the value and `arg`.
+  /// \return The value before the operation.
+  auto fetch_xor(value_type arg, std::memory_order order = std::memory_order_seq_cst) noexcept -> value_type
+    requires detail::atomic_bitwise<T>
+  {
+    return value_type{m_value.fetch_xor(*arg, order)};
+  }
+
+ private:
+  static constexpr std::size_t k_alignment =
+      Padding == atomic_padding::cache_line ? k_cache_line_size : alignof(std::atomic<T>);
+
+  alignas(k_alignment) std::atomic<T> m_value{};
+};
+
+/// \brief An atomic gw::strong_type that occupies whole cache lines.
+template <typename T, typename Tag>
+using padded_atomic_strong_type = atomic_strong_type<T, Tag, atomic_padding::cache_line>;
+
+/// \brief Atomic operations on the value of an existing gw::strong_type object.
+//
+/// \details The class template `gw::atomic_strong_type_ref` wraps a `std::atomic_ref<T>` over the value of a
+/// `gw::strong_type<T, Tag>` and provides the operations of gw::atomic_strong_type. While any
+/// `gw::atomic_strong_type_ref` to an object exists, the object must only be accessed through them.
+/// \tparam T The type of the contained value.
+/// \tparam Tag The tag type.
+template <typename T, typename Tag>
+class atomic_strong_type_ref {
+ public:
+  //
+  // Public types
+  //
+
+  using value_type = strong_type<T, Tag>;  ///< The type of the referenced value.
+  using underlying_type = T;               ///< The type of the underlying atomic value.
+  using tag_type = Tag;                    ///< The tag type.
+
+  //
+  // Public constants
+  //
+
+  /// \brief Whether the operations are always lock-free.
+  static constexpr bool is_always_lock_free = std::atomic_ref<T>::is_always_lock_free;
+
+  /// \brief The alignment that referenced objects must have.
+  static constexpr std::size_t required_alignment = std::atomic_ref<T>::required_alignment;
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct the reference to `object`.
+  /// \param object The object to reference.
+  /// \pre `object` is aligned to `required_alignment`.
+  explicit atomic_strong_type_ref(value_type& object) noexcept : m_ref(*object) {}
+
+  /// \brief Construct the reference to the object referenced by `other`.
+  atomic_strong_type_ref(const atomic_strong_type_ref& other) noexcept = default;
+
+  auto operator=(const atomic_strong_type_ref&) -> atomic_strong_type_ref& = delete;
+
+  //
+  // Destructor
+  //
+
+  /// \brief Destroy the reference.
+  ~atomic_strong_type_ref() = default;
+
+  //
+  // Operations
+  //
+
+  /// \brief Whether the operations on the referenced object are lock-free.
+  [[nodiscard]] auto is_lock_free() const noexcept -> bool { return m_ref.is_lock_free(); }
+
+  /// \brief Atomically replace the referenced value with `desired`.
+  void store(value_type desired, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    m_ref.store(desired.value(), order);
+  }
+
+  /// \brief Atomically replace the referenced value with `desired`.
+  auto operator=(value_type desired) const noexcept -> value_type {  // NOLINT(misc-unconventional-assign-operator)
+    store(desired);
+    return desired;
+  }
+
+  /// \brief Atomically load the referenced value.
+  [[nodiscard]] auto load(std::memory_order order = std::memory_order_seq_cst) const noexcept -> value_type {
+    return value_type{m_ref.load(order)};
+  }
+
+  /// \brief Atomically load the referenced value.
+  explicit(false) operator value_type() const noexcept { return load(); }  // NOLINT(google-explicit-constructor)
+
+  /// \brief Atomically replace the referenced value with `desired`.
+  /// \return The value before the operation.
+  auto exchange(value_type desired, std::memory_order order = std::memory_order_seq_cst) const noexcept -> value_type {
+    return value_type{m_ref.exchange(desired.value(), order)};
+  }
+
+  /// \brief Atomically replace the referenced value with `desired` if it equals `expected`, otherwise load it into
+  /// `expected`.
+  /// \details The operation may fail spuriously.
+  /// \return True if the value was replaced, false otherwise.
+  auto compare_exchange_weak(value_type& expected, value_type desired, std::memory_order success,
+                             std::memory_order failure) const noexcept -> bool {
+    return m_ref.compare_exchange_weak(*expected, desired.value(), success, failure);
+  }
+
+  /// \brief Atomically replace the referenced value with `desired` if it equals `expected`, otherwise load it into
+  /// `expected`.
+  /// \details The operation may fail spuriously.
+  /// \return True if the value was replaced, false otherwise.
+  auto compare_exchange_weak(value_type& expected, value_type desired,
+                             std::memory_order order = std::memory_order_seq_cst) const noexcept -> bool {
+    return m_ref.compare_exchange_weak(*expected, desired.value(), order);
+  }
+
+  /// \brief Atomically replace the referenced value with `desired` if it equals `expected`, otherwise load it into
+  /// `expected`.
+  /// \return True if the value was replaced, false otherwise.
+  auto compare_exchange_strong(value_type& expected, value_type desired, std::memory_order success,
+                               std::memory_order failure) const noexcept -> bool {
+    return m_ref.compare_exchange_strong(*expected, desired.value(), success, failure);
+  }
+
+  /// \brief Atomically replace the referenced value with `desired` if it equals `expected`, otherwise load it into
+  /// `expected`.
+  /// \return True if the value was replaced, false otherwise.
+  auto compare_exchange_strong(value_type& expected, value_type desired,
+                               std::memory_order order = std::memory_order_seq_cst) const noexcept -> bool {
+    return m_ref.compare_exchange_strong(*expected, desired.value(), order);
+  }
+
+  /// \brief Block until the referenced value is no longer equal to `old` and the object is notified.
+  void wait(value_type old, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    m_ref.wait(old.value(), order);
+  }
+
+  /// \brief Unblock at least one thread waiting on the referenced object.
+  void notify_one() const noexcept { m_ref.notify_one(); }
+
+  /// \brief Unblock all threads waiting on the referenced object.
+  void notify_all() const noexcept { m_ref.notify_all(); }
+
+  //
+  // Arithmetic operations
+  //
+
+  /// \brief Atomically add `arg` to the referenced value under the arithmetic policy of the tag.
+  /// \return The value before the operation.
+  auto fetch_add(value_type arg, std::memory_order order = std::memory_order_seq_cst) const
+      noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> value_type
+    requires detail::atomic_arithmetic<T> && detail::atomic_policy<T, Tag>
+  {
+    return value_type{detail::atomic_fetch_apply<Tag, detail::arithmetic_operation::add>(m_ref, *arg, order)};
+  }
+
+  /// \brief Atomically subtract `arg` from the referenced value under the arithmetic policy of the tag.
+  /// \return The value before the operation.
+  auto fetch_sub(value_type arg, std::memory_order order = std::memory_order_seq_cst) const
+      noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> value_type
+    requires detail::atomic_arithmetic<T> && detail::atomic_policy<T, Tag>
+  {
+    return value_type{detail::atomic_fetch_apply<Tag, detail::arithmetic_operation::subtract>(m_ref, *arg, order)};
+  }
+
+  /// \brief Atomically add `arg` to the referenced value under the arithmetic policy of the tag.
+  /// \return The value after the operation.
+  auto operator+=(value_type arg) const noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> value_type
+    requires detail::atomic_arithmetic<T> && detail::atomic_policy<T, Tag>
+  {
+    return value_type{detail::atomic_apply_fetch<Tag, detail::arithmetic_operation::add>(m_ref, *arg)};
+  }
+
+  /// \brief Atomically subtract `arg` from the referenced value under the arithmetic policy of the tag.
+  /// \return The value after the operation.
+  auto operator-=(value_type arg) const noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> value_type
+    requires detail::atomic_arithmetic<T> && detail::atomic_policy<T, Tag>
+  {
+    return value_type{detail::atomic_apply_fetch<Tag, detail::arithmetic_operation::subtract>(m_ref, *arg)};
+  }
+
+  //
+  // Bitwise operations
+  //
+
+  /// \brief Atomically replace the referenced value with the bitwise AND of the value and `arg`.
+  /// \return The value before the operation.
+  auto fetch_and(value_type arg, std::memory_order order = std::memory_order_seq_cst) const noexcept -> value_type
+    requires detail::atomic_bitwise<T>
+  {
+    return value_type{m_ref.fetch_and(*arg, order)};
+  }
+
+  /// \brief Atomically replace the referenced value with the bitwise OR of the value and `arg`.
+  /// \return The value before the operation.
+  auto fetch_or(value_type arg, std::memory_order order = std::memory_order_seq_cst) const noexcept -> value_type
+    requires detail::atomic_bitwise<T>
+  {
+    return value_type{m_ref.fetch_or(*arg, order)};
+  }
+
+  /// \brief Atomically replace the referenced value with the bitwise XOR of the value and `arg`.
+  /// \return The value before the operation.
+  auto fetch_xor(value_type arg, std::memory_order order = std::memory_order_seq_cst) const noexcept -> value_type
+    requires detail::atomic_bitwise<T>
+  {
+    return value_type{m_ref.fetch_xor(*arg, order)};
+  }
+
+ private:
+  std::atomic_ref<T> m_ref;
+};
+
+template <typename T, typename Tag>
+atomic_strong_type_ref(strong_type<T, Tag>&) -> atomic_strong_type_ref<T, Tag>;
+
+}  // namespace gw
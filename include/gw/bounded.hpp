@@ -0,0 +1,365 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "gw/arithmetic.hpp"
+#include "gw/error.hpp"
+#include "gw/hash.hpp"
+#include "gw/strong_type.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+template <std::integral T, T Min, T Max, typename Tag>
+  requires(!std::same_as<T, bool>) && (Min <= Max)
+class bounded;
+
+namespace detail {
+
+/// \brief The bounds of the result of an operation on two intervals.
+template <typename T>
+struct interval {
+  T min;          ///< The lower bound.
+  T max;          ///< The upper bound.
+  bool overflow;  ///< Whether any bound overflows `T`.
+};
+
+/// \brief Return the bounds of `[lhs_min, lhs_max] Op [rhs_min, rhs_max]`.
+/// \details The integer operations are monotonic in each operand as long as a divisor does not change sign, so the
+/// bounds of the result are the extremes of the operation on the corners of the intervals.
+/// \pre For division, `0` is not in `[rhs_min, rhs_max]`.
+template <arithmetic_operation Operation, typename T>
+constexpr auto interval_operation(T lhs_min, T lhs_max, T rhs_min, T rhs_max) noexcept -> interval<T> {
+  const auto lhs = std::array{lhs_min, lhs_min, lhs_max, lhs_max};
+  const auto rhs = std::array{rhs_min, rhs_max, rhs_min, rhs_max};
+  auto corners = std::array<T, 4>{};
+  auto overflow = false;
+  for (std::size_t index = 0U; index < corners.size(); ++index) {
+    overflow |= overflow_operation<Operation>(lhs[index], rhs[index], corners[index]);
+  }
+  return {std::ranges::min(corners), std::ranges::max(corners), overflow};
+}
+
+/// \brief Whether the bounds of the result of `lhs Op rhs` fit in `T`.
+template <arithmetic_operation Operation, typename T, T LhsMin, T LhsMax, T RhsMin, T RhsMax>
+inline constexpr bool k_bounds_fit = !interval_operation<Operation>(LhsMin, LhsMax, RhsMin, RhsMax).overflow;
+
+/// \brief The gw::bounded type of the result of `lhs Op rhs`.
+template <arithmetic_operation Operation, typename T, T LhsMin, T LhsMax, T RhsMin, T RhsMax, typename Tag>
+struct bounded_result {
+  static constexpr auto k_bounds = interval_operation<Operation>(LhsMin, LhsMax, RhsMin, RhsMax);
+  using type = bounded<T, k_bounds.min, k_bounds.max, Tag>;
+};
+
+template <arithmetic_operation Operation, typename T, T LhsMin, T LhsMax, T RhsMin, T RhsMax, typename Tag>
+using bounded_result_t = typename bounded_result<Operation, T, LhsMin, LhsMax, RhsMin, RhsMax, Tag>::type;
+
+/// \brief The static number of elements of `Range`, or `std::dynamic_extent` if it is only known at run time.
+template <typename Range>
+inline constexpr std::size_t k_static_extent = std::dynamic_extent;
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t k_static_extent<T[N]> = N;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t k_static_extent<std::array<T, N>> = N;
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t k_static_extent<std::span<T, N>> = N;
+
+/// \brief Whether every index in `[Min, Max]` is in range of every `Range`.
+template <typename Range, auto Min, auto Max>
+inline constexpr bool k_proven_index = k_static_extent<std::remove_cvref_t<Range>> != std::dynamic_extent &&
+                                       std::cmp_greater_equal(Min, 0) &&
+                                       std::cmp_less(Max, k_static_extent<std::remove_cvref_t<Range>>);
+
+}  // namespace detail
+
+/// \example bounded_example.cpp
+//
+/// \brief An integer whose range is part of its type.
+//
+/// \details The class template `gw::bounded` holds a value of the integral type `T` that is known to be in
+/// `[Min, Max]`. The range is validated once, when a value of unknown range is converted to a bounded. Arithmetic on
+/// bounded values does not check anything at run time: the bounds of the result are computed at compile time from the
+/// bounds of the operands, in the style of interval arithmetic, and the result is a bounded of those bounds. Operations
+/// whose result bounds do not fit in `T` do not compile, so the run-time operations cannot overflow, and division is
+/// only available for divisors whose range excludes zero. Conversions to a wider range are implicit and free,
+/// conversions to a narrower range are explicit and checked. gw::at and gw::index use the bounds to elide the range
+/// checks of element access that the bounds already prove.
+/// \tparam T The underlying integral type.
+/// \tparam Min The smallest value.
+/// \tparam Max The largest value.
+/// \tparam Tag The tag type.
+template <std::integral T, T Min, T Max, typename Tag>
+  requires(!std::same_as<T, bool>) && (Min <= Max)
+class bounded {
+ public:
+  //
+  // Public types
+  //
+
+  using value_type = T;  ///< The type of the contained value.
+  using tag_type = Tag;  ///< The tag type.
+
+  //
+  // Public constants
+  //
+
+  static constexpr value_type min_value = Min;  ///< The smallest value.
+  static constexpr value_type max_value = Max;  ///< The largest value.
+
+  //
+  // Constructors
+  //
+
+  /// \brief constructs the gw::bounded object with the value in `[Min, Max]` that is closest to zero
+  constexpr bounded() noexcept : m_value(std::clamp(value_type{}, Min, Max)) {}
+
+  /// \brief constructs the gw::bounded object, validating the range of `value`
+  /// \throw std::out_of_range If `value` is not in `[Min, Max]`.
+  constexpr explicit bounded(value_type value) : m_value(value) {
+    if (!contains(value)) {
+      detail::throw_error<std::out_of_range>(
+          std::format("bounded::bounded: value (which is {}) is not in [{}, {}]", value, min_value, max_value));
+    }
+  }
+
+  /// \brief constructs the gw::bounded object from a bounded of a range that is contained in `[Min, Max]`
+  template <value_type OtherMin, value_type OtherMax>
+    requires(Min <= OtherMin && OtherMax <= Max)
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  constexpr bounded(const bounded<value_type, OtherMin, OtherMax, Tag>& other) noexcept : m_value(other.value()) {}
+
+  /// \brief constructs the gw::bounded object from a bounded of another range, validating the range of the value
+  /// \throw std::out_of_range If the value of `other` is not in `[Min, Max]`.
+  template <value_type OtherMin, value_type OtherMax>
+    requires(!(Min <= OtherMin && OtherMax <= Max))
+  constexpr explicit bounded(const bounded<value_type, OtherMin, OtherMax, Tag>& other) : bounded(other.value()) {}
+
+  //
+  // Factory functions
+  //
+
+  /// \brief returns a gw::bounded object with the value closest to `value` in `[Min, Max]`
+  [[nodiscard]] static constexpr auto clamp(value_type value) noexcept -> bounded {
+    return bounded{std::clamp(value, Min, Max), unchecked_t{}};
+  }
+
+  /// \brief returns a gw::bounded object with the value `value`, which the caller guarantees to be in `[Min, Max]`
+  /// \pre `contains(value)`
+  [[nodiscard]] static constexpr auto unchecked(value_type value) noexcept -> bounded {
+    return bounded{value, unchecked_t{}};
+  }
+
+  //
+  // Observers
+  //
+
+  /// \brief returns the contained value
+  [[nodiscard]] constexpr auto value() const noexcept -> value_type { return m_value; }
+
+  /// \brief converts the gw::bounded to its underlying type
+  constexpr explicit operator value_type() const noexcept { return m_value; }
+
+  /// \brief returns the contained value as a gw::strong_type of the same tag
+  [[nodiscard]] constexpr auto to_strong_type() const noexcept -> strong_type<value_type, tag_type> {
+    return strong_type<value_type, tag_type>{m_value};
+  }
+
+  /// \brief checks whether `value` is in `[Min, Max]`
+  [[nodiscard]] static constexpr auto contains(value_type value) noexcept -> bool {
+    return Min <= value && value <= Max;
+  }
+
+  //
+  // Comparison operators
+  //
+
+  /// \brief compares gw::bounded objects of the same tag
+  template <value_type OtherMin, value_type OtherMax>
+  constexpr auto operator==(const bounded<value_type, OtherMin, OtherMax, Tag>& rhs) const noexcept -> bool {
+    return m_value == rhs.value();
+  }
+
+  /// \brief compares gw::bounded objects of the same tag
+  template <value_type OtherMin, value_type OtherMax>
+  constexpr auto operator<=>(const bounded<value_type, OtherMin, OtherMax, Tag>& rhs) const noexcept
+      -> std::strong_ordering {
+    return m_value <=> rhs.value();
+  }
+
+  //
+  // Arithmetic operators
+  //
+
+  /// \brief returns the contained value, with the same bounds
+  constexpr auto operator+() const noexcept -> bounded { return *this; }
+
+  /// \brief negates the contained value, with the negated bounds
+  template <value_type Zero = 0>
+    requires std::signed_integral<value_type> &&
+             detail::k_bounds_fit<detail::arithmetic_operation::subtract, value_type, Zero, Zero, Min, Max>
+  constexpr auto operator-() const noexcept
+      -> detail::bounded_result_t<detail::arithmetic_operation::subtract, value_type, Zero, Zero, Min, Max, Tag>
+  {
+    using result_type =
+        detail::bounded_result_t<detail::arithmetic_operation::subtract, value_type, Zero, Zero, Min, Max, Tag>;
+    return result_type::unchecked(static_cast<value_type>(-m_value));
+  }
+
+  /// \brief adds the contained values, with the bounds of the sum
+  template <value_type RhsMin, value_type RhsMax>
+    requires detail::k_bounds_fit<detail::arithmetic_operation::add, value_type, Min, Max, RhsMin, RhsMax>
+  constexpr auto operator+(const bounded<value_type, RhsMin, RhsMax, Tag>& rhs) const noexcept
+      -> detail::bounded_result_t<detail::arithmetic_operation::add, value_type, Min, Max, RhsMin, RhsMax, Tag> {
+    using result_type =
+        detail::bounded_result_t<detail::arithmetic_operation::add, value_type, Min, Max, RhsMin, RhsMax, Tag>;
+    return result_type::unchecked(static_cast<value_type>(m_value + rhs.value()));
+  }
+
+  /// \brief subtracts the contained values, with the bounds of the difference
+  template <value_type RhsMin, value_type RhsMax>
+    requires detail::k_bounds_fit<detail::arithmetic_operation::subtract, value_type, Min, Max, RhsMin, RhsMax>
+  constexpr auto operator-(const bounded<value_type, RhsMin, RhsMax, Tag>& rhs) const noexcept
+      -> detail::bounded_result_t<detail::arithmetic_operation::subtract, value_type, Min, Max, RhsMin, RhsMax, Tag> {
+    using result_type =
+        detail::bounded_result_t<detail::arithmetic_operation::subtract, value_type, Min, Max, RhsMin, RhsMax, Tag>;
+    return result_type::unchecked(static_cast<value_type>(m_value - rhs.value()));
+  }
+
+  /// \brief multiplies the contained values, with the bounds of the product
+  template <value_type RhsMin, value_type RhsMax>
+    requires detail::k_bounds_fit<detail::arithmetic_operation::multiply, value_type, Min, Max, RhsMin, RhsMax>
+  constexpr auto operator*(const bounded<value_type, RhsMin, RhsMax, Tag>& rhs) const noexcept
+      -> detail::bounded_result_t<detail::arithmetic_operation::multiply, value_type, Min, Max, RhsMin, RhsMax, Tag> {
+    using result_type =
+        detail::bounded_result_t<detail::arithmetic_operation::multiply, value_type, Min, Max, RhsMin, RhsMax, Tag>;
+    return result_type::unchecked(static_cast<value_type>(m_value * rhs.value()));
+  }
+
+  /// \brief divides the contained values, with the bounds of the quotient
+  /// \details Only available if the range of `rhs` excludes zero.
+  template <value_type RhsMin, value_type RhsMax>
+    requires(RhsMin > 0 || RhsMax < 0) &&
+            detail::k_bounds_fit<detail::arithmetic_operation::divide, value_type, Min, Max, RhsMin, RhsMax>
+  constexpr auto operator/(const bounded<value_type, RhsMin, RhsMax, Tag>& rhs) const noexcept
+      -> detail::bounded_result_t<detail::arithmetic_operation::divide, value_type, Min, Max, RhsMin, RhsMax, Tag> {
+    using result_type =
+        detail::bounded_result_t<detail::arithmetic_operation::divide, value_type, Min, Max, RhsMin, RhsMax, Tag>;
+    return result_type::unchecked(static_cast<value_type>(m_value / rhs.value()));
+  }
+
+  //
+  // Stream operators
+  //
+
+  /// \brief inserts formatted data
+  friend inline auto operator<<(std::ostream& ostream, const bounded& rhs) -> std::ostream& {
+    return ostream << rhs.m_value;
+  }
+
+ private:
+  struct unchecked_t {};
+
+  constexpr bounded(value_type value, unchecked_t /*unchecked*/) noexcept : m_value(value) {}
+
+  value_type m_value;
+};
+
+/// \brief A gw::bounded whose range is the single value `Value`.
+template <auto Value, typename Tag>
+inline constexpr auto bounded_constant = bounded<decltype(Value), Value, Value, Tag>::unchecked(Value);
+
+//
+// Element access
+//
+
+/// \brief returns the element of `range` at `index`, without a range check
+/// \details Only available if the bounds of `position` prove that it is in range, i.e. for ranges whose size is known
+/// at compile time.
+template <typename Range, std::integral T, T Min, T Max, typename Tag>
+  requires detail::k_proven_index<Range, Min, Max>
+constexpr auto index(Range&& range, const bounded<T, Min, Max, Tag>& position) noexcept -> decltype(auto) {
+  return std::forward<Range>(range)[static_cast<std::size_t>(position.value())];
+}
+
+/// \brief returns the element of `range` at `index`, checking only what the bounds of `index` do not prove
+/// \details The lower check is elided if `Min >= 0`. The upper check is elided if the size of `range` is known at
+/// compile time and greater than `Max`.
+/// \throw std::out_of_range If `position` is negative or not less than the size of `range`.
+template <std::ranges::random_access_range Range, std::integral T, T Min, T Max, typename Tag>
+  requires std::ranges::sized_range<Range>
+constexpr auto at(Range&& range, const bounded<T, Min, Max, Tag>& position) -> decltype(auto) {
+  if constexpr (std::cmp_less(Min, 0)) {
+    if (std::cmp_less(position.value(), 0)) {
+      detail::throw_error<std::out_of_range>(std::format("at: position (which is {}) < 0", position.value()));
+    }
+  }
+  if constexpr (!detail::k_proven_index<Range, 0, Max>) {
+    if (const auto size = std::ranges::size(range); std::cmp_greater_equal(position.value(), size)) {
+      detail::throw_error<std::out_of_range>(
+          std::format("at: position (which is {}) >= size (which is {})", position.value(), size));
+    }
+  }
+  return std::ranges::begin(range)[static_cast<std::ranges::range_difference_t<Range>>(position.value())];
+}
+
+}  // namespace gw
+
+namespace std {
+
+//
+// Hash calculation
+//
+
+/// \brief hash support for gw::bounded
+template <typename T, T Min, T Max, typename Tag>
+// NOLINTNEXTLINE(cert-dcl58-cpp)
+struct hash<::gw::bounded<T, Min, Max, Tag>> {
+  [[nodiscard]] auto inline operator()(const ::gw::bounded<T, Min, Max, Tag>& bounded) const noexcept -> size_t {
+    return hash<::gw::strong_type<T, Tag>>{}(bounded.to_strong_type());
+  }
+};
+
+//
+// String conversion
+//
+
+/// \brief Format the `gw::bounded` object.
+///
+template <typename T, T Min, T Max, typename Tag, class CharT>
+// NOLINTNEXTLINE(cert-dcl58-cpp)
+struct formatter<::gw::bounded<T, Min, Max, Tag>, CharT> {
+  /// \brief Parse the format string.
+  ///
+  template <class ParseContext>
+  constexpr auto parse(ParseContext& context) -> ParseContext::iterator {
+    return context.begin();
+  }
+
+  /// \brief Format the `gw::bounded` object.
+  ///
+  template <class FormatContext>
+  auto format(const ::gw::bounded<T, Min, Max, Tag>& bounded, FormatContext& context) const
+      -> FormatContext::iterator {
+    return format_to(context.out(), "{}", bounded.value());
+  }
+};
+
+}  // namespace std
@@ -0,0 +1,278 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "gw/error.hpp"
+#include "gw/hash.hpp"
+#include "gw/inplace_string.hpp"
+#include "gw/named_type.hpp"
+#include "gw/strong_type.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+//
+// Sentinels
+//
+
+/// \brief The sentinel traits of `T`, which encode the empty state of gw::compact_optional in a value of `T`.
+/// \details Specializations provide `static constexpr auto empty() -> T`, which returns the sentinel, and
+/// `static constexpr auto is_empty(const T&) -> bool`, which checks for it. The primary template is not defined.
+template <typename T>
+struct sentinel_traits;
+
+/// \brief Concept for sentinel traits of `T`.
+template <typename Sentinel, typename T>
+concept sentinel_for = requires(const T& value) {
+  { Sentinel::empty() } -> std::same_as<T>;
+  { Sentinel::is_empty(value) } -> std::same_as<bool>;
+};
+
+/// \brief Concept for types that have sentinel traits.
+template <typename T>
+concept has_sentinel = sentinel_for<sentinel_traits<T>, T>;
+
+/// \brief Sentinel traits that use the value `Value` of `T`.
+template <typename T, T Value>
+struct sentinel_value {
+  /// \brief Return the sentinel.
+  static constexpr auto empty() noexcept -> T { return Value; }
+
+  /// \brief Check whether `value` is the sentinel.
+  static constexpr auto is_empty(const T& value) noexcept -> bool { return value == Value; }
+};
+
+/// \brief Sentinel traits for strings, which set the terminator past the last character to all ones.
+/// \details Every constructor and mutator keeps the character at `max_size()` null, so the sentinel is not a valid
+/// string.
+template <std::size_t N, class CharT, class Traits>
+struct sentinel_traits<basic_inplace_string<N, CharT, Traits>> {
+  /// \brief Return the sentinel.
+  static constexpr auto empty() noexcept -> basic_inplace_string<N, CharT, Traits> {
+    auto value = basic_inplace_string<N, CharT, Traits>{};
+    value.m_data[N] = static_cast<CharT>(~CharT{});
+    return value;
+  }
+
+  /// \brief Check whether `value` is the sentinel.
+  static constexpr auto is_empty(const basic_inplace_string<N, CharT, Traits>& value) noexcept -> bool {
+    return value.m_data[N] != CharT{};
+  }
+};
+
+/// \brief Sentinel traits for strong types whose tag declares the sentinel as `Tag::sentinel`.
+template <typename T, typename Tag>
+  requires requires {
+    { Tag::sentinel } -> std::convertible_to<T>;
+  }
+struct sentinel_traits<strong_type<T, Tag>> {
+  /// \brief Return the sentinel.
+  static constexpr auto empty() noexcept -> strong_type<T, Tag> { return strong_type<T, Tag>{Tag::sentinel}; }
+
+  /// \brief Check whether `value` is the sentinel.
+  static constexpr auto is_empty(const strong_type<T, Tag>& value) noexcept -> bool {
+    return value.value() == Tag::sentinel;
+  }
+};
+
+/// \brief Sentinel traits for strong types of types with sentinel traits, whose tag does not declare a sentinel.
+template <has_sentinel T, typename Tag>
+  requires(!requires { Tag::sentinel; })
+struct sentinel_traits<strong_type<T, Tag>> {
+  /// \brief Return the sentinel.
+  static constexpr auto empty() noexcept -> strong_type<T, Tag> {
+    return strong_type<T, Tag>{sentinel_traits<T>::empty()};
+  }
+
+  /// \brief Check whether `value` is the sentinel.
+  static constexpr auto is_empty(const strong_type<T, Tag>& value) noexcept -> bool {
+    return sentinel_traits<T>::is_empty(value.value());
+  }
+};
+
+/// \brief Sentinel traits for named types of types with sentinel traits.
+template <has_sentinel T, basic_inplace_string Name>
+struct sentinel_traits<named_type<T, Name>> {
+  /// \brief Return the sentinel.
+  static constexpr auto empty() noexcept -> named_type<T, Name> {
+    return named_type<T, Name>{sentinel_traits<T>::empty()};
+  }
+
+  /// \brief Check whether `value` is the sentinel.
+  static constexpr auto is_empty(const named_type<T, Name>& value) noexcept -> bool {
+    return sentinel_traits<T>::is_empty(value.value());
+  }
+};
+
+//
+// Compact optional
+//
+
+/// \example compact_optional_example.cpp
+//
+/// \brief An optional value that encodes the empty state in a sentinel value of `T`.
+//
+/// \details The class template `gw::compact_optional` has the interface of `std::optional`, but instead of an engaged
+/// flag it stores a value of `T` that is never used otherwise, so that `sizeof(compact_optional<T>) == sizeof(T)`.
+/// This halves the memory of optional 32-bit ids, where `std::optional` adds a flag and padding. The sentinel is
+/// selected by `Sentinel`, which defaults to gw::sentinel_traits:
+/// * for `gw::strong_type<T, Tag>`, a tag declares the sentinel as `static constexpr T sentinel`,
+/// * for `gw::basic_inplace_string`, the terminator past the last character is set to all ones, which no string
+///   contains,
+/// * for `gw::strong_type` and `gw::named_type` of types with sentinel traits, the sentinel of the contained type is
+///   used,
+/// * any value can be used as the sentinel with gw::sentinel_value.
+/// \tparam T The type of the contained value.
+/// \tparam Sentinel The sentinel traits.
+template <typename T, sentinel_for<T> Sentinel = sentinel_traits<T>>
+class compact_optional {
+ public:
+  //
+  // Public types
+  //
+
+  using value_type = T;            ///< The type of the contained value.
+  using sentinel_type = Sentinel;  ///< The sentinel traits.
+
+  //
+  // Constructors
+  //
+
+  /// \brief constructs an empty gw::compact_optional
+  constexpr compact_optional() noexcept : m_value(Sentinel::empty()) {}
+
+  /// \brief constructs an empty gw::compact_optional
+  constexpr compact_optional(std::nullopt_t /*nullopt*/) noexcept  // NOLINT(google-explicit-constructor)
+      : compact_optional() {}
+
+  /// \brief constructs a gw::compact_optional that contains `value`
+  /// \throw std::invalid_argument If `value` is the sentinel.
+  constexpr compact_optional(const value_type& value)  // NOLINT(google-explicit-constructor)
+      : m_value(check_value(value, "compact_optional")) {}
+
+  /// \brief constructs a gw::compact_optional from a `std::optional`
+  /// \throw std::invalid_argument If `optional` contains the sentinel.
+  constexpr explicit compact_optional(const std::optional<value_type>& optional)
+      : m_value(optional.has_value() ? check_value(*optional, "compact_optional") : Sentinel::empty()) {}
+
+  //
+  // Observers
+  //
+
+  /// \brief checks whether the gw::compact_optional contains a value
+  [[nodiscard]] constexpr auto has_value() const noexcept -> bool { return !Sentinel::is_empty(m_value); }
+
+  /// \brief checks whether the gw::compact_optional contains a value
+  constexpr explicit operator bool() const noexcept { return has_value(); }
+
+  /// \brief returns the contained value
+  /// \throw std::bad_optional_access If the gw::compact_optional is empty.
+  [[nodiscard]] constexpr auto value() const -> const value_type& {
+    if (!has_value()) {
+      detail::throw_error<std::bad_optional_access>("compact_optional::value: no value");
+    }
+    return m_value;
+  }
+
+  /// \brief returns the contained value, or `default_value` if the gw::compact_optional is empty
+  template <typename U>
+  [[nodiscard]] constexpr auto value_or(U&& default_value) const -> value_type {
+    return has_value() ? m_value : static_cast<value_type>(std::forward<U>(default_value));
+  }
+
+  /// \brief accesses the contained value
+  /// \pre `has_value()`
+  constexpr auto operator*() const noexcept -> const value_type& { return m_value; }
+
+  /// \brief accesses the contained value
+  /// \pre `has_value()`
+  constexpr auto operator->() const noexcept -> const value_type* { return &m_value; }
+
+  /// \brief returns the contained value as a `std::optional`
+  [[nodiscard]] constexpr auto to_optional() const -> std::optional<value_type> {
+    return has_value() ? std::optional<value_type>{m_value} : std::nullopt;
+  }
+
+  //
+  // Modifiers
+  //
+
+  /// \brief destroys any contained value
+  constexpr void reset() noexcept { m_value = Sentinel::empty(); }
+
+  /// \brief constructs the contained value in-place
+  /// \throw std::invalid_argument If the constructed value is the sentinel.
+  template <typename... Args>
+  constexpr auto emplace(Args&&... args) -> const value_type&
+    requires std::constructible_from<value_type, Args...>
+  {
+    m_value = check_value(value_type(std::forward<Args>(args)...), "emplace");
+    return m_value;
+  }
+
+  /// \brief specializes the std::swap algorithm
+  constexpr void swap(compact_optional& rhs) noexcept(std::is_nothrow_swappable_v<value_type>) {
+    using std::swap;
+    swap(m_value, rhs.m_value);
+  }
+
+  //
+  // Comparison operators
+  //
+
+  /// \brief compares gw::compact_optional objects, where an empty object is equal only to an empty object
+  friend constexpr auto operator==(const compact_optional& lhs, const compact_optional& rhs) -> bool {
+    return lhs.has_value() == rhs.has_value() && (!lhs.has_value() || lhs.m_value == rhs.m_value);
+  }
+
+  /// \brief checks whether the gw::compact_optional is empty
+  friend constexpr auto operator==(const compact_optional& lhs, std::nullopt_t /*nullopt*/) noexcept -> bool {
+    return !lhs.has_value();
+  }
+
+  /// \brief checks whether the gw::compact_optional contains `rhs`
+  friend constexpr auto operator==(const compact_optional& lhs, const value_type& rhs) -> bool {
+    return lhs.has_value() && lhs.m_value == rhs;
+  }
+
+ private:
+  static constexpr auto check_value(const value_type& value, const char* function) -> const value_type& {
+    if (Sentinel::is_empty(value)) {
+      detail::throw_error<std::invalid_argument>(std::format("compact_optional::{}: value is the sentinel", function));
+    }
+    return value;
+  }
+
+  value_type m_value;
+};
+
+}  // namespace gw
+
+namespace std {
+
+//
+// Hash calculation
+//
+
+/// \brief hash support for gw::compact_optional
+/// \details Equal to the hash of `std::optional<T>`.
+template <::gw::hashable T, typename Sentinel>
+// NOLINTNEXTLINE(cert-dcl58-cpp)
+struct hash<::gw::compact_optional<T, Sentinel>> {
+  [[nodiscard]] auto inline operator()(const ::gw::compact_optional<T, Sentinel>& optional) const noexcept -> size_t {
+    return optional.has_value() ? hash<T>{}(*optional) : hash<std::optional<T>>{}(std::nullopt);
+  }
+};
+
+}  // namespace std
@@ -59,4 +59,23 @@ concept named = requires(T value) {
   { value.name() } -> std::convertible_to<std::string>;
 };
 
+/// \brief Concept for unit tags, for which multiplication and division derive a new unit.
+template <typename T>
+concept unit_tag = requires {
+  typename T::dimension;
+  typename T::ratio;
+};
+
+/// \brief Concept for decimal tags, for which the value is a mantissa with a fixed number of decimal places.
+template <typename T>
+concept decimal_tag = requires {
+  { T::scale } -> std::convertible_to<int>;
+  T::rounding_mode;
+  typename T::tag_type;
+};
+
+/// \brief Concept for tags that replace the multiplication and division of gw::strong_type.
+template <typename T>
+concept scaling_tag = unit_tag<T> || decimal_tag<T>;
+
 }  // namespace gw
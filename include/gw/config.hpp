@@ -0,0 +1,42 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+// GW_FORWARDING marks the functions that only forward to the contained value, e.g. value(), operator* and the
+// operators of gw::strong_type and gw::named_type. With GW_DEBUG_INLINE, GCC and Clang inline them even without
+// optimizations, and debuggers step over them, so that debug builds of code that uses the wrappers run about as fast as
+// debug builds of code that uses the raw types. Other compilers inline them with their usual inlining only.
+#if defined(GW_DEBUG_INLINE) && (defined(__GNUC__) || defined(__clang__))
+#define GW_FORWARDING [[gnu::always_inline, gnu::artificial]]
+#else
+#define GW_FORWARDING
+#endif  // defined(GW_DEBUG_INLINE) && (defined(__GNUC__) || defined(__clang__))
+
+// GW_NOINLINE keeps cold or shared code, e.g. the reporting of errors and the capacity-erased core of
+// gw::basic_inplace_string, out of the functions that call it
+#if defined(__GNUC__) || defined(__clang__)
+#define GW_NOINLINE [[gnu::noinline]]
+#elif defined(_MSC_VER)
+#define GW_NOINLINE __declspec(noinline)
+#else
+#define GW_NOINLINE
+#endif  // defined(__GNUC__) || defined(__clang__)
+
+// With GW_NO_EXCEPTIONS, gw reports errors to the handler of gw::set_error_handler and terminates, instead of throwing,
+// see gw/error.hpp. It is defined when exceptions are disabled, e.g. with -fno-exceptions, and can be defined to not
+// throw anyway. It must be the same for the whole program, because the functions that report errors are defined
+// differently in the two configurations. gw::detail::throw_error is declared in an inline namespace named after the
+// configuration, and with MSVC, the linker rejects programs that mix them. gw does not use RTTI in either
+// configuration: the identity of a tag is gw::type_hash_v, which is computed at compile time.
+#if !defined(GW_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(_CPPUNWIND)
+#define GW_NO_EXCEPTIONS
+#endif  // !defined(GW_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(_CPPUNWIND)
+
+#if defined(_MSC_VER)
+#if defined(GW_NO_EXCEPTIONS)
+#pragma detect_mismatch("GW_NO_EXCEPTIONS", "1")
+#else
+#pragma detect_mismatch("GW_NO_EXCEPTIONS", "0")
+#endif  // defined(GW_NO_EXCEPTIONS)
+#endif  // defined(_MSC_VER)
@@ -6,6 +6,8 @@
 #include <concepts>
 #include <type_traits>
 
+#include "gw/config.hpp"
+
 /// \brief GW namespace
 namespace gw {
 
@@ -14,13 +16,13 @@ template <template <typename> class T, typename Derived>
   requires std::is_class_v<Derived> && std::same_as<Derived, std::remove_cv_t<Derived>>
 struct crtp {
   /// \brief Returns a reference to the derived class.
-  constexpr auto self() noexcept -> Derived& {
+  GW_FORWARDING constexpr auto self() noexcept -> Derived& {
     static_assert(std::derived_from<Derived, T<Derived>>);
     return static_cast<Derived&>(*this);
   }
 
   /// \brief Returns a reference to the derived class.
-  constexpr auto self() const noexcept -> Derived const& {
+  GW_FORWARDING constexpr auto self() const noexcept -> Derived const& {
     static_assert(std::derived_from<Derived, T<Derived>>);
     return static_cast<const Derived&>(*this);
   }
@@ -0,0 +1,569 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "gw/arithmetic.hpp"
+#include "gw/concepts.hpp"
+#include "gw/error.hpp"
+#include "gw/strong_type.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+/// \brief How the result of a decimal operation is rounded to the scale of the result.
+enum class rounding {
+  toward_zero,          ///< Truncate.
+  downward,             ///< Round toward negative infinity.
+  upward,               ///< Round toward positive infinity.
+  half_away_from_zero,  ///< Round to nearest, ties away from zero, like `std::round`.
+  half_even,            ///< Round to nearest, ties to even, also known as banker's rounding.
+};
+
+/// \brief A decimal tag for gw::strong_type.
+/// \tparam Scale The number of decimal places.
+/// \tparam Tag The tag type that distinguishes decimals of the same scale, e.g. currencies.
+/// \tparam Rounding The rounding of multiplications, divisions and conversions.
+template <int Scale, typename Tag, rounding Rounding = rounding::half_away_from_zero>
+  requires(Scale >= 0)
+struct decimal_scale {
+  using tag_type = Tag;                                            ///< The tag type.
+  using arithmetic_policy = detail::tag_arithmetic_policy_t<Tag>;  ///< The arithmetic policy of the tag.
+  static constexpr int scale = Scale;                              ///< The number of decimal places.
+  static constexpr rounding rounding_mode = Rounding;              ///< The rounding mode.
+};
+
+/// \example decimal_example.cpp
+//
+/// \brief A fixed-point decimal number.
+//
+/// \details A `gw::decimal<Rep, Scale, Tag>` is a `gw::strong_type` whose value is an integer mantissa, scaled by
+/// `10^-Scale`. A `gw::decimal<std::int64_t, 4, usd_tag>` with the value `12345` is 1.2345 USD. Addition, subtraction
+/// and comparison are those of `gw::strong_type` on the mantissa and follow the arithmetic policy of `Tag`.
+/// Multiplication and division rescale the result to the scale of the left operand and round it with the rounding mode
+/// of the decimal, or with an explicit rounding mode via gw::decimal_multiply and gw::decimal_divide. The intermediate
+/// product is computed at twice the width of `Rep` where the platform provides it, so that the results are exact before
+/// rounding. A product or quotient that does not fit `Rep` follows the arithmetic policy of `Tag`, like a sum. Decimals
+/// are formatted and parsed with gw::to_chars and gw::from_chars, without allocation and without going through
+/// `double`.
+/// \tparam Rep The integer type of the mantissa.
+/// \tparam Scale The number of decimal places.
+/// \tparam Tag The tag type.
+/// \tparam Rounding The rounding of multiplications, divisions and conversions.
+template <std::integral Rep, int Scale, typename Tag, rounding Rounding = rounding::half_away_from_zero>
+  requires(!std::same_as<Rep, bool>) && (Scale >= 0) && (Scale <= std::numeric_limits<Rep>::digits10)
+using decimal = strong_type<Rep, decimal_scale<Scale, Tag, Rounding>>;
+
+namespace detail {
+
+#if defined(__SIZEOF_INT128__)
+__extension__ using int128 = __int128;
+__extension__ using uint128 = unsigned __int128;
+#endif
+
+/// \brief Return a value of the integer type that holds the product of two `Rep` values.
+template <std::integral Rep>
+constexpr auto wide_integer() noexcept {
+  if constexpr (sizeof(Rep) < sizeof(std::int64_t)) {
+    return std::conditional_t<std::is_signed_v<Rep>, std::int64_t, std::uint64_t>{};
+  }
+#if defined(__SIZEOF_INT128__)
+  else if constexpr (std::is_signed_v<Rep>) {
+    return int128{};
+  } else {
+    return uint128{};
+  }
+#else
+  else {
+    return Rep{};
+  }
+#endif
+}
+
+/// \brief The integer type that holds the product of two `Rep` values, or `Rep` if there is no wider type.
+template <std::integral Rep>
+using wide_integer_t = decltype(wide_integer<Rep>());
+
+/// \brief Return `10^exponent`.
+template <typename T>
+constexpr auto power_of_ten(int exponent) noexcept -> T {
+  auto result = T{1};
+  for (; exponent > 0; --exponent) {
+    result *= T{10};
+  }
+  return result;
+}
+
+/// \brief Return `numerator / denominator`, rounded with `Rounding`.
+/// \pre `denominator != 0`
+template <rounding Rounding, typename T>
+constexpr auto divide_rounded(T numerator, T denominator) noexcept -> T {
+  const auto quotient = static_cast<T>(numerator / denominator);
+  const auto remainder = static_cast<T>(numerator % denominator);
+  if (remainder == T{0} || Rounding == rounding::toward_zero) {
+    return quotient;
+  }
+
+  // The signs of the exact quotient and of the step away from zero, and the magnitudes of the remainder and of the
+  // distance to the next multiple of the denominator. None of these overflow, because |remainder| < |denominator|.
+  constexpr auto k_signed = static_cast<T>(-1) < T{0};
+  auto negative = false;
+  auto below = remainder;
+  auto above = static_cast<T>(denominator - remainder);
+  if constexpr (k_signed) {
+    negative = (remainder < T{0}) != (denominator < T{0});
+    below = remainder < T{0} ? static_cast<T>(-remainder) : remainder;
+    above = negative ? static_cast<T>(denominator + remainder) : above;
+    above = above < T{0} ? static_cast<T>(-above) : above;
+  }
+  const auto away = negative ? static_cast<T>(quotient - T{1}) : static_cast<T>(quotient + T{1});
+
+  if constexpr (Rounding == rounding::downward) {
+    return negative ? away : quotient;
+  } else if constexpr (Rounding == rounding::upward) {
+    return negative ? quotient : away;
+  } else if constexpr (Rounding == rounding::half_away_from_zero) {
+    return below >= above ? away : quotient;
+  } else {
+    return below > above || (below == above && quotient % T{2} != T{0}) ? away : quotient;
+  }
+}
+
+/// \brief Calculate `numerator / denominator`, rounded with `Rounding`, wrapping on overflow.
+/// \return True if the quotient does not fit `T`, which is only the case for the minimum divided by `-1`.
+/// \pre `denominator != 0`
+template <rounding Rounding, std::integral T>
+constexpr auto divide_rounded_overflow(T numerator, T denominator, T& result) noexcept -> bool {
+  if constexpr (std::is_signed_v<T>) {
+    if (numerator == std::numeric_limits<T>::min() && denominator == T{-1}) {
+      result = numerator;
+      return true;
+    }
+  }
+  result = divide_rounded<Rounding>(numerator, denominator);
+  return false;
+}
+
+/// \brief Convert the wide integer `value` to `Rep`, wrapping if it does not fit.
+/// \return True if `value` does not fit `Rep`, false otherwise.
+template <std::integral Rep, typename Wide>
+constexpr auto narrow_overflow(Wide value, Rep& result) noexcept -> bool {
+  result = static_cast<Rep>(value);
+  return static_cast<Wide>(result) != value;
+}
+
+/// \brief Calculate `lhs * rhs / 10^Scale`, rounded with `Rounding`, wrapping on overflow.
+/// \details Without an integer type wider than `Rep`, i.e. for 64-bit mantissas on platforms without `__int128`, the
+/// product is computed in `Rep`, and a product that does not fit is an overflow even if the rescaled result would fit.
+/// \return True if the result does not fit `Rep`, false otherwise.
+template <rounding Rounding, int Scale, std::integral Rep>
+constexpr auto multiply_scaled(Rep lhs, Rep rhs, Rep& result) noexcept -> bool {
+  using wide_type = wide_integer_t<Rep>;
+  if constexpr (Scale == 0) {
+    return mul_overflow(lhs, rhs, result);
+  } else if constexpr (sizeof(wide_type) > sizeof(Rep)) {
+    if constexpr (sizeof(wide_type) > sizeof(std::int64_t)) {
+      // Stay in `Rep` while the product fits, where the division by the constant is a multiplication
+      if (auto product = Rep{}; !mul_overflow(lhs, rhs, product)) {
+        result = divide_rounded<Rounding>(product, power_of_ten<Rep>(Scale));
+        return false;
+      }
+    }
+    const auto product = static_cast<wide_type>(static_cast<wide_type>(lhs) * static_cast<wide_type>(rhs));
+    return narrow_overflow(divide_rounded<Rounding>(product, power_of_ten<wide_type>(Scale)), result);
+  } else {
+    auto product = Rep{};
+    const auto overflow = mul_overflow(lhs, rhs, product);
+    result = divide_rounded<Rounding>(product, power_of_ten<Rep>(Scale));
+    return overflow;
+  }
+}
+
+/// \brief Calculate `lhs * 10^Scale / rhs`, rounded with `Rounding`, wrapping on overflow.
+/// \details Without an integer type wider than `Rep`, a numerator that does not fit `Rep` is an overflow, as for
+/// gw::detail::multiply_scaled.
+/// \return True if the result does not fit `Rep`, false otherwise.
+/// \pre `rhs != 0`
+template <rounding Rounding, int Scale, std::integral Rep>
+constexpr auto divide_scaled(Rep lhs, Rep rhs, Rep& result) noexcept -> bool {
+  using wide_type = wide_integer_t<Rep>;
+  if constexpr (sizeof(wide_type) > sizeof(Rep)) {
+    if constexpr (sizeof(wide_type) > sizeof(std::int64_t)) {
+      if (auto numerator = Rep{}; !mul_overflow(lhs, power_of_ten<Rep>(Scale), numerator)) {
+        return divide_rounded_overflow<Rounding>(numerator, rhs, result);
+      }
+    }
+    const auto numerator = static_cast<wide_type>(static_cast<wide_type>(lhs) * power_of_ten<wide_type>(Scale));
+    return narrow_overflow(divide_rounded<Rounding>(numerator, static_cast<wide_type>(rhs)), result);
+  } else {
+    auto numerator = Rep{};
+    const auto overflow = mul_overflow(lhs, power_of_ten<Rep>(Scale), numerator);
+    return divide_rounded_overflow<Rounding>(numerator, rhs, result) || overflow;
+  }
+}
+
+/// \brief The result of a decimal operation on `strong_type<Rep, D>` under the arithmetic policy of `D`.
+template <typename Rep, typename D>
+using decimal_result_t = arithmetic_result_t<typename D::arithmetic_policy, strong_type<Rep, D>>;
+
+/// \brief Whether the decimal operations of `D` do not throw, i.e. its arithmetic policy is not gw::checked_arithmetic.
+template <typename D>
+inline constexpr bool k_nothrow_decimal = !std::same_as<typename D::arithmetic_policy, checked_arithmetic>;
+
+/// \brief Return the `result` of the operation on `lhs` and `rhs` under the arithmetic policy of `D`.
+/// \details If the operation overflowed, gw::checked_arithmetic throws, gw::saturating_arithmetic saturates,
+/// gw::expected_arithmetic returns an error and the other policies keep the wrapped `result`.
+/// \throw std::overflow_error If `overflow` and the policy is gw::checked_arithmetic.
+template <typename D, arithmetic_operation Operation, std::integral Rep>
+constexpr auto decimal_result(Rep lhs, Rep rhs, Rep result, bool overflow) noexcept(k_nothrow_decimal<D>)
+    -> decimal_result_t<Rep, D> {
+  using policy = typename D::arithmetic_policy;
+  if (overflow) {
+    if constexpr (std::same_as<policy, checked_arithmetic>) {
+      detail::throw_error<std::overflow_error>(
+          std::format("checked_arithmetic: decimal {} of {} and {} overflows", operation_name(Operation), lhs, rhs));
+    } else if constexpr (std::same_as<policy, saturating_arithmetic>) {
+      result = saturation_value<Operation>(lhs, rhs);
+    }
+#if defined(__cpp_lib_expected)
+    if constexpr (std::same_as<policy, expected_arithmetic>) {
+      return std::unexpected{std::errc::result_out_of_range};
+    }
+#endif  // defined(__cpp_lib_expected)
+  }
+  return strong_type<Rep, D>{result};
+}
+
+/// \brief The maximum number of characters of a formatted decimal with mantissa type `Rep`.
+template <std::integral Rep>
+inline constexpr std::size_t k_decimal_chars = std::numeric_limits<Rep>::digits10 + 4U;
+
+/// \brief Concept for two decimal tags of the same tag type.
+template <typename D1, typename D2>
+concept same_decimal_tag =
+    decimal_tag<D1> && decimal_tag<D2> && std::same_as<typename D1::tag_type, typename D2::tag_type>;
+
+}  // namespace detail
+
+//
+// Conversions
+//
+
+/// \brief converts a decimal to another scale of the same tag, rounding with `Rounding`
+template <typename To, rounding Rounding = To::tag_type::rounding_mode, std::integral Rep, decimal_tag From>
+  requires detail::same_decimal_tag<typename To::tag_type, From> && std::same_as<typename To::value_type, Rep>
+constexpr auto decimal_cast(const strong_type<Rep, From>& from) noexcept -> To {
+  constexpr auto k_to_scale = To::tag_type::scale;
+  if constexpr (k_to_scale >= From::scale) {
+    return To{static_cast<Rep>(from.value() * detail::power_of_ten<Rep>(k_to_scale - From::scale))};
+  } else {
+    return To{detail::divide_rounded<Rounding>(from.value(), detail::power_of_ten<Rep>(From::scale - k_to_scale))};
+  }
+}
+
+//
+// Arithmetic
+//
+
+/// \brief multiplies two decimals, rescaling the result to the scale of `lhs` and rounding with `Rounding`
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+template <rounding Rounding, std::integral Rep, decimal_tag D1, decimal_tag D2>
+  requires detail::same_decimal_tag<D1, D2>
+constexpr auto decimal_multiply(const strong_type<Rep, D1>& lhs, const strong_type<Rep, D2>& rhs) noexcept(
+    detail::k_nothrow_decimal<D1>) -> detail::decimal_result_t<Rep, D1> {
+  auto result = Rep{};
+  const auto overflow = detail::multiply_scaled<Rounding, D2::scale>(lhs.value(), rhs.value(), result);
+  return detail::decimal_result<D1, detail::arithmetic_operation::multiply>(lhs.value(), rhs.value(), result,
+                                                                             overflow);
+}
+
+/// \brief divides two decimals, rescaling the result to the scale of `lhs` and rounding with `Rounding`
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+/// \pre `rhs` is not zero
+template <rounding Rounding, std::integral Rep, decimal_tag D1, decimal_tag D2>
+  requires detail::same_decimal_tag<D1, D2>
+constexpr auto decimal_divide(const strong_type<Rep, D1>& lhs, const strong_type<Rep, D2>& rhs) noexcept(
+    detail::k_nothrow_decimal<D1>) -> detail::decimal_result_t<Rep, D1> {
+  auto result = Rep{};
+  const auto overflow = detail::divide_scaled<Rounding, D2::scale>(lhs.value(), rhs.value(), result);
+  return detail::decimal_result<D1, detail::arithmetic_operation::divide>(lhs.value(), rhs.value(), result, overflow);
+}
+
+/// \brief multiplies two decimals, rescaling the result to the scale of `lhs`
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+template <std::integral Rep, decimal_tag D1, decimal_tag D2>
+  requires detail::same_decimal_tag<D1, D2>
+constexpr auto operator*(const strong_type<Rep, D1>& lhs, const strong_type<Rep, D2>& rhs) noexcept(
+    detail::k_nothrow_decimal<D1>) -> detail::decimal_result_t<Rep, D1> {
+  return decimal_multiply<D1::rounding_mode>(lhs, rhs);
+}
+
+/// \brief divides two decimals, rescaling the result to the scale of `lhs`
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+/// \pre `rhs` is not zero
+template <std::integral Rep, decimal_tag D1, decimal_tag D2>
+  requires detail::same_decimal_tag<D1, D2>
+constexpr auto operator/(const strong_type<Rep, D1>& lhs, const strong_type<Rep, D2>& rhs) noexcept(
+    detail::k_nothrow_decimal<D1>) -> detail::decimal_result_t<Rep, D1> {
+  return decimal_divide<D1::rounding_mode>(lhs, rhs);
+}
+
+/// \brief scales a decimal
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+template <std::integral Rep, decimal_tag D>
+constexpr auto operator*(const strong_type<Rep, D>& lhs, const std::type_identity_t<Rep>& rhs) noexcept(
+    detail::k_nothrow_decimal<D>) -> detail::decimal_result_t<Rep, D> {
+  auto result = Rep{};
+  const auto overflow = detail::mul_overflow(lhs.value(), rhs, result);
+  return detail::decimal_result<D, detail::arithmetic_operation::multiply>(lhs.value(), rhs, result, overflow);
+}
+
+/// \brief scales a decimal
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+template <std::integral Rep, decimal_tag D>
+constexpr auto operator*(const std::type_identity_t<Rep>& lhs, const strong_type<Rep, D>& rhs) noexcept(
+    detail::k_nothrow_decimal<D>) -> detail::decimal_result_t<Rep, D> {
+  return rhs * lhs;
+}
+
+/// \brief divides a decimal by an integer, rounding with the rounding mode of the decimal
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+/// \pre `rhs != 0`
+template <std::integral Rep, decimal_tag D>
+constexpr auto operator/(const strong_type<Rep, D>& lhs, const std::type_identity_t<Rep>& rhs) noexcept(
+    detail::k_nothrow_decimal<D>) -> detail::decimal_result_t<Rep, D> {
+  auto result = Rep{};
+  const auto overflow = detail::divide_rounded_overflow<D::rounding_mode>(lhs.value(), rhs, result);
+  return detail::decimal_result<D, detail::arithmetic_operation::divide>(lhs.value(), rhs, result, overflow);
+}
+
+/// \brief multiplies by a decimal, rescaling the result to the scale of `lhs`
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+template <std::integral Rep, decimal_tag D1, decimal_tag D2>
+  requires detail::same_decimal_tag<D1, D2> && std::same_as<detail::decimal_result_t<Rep, D1>, strong_type<Rep, D1>>
+constexpr auto operator*=(strong_type<Rep, D1>& lhs, const strong_type<Rep, D2>& rhs) noexcept(
+    detail::k_nothrow_decimal<D1>) -> strong_type<Rep, D1>& {
+  return lhs = lhs * rhs;
+}
+
+/// \brief divides by a decimal, rescaling the result to the scale of `lhs`
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+/// \pre `rhs` is not zero
+template <std::integral Rep, decimal_tag D1, decimal_tag D2>
+  requires detail::same_decimal_tag<D1, D2> && std::same_as<detail::decimal_result_t<Rep, D1>, strong_type<Rep, D1>>
+constexpr auto operator/=(strong_type<Rep, D1>& lhs, const strong_type<Rep, D2>& rhs) noexcept(
+    detail::k_nothrow_decimal<D1>) -> strong_type<Rep, D1>& {
+  return lhs = lhs / rhs;
+}
+
+/// \brief scales a decimal
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+template <std::integral Rep, decimal_tag D>
+  requires std::same_as<detail::decimal_result_t<Rep, D>, strong_type<Rep, D>>
+constexpr auto operator*=(strong_type<Rep, D>& lhs, const std::type_identity_t<Rep>& rhs) noexcept(
+    detail::k_nothrow_decimal<D>) -> strong_type<Rep, D>& {
+  return lhs = lhs * rhs;
+}
+
+/// \brief divides a decimal by an integer, rounding with the rounding mode of the decimal
+/// \throw std::overflow_error If the result overflows under gw::checked_arithmetic.
+/// \pre `rhs != 0`
+template <std::integral Rep, decimal_tag D>
+  requires std::same_as<detail::decimal_result_t<Rep, D>, strong_type<Rep, D>>
+constexpr auto operator/=(strong_type<Rep, D>& lhs, const std::type_identity_t<Rep>& rhs) noexcept(
+    detail::k_nothrow_decimal<D>) -> strong_type<Rep, D>& {
+  return lhs = lhs / rhs;
+}
+
+//
+// Character conversion
+//
+
+/// \brief Write the decimal to `[first, last)`, e.g. `-12.3400` for the mantissa `-123400` at scale 4.
+/// \details All decimal places are written. The result is as for `std::to_chars`: `std::errc::value_too_large` if
+/// the range is too small, in which case the contents of the range are unspecified.
+template <std::integral Rep, decimal_tag D>
+auto to_chars(char* first, char* last, const strong_type<Rep, D>& value) noexcept -> std::to_chars_result {
+  using unsigned_type = std::make_unsigned_t<Rep>;
+  constexpr auto k_divisor = detail::power_of_ten<unsigned_type>(D::scale);
+
+  auto magnitude = static_cast<unsigned_type>(value.value());
+  if constexpr (std::signed_integral<Rep>) {
+    if (value.value() < Rep{0}) {
+      if (first == last) {
+        return {last, std::errc::value_too_large};
+      }
+      *first++ = '-';
+      magnitude = static_cast<unsigned_type>(unsigned_type{0} - magnitude);
+    }
+  }
+
+  auto result = std::to_chars(first, last, static_cast<unsigned_type>(magnitude / k_divisor));
+  if constexpr (D::scale > 0) {
+    if (result.ec != std::errc{}) {
+      return result;
+    }
+    if (last - result.ptr < D::scale + 1) {
+      return {last, std::errc::value_too_large};
+    }
+    *result.ptr++ = '.';
+    auto fraction = static_cast<unsigned_type>(magnitude % k_divisor);
+    for (auto digit = D::scale; digit-- > 0;) {
+      result.ptr[digit] = static_cast<char>('0' + fraction % 10U);
+      fraction /= 10U;
+    }
+    result.ptr += D::scale;
+  }
+  return result;
+}
+
+/// \brief Parse a decimal from `[first, last)`.
+/// \details The accepted pattern is an optional `-` for signed mantissas, followed by digits with an optional decimal
+/// point, with at least one digit. Decimal places beyond the scale are rounded with the rounding mode of the decimal.
+/// The result is as for `std::from_chars`: `std::errc::invalid_argument` if no number is found and
+/// `std::errc::result_out_of_range` if the number does not fit, in both cases leaving `value` unmodified.
+template <std::integral Rep, decimal_tag D>
+constexpr auto from_chars(const char* first, const char* last, strong_type<Rep, D>& value) noexcept
+    -> std::from_chars_result {
+  using unsigned_type = std::make_unsigned_t<Rep>;
+  constexpr auto is_digit = [](char character) { return character >= '0' && character <= '9'; };
+
+  auto ptr = first;
+  auto negative = false;
+  if constexpr (std::signed_integral<Rep>) {
+    if (ptr != last && *ptr == '-') {
+      negative = true;
+      ++ptr;
+    }
+  }
+
+  auto magnitude = unsigned_type{};
+  auto overflow = false;
+  const auto append = [&magnitude, &overflow](unsigned digit) {
+    auto shifted = unsigned_type{};
+    overflow |= detail::mul_overflow(magnitude, static_cast<unsigned_type>(10U), shifted);
+    overflow |= detail::add_overflow(shifted, static_cast<unsigned_type>(digit), magnitude);
+  };
+
+  auto digits = 0;
+  for (; ptr != last && is_digit(*ptr); ++ptr, ++digits) {
+    append(static_cast<unsigned>(*ptr - '0'));
+  }
+
+  auto places = 0;
+  auto first_dropped = 0U;
+  auto sticky = false;
+  if (ptr != last && *ptr == '.' && (digits > 0 || (ptr + 1 != last && is_digit(ptr[1])))) {
+    for (++ptr; ptr != last && is_digit(*ptr); ++ptr, ++digits) {
+      const auto digit = static_cast<unsigned>(*ptr - '0');
+      if (places < D::scale) {
+        append(digit);
+        ++places;
+      } else if (places++ == D::scale) {
+        first_dropped = digit;
+      } else {
+        sticky |= digit != 0U;
+      }
+    }
+  }
+  if (digits == 0) {
+    return {first, std::errc::invalid_argument};
+  }
+  for (; places < D::scale; ++places) {
+    append(0U);
+  }
+
+  const auto inexact = first_dropped != 0U || sticky;
+  auto round_away = false;
+  if constexpr (D::rounding_mode == rounding::downward) {
+    round_away = negative && inexact;
+  } else if constexpr (D::rounding_mode == rounding::upward) {
+    round_away = !negative && inexact;
+  } else if constexpr (D::rounding_mode == rounding::half_away_from_zero) {
+    round_away = first_dropped >= 5U;
+  } else if constexpr (D::rounding_mode == rounding::half_even) {
+    round_away = first_dropped > 5U || (first_dropped == 5U && (sticky || magnitude % 2U != 0U));
+  }
+  if (round_away) {
+    overflow |= detail::add_overflow(magnitude, unsigned_type{1U}, magnitude);
+  }
+
+  constexpr auto k_max = static_cast<unsigned_type>(std::numeric_limits<Rep>::max());
+  if (overflow || magnitude > k_max + (negative ? 1U : 0U)) {
+    return {ptr, std::errc::result_out_of_range};
+  }
+  value = strong_type<Rep, D>{negative ? static_cast<Rep>(unsigned_type{0} - magnitude) : static_cast<Rep>(magnitude)};
+  return {ptr, std::errc{}};
+}
+
+//
+// Stream operators
+//
+
+/// \brief inserts the formatted decimal
+template <std::integral Rep, decimal_tag D>
+auto operator<<(std::ostream& ostream, const strong_type<Rep, D>& rhs) -> std::ostream& {
+  auto buffer = std::array<char, detail::k_decimal_chars<Rep>>{};
+  const auto result = to_chars(buffer.data(), buffer.data() + buffer.size(), rhs);
+  return ostream << std::string_view{buffer.data(), result.ptr};
+}
+
+/// \brief extracts a decimal, setting `failbit` if the next word is not a decimal of the scale
+template <std::integral Rep, decimal_tag D>
+auto operator>>(std::istream& istream, strong_type<Rep, D>& rhs) -> std::istream& {
+  auto word = std::string{};
+  if (istream >> word) {
+    const auto result = from_chars(word.data(), word.data() + word.size(), rhs);
+    if (result.ec != std::errc{} || result.ptr != word.data() + word.size()) {
+      istream.setstate(std::ios_base::failbit);
+    }
+  }
+  return istream;
+}
+
+}  // namespace gw
+
+namespace std {
+
+//
+// String conversion
+//
+
+/// \brief Format the `gw::decimal` object.
+///
+template <integral Rep, ::gw::decimal_tag Tag, class CharT>
+// NOLINTNEXTLINE(cert-dcl58-cpp)
+struct formatter<::gw::strong_type<Rep, Tag>, CharT> {
+  /// \brief Parse the format string.
+  ///
+  template <class ParseContext>
+  constexpr auto parse(ParseContext& context) -> ParseContext::iterator {
+    return context.begin();
+  }
+
+  /// \brief Format the `gw::decimal` object.
+  ///
+  template <class FormatContext>
+  auto format(const ::gw::strong_type<Rep, Tag>& decimal, FormatContext& context) const -> FormatContext::iterator {
+    auto buffer = array<char, ::gw::detail::k_decimal_chars<Rep>>{};
+    const auto result = ::gw::to_chars(buffer.data(), buffer.data() + buffer.size(), decimal);
+    return std::copy(buffer.data(), result.ptr, context.out());
+  }
+};
+
+}  // namespace std
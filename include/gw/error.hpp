@@ -0,0 +1,105 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "gw/config.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+/// \brief The kind of an error, which is named after the exception that gw throws for it.
+enum class error_kind : std::uint8_t {
+  bad_optional_access,  ///< `std::bad_optional_access`
+  format_error,         ///< `std::format_error`
+  invalid_argument,     ///< `std::invalid_argument`
+  length_error,         ///< `std::length_error`
+  out_of_range,         ///< `std::out_of_range`
+  overflow_error,       ///< `std::overflow_error`
+};
+
+/// \brief Handler of the errors of gw with GW_NO_EXCEPTIONS.
+/// \details The handler must not return, e.g. it logs the message and terminates. If it returns, gw terminates.
+using error_handler = void (*)(error_kind kind, std::string_view message);
+
+namespace detail {
+
+inline constinit auto error_handler_pointer = std::atomic<error_handler>{nullptr};
+
+/// \brief Return the kind of the errors that gw throws as `Exception`.
+template <typename Exception>
+consteval auto error_kind_of() noexcept -> error_kind {
+  if constexpr (std::same_as<Exception, std::bad_optional_access>) {
+    return error_kind::bad_optional_access;
+  } else if constexpr (std::same_as<Exception, std::format_error>) {
+    return error_kind::format_error;
+  } else if constexpr (std::same_as<Exception, std::invalid_argument>) {
+    return error_kind::invalid_argument;
+  } else if constexpr (std::same_as<Exception, std::length_error>) {
+    return error_kind::length_error;
+  } else if constexpr (std::same_as<Exception, std::out_of_range>) {
+    return error_kind::out_of_range;
+  } else {
+    static_assert(std::same_as<Exception, std::overflow_error>, "gw::error_kind: unsupported exception");
+    return error_kind::overflow_error;
+  }
+}
+
+}  // namespace detail
+
+/// \brief Set the handler of the errors of gw with GW_NO_EXCEPTIONS.
+/// \param handler The new handler, or `nullptr` to terminate without calling a handler.
+/// \return The previous handler.
+inline auto set_error_handler(error_handler handler) noexcept -> error_handler {
+  return detail::error_handler_pointer.exchange(handler, std::memory_order_acq_rel);
+}
+
+/// \brief Get the handler of the errors of gw with GW_NO_EXCEPTIONS.
+/// \return The current handler, or `nullptr` if none is set.
+inline auto get_error_handler() noexcept -> error_handler {
+  return detail::error_handler_pointer.load(std::memory_order_acquire);
+}
+
+namespace detail {
+
+// The configuration is part of the mangled name of throw_error, so that the two definitions are distinct entities
+#if defined(GW_NO_EXCEPTIONS)
+inline namespace no_exceptions {
+#else
+inline namespace exceptions {
+#endif  // defined(GW_NO_EXCEPTIONS)
+
+/// \brief Throw `Exception` with `message`, or with GW_NO_EXCEPTIONS, call the error handler and terminate.
+/// \details Out of line, so that the functions that check for errors stay small enough to be inlined. GW_NO_EXCEPTIONS
+/// must be the same for the whole program, see gw/config.hpp.
+template <typename Exception>
+[[noreturn]] GW_NOINLINE void throw_error(std::string_view message) {
+#if defined(GW_NO_EXCEPTIONS)
+  if (const auto handler = get_error_handler(); handler != nullptr) {
+    handler(error_kind_of<Exception>(), message);
+  }
+  std::terminate();
+#else
+  if constexpr (std::constructible_from<Exception, std::string>) {
+    throw Exception{std::string{message}};
+  } else {
+    throw Exception{};
+  }
+#endif  // defined(GW_NO_EXCEPTIONS)
+}
+
+}  // namespace no_exceptions or exceptions
+
+}  // namespace detail
+
+}  // namespace gw
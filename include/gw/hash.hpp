@@ -0,0 +1,140 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "gw/concepts.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+//
+// Compile-time string hashing
+//
+
+/// \brief The 64-bit FNV-1a offset basis.
+inline constexpr std::uint64_t k_fnv1a_offset_basis = 0xcbf29ce484222325ULL;
+
+/// \brief The 64-bit FNV-1a prime.
+inline constexpr std::uint64_t k_fnv1a_prime = 0x100000001b3ULL;
+
+/// \brief Calculate the 64-bit FNV-1a hash of a character sequence.
+/// \details Characters wider than one byte are hashed byte by byte in little-endian order, so the result does not
+/// depend on the byte order of the target platform.
+/// \param str The character sequence to hash.
+/// \return The 64-bit FNV-1a hash of `str`.
+template <typename CharT, typename Traits>
+constexpr auto fnv1a(std::basic_string_view<CharT, Traits> str) noexcept -> std::uint64_t {
+  auto hash = k_fnv1a_offset_basis;
+  for (const auto ch : str) {
+    auto bits = static_cast<std::make_unsigned_t<CharT>>(ch);
+    for (std::size_t byte = 0U; byte < sizeof(CharT); ++byte) {
+      hash ^= static_cast<std::uint64_t>(bits & 0xFFU);
+      hash *= k_fnv1a_prime;
+      bits = static_cast<std::make_unsigned_t<CharT>>(bits >> 8U);  // NOLINT(hicpp-signed-bitwise)
+    }
+  }
+  return hash;
+}
+
+/// \brief Calculate the 64-bit FNV-1a hash of a null-terminated character string.
+/// \param str The character string to hash.
+/// \return The 64-bit FNV-1a hash of `str`.
+template <typename CharT>
+constexpr auto fnv1a(const CharT* str) noexcept -> std::uint64_t {
+  return fnv1a(std::basic_string_view<CharT>{str});
+}
+
+//
+// Compile-time type identity
+//
+
+/// \brief Return the name of the type `T` as spelled by the compiler.
+/// \details The name is extracted from the decorated function signature, so it is available at compile time and does
+/// not require RTTI. The spelling is compiler specific, but stable across builds with the same compiler.
+template <typename T>
+consteval auto type_name() noexcept -> std::string_view {
+#if defined(_MSC_VER) && !defined(__clang__)
+  constexpr auto signature = std::string_view{__FUNCSIG__};
+  constexpr auto prefix = std::string_view{"type_name<"};
+  constexpr auto first = signature.find(prefix) + prefix.size();
+  constexpr auto last = signature.rfind(">(void)");
+#else
+  // GCC: "... type_name() [with T = int; std::string_view = ...]", Clang: "... type_name() [T = int]"
+  constexpr auto signature = std::string_view{__PRETTY_FUNCTION__};
+  constexpr auto prefix = std::string_view{"T = "};
+  constexpr auto first = signature.find(prefix) + prefix.size();
+  constexpr auto last = signature.find(';', first) != std::string_view::npos ? signature.find(';', first)
+                                                                              : signature.rfind(']');
+#endif
+  static_assert(first < last, "gw::type_name: unsupported compiler");
+  return signature.substr(first, last - first);
+}
+
+/// \brief A stable 64-bit identity of the type `T`, computed at compile time.
+/// \details If `T` provides a `static constexpr name()` function, its result is hashed, which makes the identity
+/// portable across compilers and suitable for persisted hash indexes. Otherwise the compiler's spelling of the type
+/// name is hashed, which is stable across builds with the same compiler.
+template <typename T>
+inline constexpr std::uint64_t type_hash_v = [] {
+  if constexpr (requires { typename std::integral_constant<std::uint64_t, fnv1a(std::string_view{T::name()})>; }) {
+    return fnv1a(std::string_view{T::name()});
+  } else {
+    return fnv1a(type_name<T>());
+  }
+}();
+
+//
+// Hash mixing
+//
+
+/// \brief Mix the bits of a 64-bit value, so that every input bit affects every output bit.
+/// \details This is the SplitMix64 finalizer. It turns hashes that differ only in their low bits, such as the identity
+/// hashes of sequential integers, into hashes that spread evenly over power-of-two tables.
+/// \param value The value to mix.
+/// \return The mixed value.
+constexpr auto hash_mix(std::uint64_t value) noexcept -> std::uint64_t {
+  value ^= value >> 30U;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27U;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31U;
+  return value;
+}
+
+/// \brief Combine a hash value into a seed.
+/// \param seed The hash accumulated so far.
+/// \param value The hash value to combine into `seed`.
+/// \return The combined hash.
+constexpr auto hash_combine(std::size_t seed, std::size_t value) noexcept -> std::size_t {
+  constexpr auto k_golden_ratio = std::uint64_t{0x9e3779b97f4a7c15ULL};
+  return static_cast<std::size_t>(hash_mix(static_cast<std::uint64_t>(seed) + k_golden_ratio + value));
+}
+
+/// \brief Calculate the hash of a composite key.
+/// \details The elements are hashed with `std::hash` and combined in order with `gw::hash_combine`.
+/// \param values The elements of the key.
+/// \return The hash of the composite key.
+template <hashable... Ts>
+constexpr auto hash_tuple(const Ts&... values) noexcept -> std::size_t {
+  auto seed = std::size_t{};
+  ((seed = hash_combine(seed, std::hash<Ts>{}(values))), ...);
+  return seed;
+}
+
+/// \brief Calculate the hash of a composite key.
+/// \param values The elements of the key.
+/// \return The hash of the composite key.
+template <hashable... Ts>
+constexpr auto hash_tuple(const std::tuple<Ts...>& values) noexcept -> std::size_t {
+  return std::apply([](const auto&... elements) { return hash_tuple(elements...); }, values);
+}
+
+}  // namespace gw
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <concepts>
 #include <cstddef>
 #include <format>
@@ -15,14 +16,192 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
+#include "gw/config.hpp"
+#include "gw/error.hpp"
+
 /// \brief GW namespace
 namespace gw {
 
+//
+// Instrumentation
+//
+
+/// \brief Whether gw::basic_inplace_string reports its events to the gw::inplace_string_sink.
+/// \details The instrumentation is enabled by defining `GW_INPLACE_STRING_INSTRUMENTATION`, e.g. with the CMake option
+/// of the same name, which must be done consistently for the whole program. When it is disabled, the hooks are
+/// discarded at compile time and the strings do not touch the sink.
+#if defined(GW_INPLACE_STRING_INSTRUMENTATION)
+inline constexpr bool k_inplace_string_instrumentation = true;
+#else
+inline constexpr bool k_inplace_string_instrumentation = false;
+#endif  // defined(GW_INPLACE_STRING_INSTRUMENTATION)
+
+/// \brief Receives the events of instrumented gw::basic_inplace_string objects.
+/// \details The events identify the strings by their capacity. They are reported from the thread that operates on the
+/// string, so sinks that are shared between threads must synchronize. Events are not reported during constant
+/// evaluation.
+class inplace_string_sink {
+ public:
+  /// \brief Destructor.
+  virtual ~inplace_string_sink() = default;
+
+  /// \brief called when `size` scans a string of `length` characters
+  virtual void size_scanned(std::size_t capacity, std::size_t length) noexcept = 0;
+
+  /// \brief called when `insert`, `append`, `operator+=` or `operator+` copy `bytes` bytes
+  virtual void bytes_copied(std::size_t capacity, std::size_t bytes) noexcept = 0;
+
+  /// \brief called before a `std::length_error` is thrown, because `requested` characters exceed the capacity
+  virtual void overflowed(std::size_t capacity, std::size_t requested) noexcept = 0;
+
+  /// \brief called when a constructor or a modifier other than `clear` and `pop_back` leaves `length` characters
+  virtual void length_reached(std::size_t capacity, std::size_t length) noexcept = 0;
+
+ protected:
+  inplace_string_sink() = default;
+  inplace_string_sink(const inplace_string_sink&) = default;
+  inplace_string_sink(inplace_string_sink&&) = default;
+  auto operator=(const inplace_string_sink&) -> inplace_string_sink& = default;
+  auto operator=(inplace_string_sink&&) -> inplace_string_sink& = default;
+};
+
+namespace detail {
+
+inline constinit auto inplace_string_sink_pointer = std::atomic<inplace_string_sink*>{nullptr};
+
+/// \brief Call `event` with the current sink, if the instrumentation is enabled and a sink is set.
+template <typename Event>
+constexpr void report_inplace_string_event(Event event) noexcept {
+  if constexpr (k_inplace_string_instrumentation) {
+    if (!std::is_constant_evaluated()) {
+      if (auto* const sink = inplace_string_sink_pointer.load(std::memory_order_acquire); sink != nullptr) {
+        event(*sink);
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+/// \brief Set the sink that instrumented gw::basic_inplace_string objects report to.
+/// \param sink The new sink, which must outlive its use, or `nullptr` to stop reporting.
+/// \return The previous sink.
+inline auto set_inplace_string_sink(inplace_string_sink* sink) noexcept -> inplace_string_sink* {
+  return detail::inplace_string_sink_pointer.exchange(sink, std::memory_order_acq_rel);
+}
+
+/// \brief Get the sink that instrumented gw::basic_inplace_string objects report to.
+/// \return The current sink, or `nullptr` if none is set.
+inline auto get_inplace_string_sink() noexcept -> inplace_string_sink* {
+  return detail::inplace_string_sink_pointer.load(std::memory_order_acquire);
+}
+
+//
+// Capacity-erased core
+//
+
+namespace detail {
+
+/// \brief Report that `bytes` bytes were copied into a string with capacity `capacity`.
+constexpr void report_inplace_string_copy(std::size_t capacity, std::size_t bytes) noexcept {
+  report_inplace_string_event([capacity, bytes](inplace_string_sink& sink) { sink.bytes_copied(capacity, bytes); });
+}
+
+/// \brief Report that a string with capacity `capacity` was left with `length` characters.
+constexpr void report_inplace_string_length(std::size_t capacity, std::size_t length) noexcept {
+  report_inplace_string_event([capacity, length](inplace_string_sink& sink) { sink.length_reached(capacity, length); });
+}
+
+/// \brief Report the overflow of a string with capacity `capacity`, and throw the `std::length_error` of it.
+[[noreturn]] GW_NOINLINE inline void throw_inplace_string_length_error(const char* function, const char* name,
+                                                                       std::size_t requested, std::size_t capacity) {
+  report_inplace_string_event(
+      [capacity, requested](inplace_string_sink& sink) { sink.overflowed(capacity, requested); });
+  detail::throw_error<std::length_error>(std::format(
+      "basic_inplace_string::{}: {} (which is {}) > max_size (which is {})", function, name, requested, capacity));
+}
+
+/// \brief Throw the `std::out_of_range` of the position `pos`, which is not below `bound`.
+[[noreturn]] GW_NOINLINE inline void throw_inplace_string_out_of_range(const char* function, const char* name,
+                                                                       std::size_t pos, const char* bound_name,
+                                                                       std::size_t bound) {
+  detail::throw_error<std::out_of_range>(std::format("basic_inplace_string::{}: {} (which is {}) >= {} (which is {})",
+                                                     function, name, pos, bound_name, bound));
+}
+
+/// \brief Throw the `std::length_error` of a string with capacity `capacity`, if `requested` exceeds it.
+constexpr void check_inplace_string_length(const char* function, const char* name, std::size_t requested,
+                                           std::size_t capacity) {
+  if (requested > capacity) [[unlikely]] {
+    throw_inplace_string_length_error(function, name, requested, capacity);
+  }
+}
+
+/// \brief Make room for `count` characters at `index` of the null-terminated string `data` with capacity `capacity`.
+/// \details This and the following algorithms depend on the character traits only, so all capacities share them.
+/// \return A pointer to the first character of the room.
+template <class Traits>
+GW_NOINLINE constexpr auto inplace_string_open(typename Traits::char_type* data, std::size_t capacity,
+                                               std::size_t index, std::size_t count, const char* function) ->
+    typename Traits::char_type* {
+  const auto size = Traits::length(data);
+  const auto new_size = size + count;
+  check_inplace_string_length(function, "new_size", new_size, capacity);
+  report_inplace_string_copy(capacity, (new_size - index) * sizeof(typename Traits::char_type));
+  const auto room = std::ranges::next(data, index);
+  Traits::move(std::ranges::next(room, count), room, size - index);
+  Traits::assign(*std::ranges::next(data, new_size), typename Traits::char_type{});  // Ensure null termination
+  report_inplace_string_length(capacity, new_size);
+  return room;
+}
+
+/// \brief Insert the characters in the range [str, str + count) at `index` of the string `data`.
+template <class Traits>
+GW_NOINLINE constexpr void inplace_string_insert(typename Traits::char_type* data, std::size_t capacity,
+                                                 std::size_t index, const typename Traits::char_type* str,
+                                                 std::size_t count) {
+  Traits::copy(inplace_string_open<Traits>(data, capacity, index, count, "insert"), str, count);
+}
+
+/// \brief Append the characters in the range [str, str + count) to the string `data`.
+template <class Traits>
+GW_NOINLINE constexpr void inplace_string_append(typename Traits::char_type* data, std::size_t capacity,
+                                                 const typename Traits::char_type* str, std::size_t count,
+                                                 const char* function) {
+  const auto size = Traits::length(data);
+  const auto new_size = size + count;
+  check_inplace_string_length(function, "new_size", new_size, capacity);
+  report_inplace_string_copy(capacity, count * sizeof(typename Traits::char_type));
+  Traits::copy(std::ranges::next(data, size), str, count);
+  Traits::assign(*std::ranges::next(data, new_size), typename Traits::char_type{});  // Ensure null termination
+  report_inplace_string_length(capacity, new_size);
+}
+
+/// \brief Erase up to `count` characters from `index` of the string `data`.
+template <class Traits>
+GW_NOINLINE constexpr void inplace_string_erase(typename Traits::char_type* data, std::size_t capacity,
+                                                std::size_t index, std::size_t count) {
+  const auto size = Traits::length(data);
+  if (index >= size) [[unlikely]] {
+    throw_inplace_string_out_of_range("erase", "index", index, "size", size);
+  }
+  const auto new_size = size - std::ranges::min(count, size - index);
+  const auto first = std::ranges::next(data, index);
+  Traits::move(first, std::ranges::next(first, size - new_size), new_size - index);
+  Traits::assign(*std::ranges::next(data, new_size), typename Traits::char_type{});  // Ensure null termination
+  report_inplace_string_length(capacity, new_size);
+}
+
+}  // namespace detail
+
 /// \example inplace_string_example.cpp
 //
 /// \brief A fixed-size string that stores the data in-place.
+/// \details The algorithms that do not depend on the capacity, such as `insert`, `erase` and `append`, and the throw
+/// paths are shared by all capacities with the same character traits. Every capacity adds only thin inline wrappers.
 /// \tparam N The size of the string.
 /// \tparam CharT The character type.
 /// \tparam Traits The character traits type.
@@ -66,12 +245,9 @@ class basic_inplace_string {
   /// \param ch The character to initialize the string with.
   /// \throw std::length_error If count is greater than `max_size`.
   constexpr basic_inplace_string(size_type count, value_type ch) : m_data{} {
-    if (count > max_size()) {
-      throw std::length_error{
-          std::format("basic_inplace_string::basic_inplace_string: count (which is {}) > max_size (which is {})", count,
-                      max_size())};
-    }
-    std::ranges::fill_n(begin(), count, ch);
+    detail::check_inplace_string_length("basic_inplace_string", "count", count, N);
+    traits_type::assign(data(), count, ch);
+    report_length(count);
   }
 
   /// \brief Construct the string with the characters from the character string pointed to by `str`.
@@ -79,14 +255,9 @@ class basic_inplace_string {
   /// \throw std::length_error If the size of `str` would exceed `max_size`.
   constexpr explicit basic_inplace_string(const value_type* str) : m_data{} {
     const auto str_size = traits_type::length(str);
-
-    if (str_size > max_size()) {
-      throw std::length_error{
-          std::format("basic_inplace_string::basic_inplace_string: str_size (which is {}) > max_size (which is {})",
-                      str_size, max_size())};
-    }
-
+    detail::check_inplace_string_length("basic_inplace_string", "str_size", str_size, N);
     traits_type::copy(begin(), str, str_size);
+    report_length(str_size);
   }
 
   /// \brief Construct the string with the contents of the range [str, str + count).
@@ -94,12 +265,9 @@ class basic_inplace_string {
   /// \param count The number of characters to initialize the string with.
   /// \throw std::length_error If `count` is greater than `max_size`.
   constexpr explicit basic_inplace_string(const value_type* str, size_type count) : m_data{} {
-    if (count > max_size()) {
-      throw std::length_error{
-          std::format("basic_inplace_string::basic_inplace_string: count (which is {}) > max_size (which is {})", count,
-                      max_size())};
-    }
+    detail::check_inplace_string_length("basic_inplace_string", "count", count, N);
     traits_type::copy(begin(), str, count);
+    report_length(count);
   }
 
   /// \brief Construct the string with the contents of the range [first, last).
@@ -109,15 +277,10 @@ class basic_inplace_string {
   /// \throw std::length_error If the size of the range would exceed `max_size`.
   template <std::input_iterator InputIt>
   constexpr explicit basic_inplace_string(InputIt first, InputIt last) : m_data{} {
-    const auto str_size = std::ranges::distance(first, last);
-
-    if (str_size > max_size()) {
-      throw std::length_error{
-          std::format("basic_inplace_string::basic_inplace_string: str_size (which is {}) > max_size (which is {})",
-                      str_size, max_size())};
-    }
-
+    const auto str_size = static_cast<size_type>(std::ranges::distance(first, last));
+    detail::check_inplace_string_length("basic_inplace_string", "str_size", str_size, N);
     std::ranges::copy(first, last, begin());
+    report_length(str_size);
   }
 
   /// \brief Construct the string with the contents of the string view.
@@ -155,10 +318,10 @@ class basic_inplace_string {
   /// \return A reference to the character at the specified position.
   /// \throw std::out_of_range If `pos` is out of range.
   constexpr auto at(size_type pos) -> reference {
-    return pos < size()
-               ? m_data[pos]
-               : throw std::out_of_range{std::format(
-                     "basic_inplace_string::at: pos (which is {}) >= max_size (which is {})", pos, max_size())};
+    if (pos >= size()) [[unlikely]] {
+      detail::throw_inplace_string_out_of_range("at", "pos", pos, "max_size", N);
+    }
+    return m_data[pos];
   }
 
   /// \brief Get a const reference to the character at the specified position.
@@ -166,10 +329,10 @@ class basic_inplace_string {
   /// \return A const reference to the character at the specified position.
   /// \throw std::out_of_range If `pos` is out of range.
   constexpr auto at(size_type pos) const -> const_reference {
-    return pos < size()
-               ? m_data[pos]
-               : throw std::out_of_range{std::format(
-                     "basic_inplace_string::at: pos (which is {}) >= max_size (which is {})", pos, max_size())};
+    if (pos >= size()) [[unlikely]] {
+      detail::throw_inplace_string_out_of_range("at", "pos", pos, "max_size", N);
+    }
+    return m_data[pos];
   }
 
   /// \brief Get a reference to the character at the specified position.
@@ -274,7 +437,11 @@ class basic_inplace_string {
 
   /// \brief Get the size of the string.
   /// \return The size of the string.
-  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return traits_type::length(data()); }
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+    const auto length = traits_type::length(data());
+    report_size_scan(length);
+    return length;
+  }
 
   /// \brief Get the length of the string.
   /// \return The length of the string.
@@ -288,12 +455,7 @@ class basic_inplace_string {
   /// \param new_cap The new capacity of the string.
   /// \throw std::length_error If `new_cap` is greater than `max_size`.
   /// \note This function does nothing.
-  constexpr void reserve(size_type new_cap) {
-    if (new_cap > max_size()) {
-      throw std::length_error{std::format(
-          "basic_inplace_string::reserve: new_cap (which is {}) > max_size (which is {})", new_cap, max_size())};
-    }
-  }
+  constexpr void reserve(size_type new_cap) { detail::check_inplace_string_length("reserve", "new_cap", new_cap, N); }
 
   /// \brief Get the capacity of the string.
   /// \return The capacity of the string.
@@ -312,14 +474,7 @@ class basic_inplace_string {
   /// \param ch The character to insert.
   /// \throw std::length_error If the size of the string would exceed `max_size`.
   constexpr void insert(size_type index, size_type count, CharT ch) {
-    const auto new_size = size() + count;
-    if (new_size > max_size()) {
-      throw std::length_error{std::format(
-          "basic_inplace_string::insert: new_size (which is {}) > max_size (which is {})", new_size, max_size())};
-    }
-    std::ranges::copy_backward(std::ranges::next(begin(), index), end(), std::ranges::next(end(), count));
-    std::ranges::fill_n(std::ranges::next(begin(), index), count, ch);
-    m_data[new_size] = value_type{};  // Ensure null termination
+    traits_type::assign(detail::inplace_string_open<traits_type>(data(), N, index, count, "insert"), count, ch);
   }
 
   /// \brief Insert the null-terminated character string pointed to by `str` at the position `index`.
@@ -339,14 +494,7 @@ class basic_inplace_string {
   /// \return A reference to the string.
   /// \throw std::length_error If the size of the string would exceed `max_size`.
   auto insert(size_type index, const value_type* str, size_type count) -> basic_inplace_string& {
-    const auto new_size = size() + count;
-    if (new_size > max_size()) {
-      throw std::length_error{std::format(
-          "basic_inplace_string::insert: new_size (which is {}) > max_size (which is {})", new_size, max_size())};
-    }
-    std::ranges::copy_backward(std::ranges::next(begin(), index), end(), std::ranges::next(end(), count));
-    traits_type::copy(std::ranges::next(begin(), index), str, count);
-    m_data[new_size] = value_type{};  // Ensure null termination
+    detail::inplace_string_insert<traits_type>(data(), N, index, str, count);
     return *this;
   }
 
@@ -389,17 +537,11 @@ class basic_inplace_string {
   auto insert(const_iterator pos, InputIt first, InputIt last) -> iterator
     requires std::convertible_to<std::iter_value_t<InputIt>, value_type>
   {
-    const auto index = std::ranges::distance(cbegin(), pos);
-    const auto count = std::ranges::distance(first, last);
-    const auto new_size = size() + count;
-    if (new_size > max_size()) {
-      throw std::length_error{std::format(
-          "basic_inplace_string::insert: new_size (which is {}) > max_size (which is {})", new_size, max_size())};
-    }
-    std::ranges::copy_backward(std::ranges::next(begin(), index), end(), std::ranges::next(end(), count));
-    std::ranges::copy(first, last, std::ranges::next(begin(), index));
-    m_data[new_size] = value_type{};  // Ensure null termination
-    return std::ranges::next(begin(), index);
+    const auto index = static_cast<size_type>(std::ranges::distance(cbegin(), pos));
+    const auto count = static_cast<size_type>(std::ranges::distance(first, last));
+    const auto room = detail::inplace_string_open<traits_type>(data(), N, index, count, "insert");
+    std::ranges::copy(first, last, room);
+    return room;
   }
 
   /// \brief Insert the characters from the range before the element (if any) pointed by `pos`.
@@ -420,27 +562,19 @@ class basic_inplace_string {
   /// \param count The number of characters to erase.
   /// \throw std::out_of_range If `index` is greater than or equal to the size of the string.
   constexpr void erase(size_type index = 0U, size_type count = npos) {
-    if (index >= size()) {
-      throw std::out_of_range{
-          std::format("basic_inplace_string::erase: index (which is {}) >= size (which is {})", index, size())};
-    }
-    const auto no_of_chars_to_erase = std::ranges::min(count, size() - index);
-    const auto new_size = size() - no_of_chars_to_erase;
-    std::ranges::copy(std::ranges::next(begin(), index + count), end(), std::ranges::next(begin(), index));
-    m_data[new_size] = value_type{};  // Ensure null termination
+    detail::inplace_string_erase<traits_type>(data(), N, index, count);
   }
 
   /// \brief Append a character to the end of the string.
   /// \param ch The character to append.
   /// \throw std::length_error If the size of the string would exceed `max_size`.
   constexpr void push_back(value_type ch) {
-    const auto new_size = size() + 1;
-    if (new_size > max_size()) {
-      throw std::length_error{std::format(
-          "basic_inplace_string::push_back: new_size (which is {}) > max_size (which is {})", new_size, max_size())};
-    }
-    m_data[size()] = ch;
+    const auto old_size = size();
+    const auto new_size = old_size + 1U;
+    detail::check_inplace_string_length("push_back", "new_size", new_size, N);
+    m_data[old_size] = ch;
     m_data[new_size] = value_type{};  // Ensure null termination
+    report_length(new_size);
   }
 
   /// \brief Remove the last character from the string.
@@ -452,13 +586,7 @@ class basic_inplace_string {
   /// \throw std::length_error If the size of the string would exceed `max_size`.
   template <std::size_t N2>
   constexpr void append(const basic_inplace_string<N2, value_type, traits_type>& str) {
-    const auto new_size = size() + str.size();
-    if (new_size > max_size()) {
-      throw std::length_error{std::format(
-          "basic_inplace_string::append: new_size (which is {}) > max_size (which is {})", new_size, max_size())};
-    }
-    traits_type::copy(end(), str.data(), str.size());
-    m_data[new_size] = value_type{};  // Ensure null termination
+    detail::inplace_string_append<traits_type>(data(), N, str.data(), str.size(), "append");
   }
 
   /// \brief Append a string to the end of the string.
@@ -467,13 +595,7 @@ class basic_inplace_string {
   /// \throw std::length_error If the size of the string would exceed `max_size`.
   template <std::size_t N2>
   constexpr auto operator+=(const basic_inplace_string<N2, value_type, traits_type>& str) -> basic_inplace_string& {
-    const auto new_size = size() + str.size();
-    if (new_size > max_size()) {
-      throw std::length_error{std::format(
-          "basic_inplace_string::operator+=: new_size (which is {}) > max_size (which is {})", new_size, max_size())};
-    }
-    traits_type::copy(end(), str.data(), str.size());
-    m_data[new_size] = value_type{};  // Ensure null termination
+    detail::inplace_string_append<traits_type>(data(), N, str.data(), str.size(), "operator+=");
     return *this;
   }
 
@@ -481,11 +603,9 @@ class basic_inplace_string {
   /// \param count The new size of the string.
   /// \throw std::length_error If `count` is greater than `max_size`.
   constexpr void resize(size_type count) {
-    if (count > max_size()) {
-      throw std::length_error{
-          std::format("basic_inplace_string::resize: count (which is {}) > max_size (which is {})", count, max_size())};
-    }
+    detail::check_inplace_string_length("resize", "count", count, N);
     m_data[count] = value_type{};  // Ensure null termination
+    report_length(count);
   }
 
   /// \brief Resize the string to `count` characters.
@@ -493,14 +613,12 @@ class basic_inplace_string {
   /// \param ch The character to fill the string with.
   /// \throw std::length_error If `count` is greater than `max_size`.
   constexpr void resize(size_type count, value_type ch) {
-    if (count > max_size()) {
-      throw std::length_error{
-          std::format("basic_inplace_string::resize: count (which is {}) > max_size (which is {})", count, max_size())};
-    }
-    if (count > size()) {
-      std::ranges::fill_n(end(), count - size(), ch);
+    detail::check_inplace_string_length("resize", "count", count, N);
+    if (const auto old_size = size(); count > old_size) {
+      traits_type::assign(std::ranges::next(data(), old_size), count - old_size, ch);
     }
     m_data[count] = value_type{};  // Ensure null termination
+    report_length(count);
   }
 
   /// \brief Swap the string with another string.
@@ -636,7 +754,11 @@ class basic_inplace_string {
                                   const basic_inplace_string<N2, value_type, traits_type>& rhs)
       -> basic_inplace_string<N + N2, value_type, traits_type> {
     const auto new_size = lhs.size() + rhs.size();
-    basic_inplace_string<N + N2, value_type, traits_type> result;
+    auto result = basic_inplace_string<N + N2, value_type, traits_type>{};
+    detail::report_inplace_string_event([new_size](inplace_string_sink& sink) {
+      sink.bytes_copied(N + N2, new_size * sizeof(value_type));
+      sink.length_reached(N + N2, new_size);
+    });
     traits_type::copy(result.data(), lhs.data(), lhs.size());
     traits_type::copy(std::ranges::next(result.data(), lhs.size()), rhs.data(), rhs.size());
     result[new_size] = value_type{};  // Ensure null termination
@@ -648,7 +770,7 @@ class basic_inplace_string {
   /// \param rhs The second string to compare.
   /// \return True if the strings are equal, false otherwise.
   friend constexpr auto operator==(const basic_inplace_string& lhs, const basic_inplace_string& rhs) noexcept -> bool {
-    return std::ranges::equal(lhs.begin(), lhs.end(), rhs.begin());
+    return lhs.view() == rhs.view();
   }
 
   /// \brief Compare the string to a string view.
@@ -657,7 +779,7 @@ class basic_inplace_string {
   /// \return True if the strings are equal, false otherwise.
   friend constexpr auto operator==(const basic_inplace_string& lhs,
                                    std::basic_string_view<value_type, traits_type> rhs) noexcept -> bool {
-    return std::ranges::equal(lhs.begin(), lhs.end(), rhs.begin());
+    return lhs.view() == rhs;
   }
 
   /// \brief Compare the string to a string view.
@@ -674,7 +796,7 @@ class basic_inplace_string {
   /// \param rhs The second string to compare.
   /// \return True if the strings are equal, false otherwise.
   friend constexpr auto operator==(const basic_inplace_string& lhs, const value_type* rhs) noexcept -> bool {
-    return traits_type::compare(lhs.data(), rhs, traits_type::length(rhs)) == 0;
+    return lhs.view() == std::basic_string_view<value_type, traits_type>{rhs};
   }
 
   /// \brief Compares the string to a character string.
@@ -742,18 +864,22 @@ class basic_inplace_string {
   /// \return The input stream.
   friend inline auto operator>>(std::basic_istream<value_type, traits_type>& istream,
                                 basic_inplace_string& rhs) -> std::basic_istream<value_type, traits_type>& {
-    const auto new_size = rhs.size() + istream.rdbuf()->in_avail();
-    if (new_size > rhs.max_size()) {
-      throw std::length_error{
-          std::format("basic_inplace_string::operator>>: new_size (which is {}) > max_size (which is {})", new_size,
-                      rhs.max_size())};
-    }
+    const auto new_size = rhs.size() + static_cast<size_type>(istream.rdbuf()->in_avail());
+    detail::check_inplace_string_length("operator>>", "new_size", new_size, N);
     const auto it = std::istreambuf_iterator<value_type, traits_type>{istream};
     const auto end = std::istreambuf_iterator<value_type, traits_type>{};
     std::ranges::copy(it, end, rhs.end());
     rhs[new_size] = value_type{};  // Ensure null termination
+    report_length(new_size);
     return istream;
   }
+
+ private:
+  static constexpr void report_size_scan(size_type length) noexcept {
+    detail::report_inplace_string_event([length](inplace_string_sink& sink) { sink.size_scanned(N, length); });
+  }
+
+  static constexpr void report_length(size_type length) noexcept { detail::report_inplace_string_length(N, length); }
 };
 
 /// \brief Deduction guide for basic_inplace_string.
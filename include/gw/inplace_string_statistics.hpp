@@ -0,0 +1,224 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "gw/inplace_string.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+/// \brief The lengths that the gw::basic_inplace_string objects of one capacity reached.
+struct inplace_string_capacity_statistics {
+  std::size_t capacity{};              ///< The capacity of the strings.
+  std::vector<std::uint64_t> lengths;  ///< How often the strings were left with each length, indexed by the length.
+  std::uint64_t overflows{};           ///< The number of operations that threw, because they exceeded the capacity.
+  std::size_t max_requested{};         ///< The longest length requested, including the overflows.
+
+  /// \brief returns the longest length reached
+  [[nodiscard]] auto high_water() const noexcept -> std::size_t {
+    const auto last = std::ranges::find_if(lengths.rbegin(), lengths.rend(), [](auto count) { return count != 0U; });
+    return last == lengths.rend() ? 0U : static_cast<std::size_t>(std::ranges::distance(last, lengths.rend()) - 1);
+  }
+
+  /// \brief returns the shortest length that `fraction` of the reached lengths do not exceed
+  [[nodiscard]] auto percentile(double fraction) const noexcept -> std::size_t {
+    auto total = std::uint64_t{};
+    for (const auto count : lengths) {
+      total += count;
+    }
+    auto seen = std::uint64_t{};
+    for (std::size_t length = 0U; length < lengths.size(); ++length) {
+      seen += lengths[length];
+      if (total != 0U && static_cast<double>(seen) >= fraction * static_cast<double>(total)) {
+        return length;
+      }
+    }
+    return 0U;
+  }
+};
+
+/// \example inplace_string_statistics_example.cpp
+//
+/// \brief A gw::inplace_string_sink that aggregates the events of instrumented gw::basic_inplace_string objects.
+/// \details The counters are relaxed atomics, and the lengths are collected per capacity under a mutex, so one object
+/// can be shared by all threads. The report shows per capacity the length that was reached at most, and the longest
+/// length that was requested, which is the capacity that would have been needed.
+///
+/// The events must not throw, so the storage for a capacity that is seen the first time is allocated without throwing,
+/// and if that fails, the event is dropped and counted in `dropped_events`. `reserve` allocates it in advance, after
+/// which the events of that capacity do not allocate.
+class inplace_string_statistics final : public inplace_string_sink {
+ public:
+  /// \brief Default constructor.
+  inplace_string_statistics() = default;
+
+  /// \brief counts the scan of `length` characters
+  void size_scanned(std::size_t /*capacity*/, std::size_t length) noexcept override {
+    m_size_scans.fetch_add(1U, std::memory_order_relaxed);
+    m_scanned_characters.fetch_add(length, std::memory_order_relaxed);
+  }
+
+  /// \brief counts the copy of `bytes` bytes
+  void bytes_copied(std::size_t /*capacity*/, std::size_t bytes) noexcept override {
+    m_bytes_copied.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  /// \brief counts the overflow of a string with capacity `capacity`
+  void overflowed(std::size_t capacity, std::size_t requested) noexcept override {
+    m_overflows.fetch_add(1U, std::memory_order_relaxed);
+    const auto lock = std::scoped_lock{m_mutex};
+    auto* const record = find_or_add(capacity);
+    if (record == nullptr) {
+      m_dropped_events.fetch_add(1U, std::memory_order_relaxed);
+      return;
+    }
+    ++record->overflows;
+    record->max_requested = std::max(record->max_requested, requested);
+  }
+
+  /// \brief counts that a string with capacity `capacity` was left with `length` characters
+  void length_reached(std::size_t capacity, std::size_t length) noexcept override {
+    const auto lock = std::scoped_lock{m_mutex};
+    auto* const record = find_or_add(capacity);
+    if (record == nullptr) {
+      m_dropped_events.fetch_add(1U, std::memory_order_relaxed);
+      return;
+    }
+    ++record->lengths[std::min(length, capacity)];
+    record->max_requested = std::max(record->max_requested, length);
+  }
+
+  /// \brief allocates the storage for the lengths of `capacity`, so that its events do not allocate
+  /// \return False if the storage could not be allocated.
+  auto reserve(std::size_t capacity) noexcept -> bool {
+    const auto lock = std::scoped_lock{m_mutex};
+    return find_or_add(capacity) != nullptr;
+  }
+
+  /// \brief returns the number of `size` scans
+  [[nodiscard]] auto size_scans() const noexcept -> std::uint64_t {
+    return m_size_scans.load(std::memory_order_relaxed);
+  }
+
+  /// \brief returns the number of characters that the `size` scans read
+  [[nodiscard]] auto scanned_characters() const noexcept -> std::uint64_t {
+    return m_scanned_characters.load(std::memory_order_relaxed);
+  }
+
+  /// \brief returns the number of bytes copied by `insert`, `append`, `operator+=` and `operator+`
+  [[nodiscard]] auto bytes_copied() const noexcept -> std::uint64_t {
+    return m_bytes_copied.load(std::memory_order_relaxed);
+  }
+
+  /// \brief returns the number of operations that threw, because they exceeded the capacity
+  [[nodiscard]] auto overflows() const noexcept -> std::uint64_t { return m_overflows.load(std::memory_order_relaxed); }
+
+  /// \brief returns the number of events that were dropped, because their storage could not be allocated
+  [[nodiscard]] auto dropped_events() const noexcept -> std::uint64_t {
+    return m_dropped_events.load(std::memory_order_relaxed);
+  }
+
+  /// \brief returns the lengths per capacity that had events, ordered by the capacity
+  [[nodiscard]] auto capacities() const -> std::vector<inplace_string_capacity_statistics> {
+    const auto lock = std::scoped_lock{m_mutex};
+    auto result = std::vector<inplace_string_capacity_statistics>{};
+    for (const auto* record = m_records.get(); record != nullptr; record = record->next.get()) {
+      const auto lengths = std::span{record->lengths.get(), record->capacity + 1U};
+      if (record->overflows != 0U || std::ranges::any_of(lengths, [](auto count) { return count != 0U; })) {
+        result.push_back({record->capacity, std::vector<std::uint64_t>(lengths.begin(), lengths.end()),
+                          record->overflows, record->max_requested});
+      }
+    }
+    return result;
+  }
+
+  /// \brief resets all counters and lengths, and keeps the storage of the capacities
+  void reset() noexcept {
+    m_size_scans.store(0U, std::memory_order_relaxed);
+    m_scanned_characters.store(0U, std::memory_order_relaxed);
+    m_bytes_copied.store(0U, std::memory_order_relaxed);
+    m_overflows.store(0U, std::memory_order_relaxed);
+    m_dropped_events.store(0U, std::memory_order_relaxed);
+    const auto lock = std::scoped_lock{m_mutex};
+    for (auto* record = m_records.get(); record != nullptr; record = record->next.get()) {
+      std::ranges::fill(std::span{record->lengths.get(), record->capacity + 1U}, std::uint64_t{});
+      record->overflows = 0U;
+      record->max_requested = 0U;
+    }
+  }
+
+  /// \brief writes a summary, and a table of the lengths per capacity, to `ostream`
+  void report(std::ostream& ostream) const {
+    ostream << std::format("inplace_string: {} size scans ({} characters), {} bytes copied, {} overflows\n",
+                           size_scans(), scanned_characters(), bytes_copied(), overflows());
+    if (const auto dropped = dropped_events(); dropped != 0U) {
+      ostream << std::format("inplace_string: {} events dropped, because their storage could not be allocated\n",
+                             dropped);
+    }
+    ostream << std::format("{:>10} {:>10} {:>10} {:>10} {:>10} {:>10}\n", "capacity", "p50", "p99", "high water",
+                           "requested", "overflows");
+    for (const auto& statistics : capacities()) {
+      ostream << std::format("{:>10} {:>10} {:>10} {:>10} {:>10} {:>10}\n", statistics.capacity,
+                             statistics.percentile(0.5), statistics.percentile(0.99), statistics.high_water(),
+                             statistics.max_requested, statistics.overflows);
+    }
+  }
+
+ private:
+  // The lengths of one capacity, in a list that is ordered by the capacity. The events allocate the records with
+  // std::nothrow, and without a try block, so that it builds without exceptions.
+  struct capacity_record {
+    std::size_t capacity{};
+    std::unique_ptr<std::uint64_t[]> lengths;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    std::uint64_t overflows{};
+    std::size_t max_requested{};
+    std::unique_ptr<capacity_record> next;
+  };
+
+  auto find_or_add(std::size_t capacity) noexcept -> capacity_record* {
+    auto* link = &m_records;
+    while (*link != nullptr && (*link)->capacity < capacity) {
+      link = &(*link)->next;
+    }
+    if (*link != nullptr && (*link)->capacity == capacity) {
+      return link->get();
+    }
+    auto record = std::unique_ptr<capacity_record>{new (std::nothrow) capacity_record{}};
+    if (record == nullptr) {
+      return nullptr;
+    }
+    record->capacity = capacity;
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    record->lengths.reset(new (std::nothrow) std::uint64_t[capacity + 1U]{});
+    if (record->lengths == nullptr) {
+      return nullptr;
+    }
+    record->next = std::move(*link);
+    *link = std::move(record);
+    return link->get();
+  }
+
+  std::atomic<std::uint64_t> m_size_scans{};
+  std::atomic<std::uint64_t> m_scanned_characters{};
+  std::atomic<std::uint64_t> m_bytes_copied{};
+  std::atomic<std::uint64_t> m_overflows{};
+  std::atomic<std::uint64_t> m_dropped_events{};
+  mutable std::mutex m_mutex;
+  std::unique_ptr<capacity_record> m_records;
+};
+
+}  // namespace gw
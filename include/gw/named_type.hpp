@@ -17,6 +17,9 @@
 #include <utility>
 
 #include "gw/concepts.hpp"
+#include "gw/config.hpp"
+#include "gw/error.hpp"
+#include "gw/hash.hpp"
 #include "gw/inplace_string.hpp"
 
 /// \brief GW namespace
@@ -28,8 +31,41 @@ struct named_type_empty_base {
   constexpr auto operator<=>(const named_type_empty_base&) const noexcept -> std::strong_ordering = default;
 };
 
+/// \brief The character traits of gw::name_of, which carry the name type `Id` instead of the characters of the name.
+template <typename Id>
+struct name_id_traits : std::char_traits<typename decltype(Id::name())::value_type> {
+  using id_type = Id;  ///< The type that provides the name.
+};
+
 }  // namespace detail
 
+//
+// Names
+//
+
+/// \brief A type that provides the name `Name` of a gw::named_type, see gw::name_of.
+template <basic_inplace_string Name>
+struct name_id {
+  /// \brief returns the name
+  GW_FORWARDING static constexpr auto name() noexcept { return Name.view(); }
+};
+
+/// \brief A name of a gw::named_type that refers to the type `Id`, instead of containing the characters of the name.
+/// \details The name of a gw::named_type is a template argument, so every character of it is part of the symbols of
+/// every function that uses the type. `gw::name_of<Id>` contains no characters, and its symbol contains only the name
+/// of `Id`, which provides the name with a static `name()` function that returns a `std::basic_string_view`:
+/// \code
+/// struct balance : gw::name_id<"account_balance_in_minor_currency_units"> {};
+/// using balance_t = gw::named_type<std::int64_t, gw::name_of<balance>>;
+/// static_assert(balance_t::name() == "account_balance_in_minor_currency_units");
+/// \endcode
+/// The gw::named_type is distinct from one that is named with the characters, but its name and its hash are the same.
+/// Every `gw::name_of<Id>` is a distinct instantiation of gw::basic_inplace_string, which costs compile time, so it
+/// pays off for long names of types that appear in many symbols.
+template <typename Id>
+inline constexpr auto name_of =
+    basic_inplace_string<0U, typename decltype(Id::name())::value_type, detail::name_id_traits<Id>>{};
+
 /// \example named_type_example.cpp
 //
 /// \brief Named type wrapper.
@@ -62,13 +98,14 @@ class named_type final
 
   /// \brief Construct the gw::named_type object.
   template <typename... Args>
-  constexpr explicit named_type(Args&&... args) noexcept(std::is_nothrow_constructible_v<value_type, Args...>)
+  GW_FORWARDING constexpr explicit named_type(Args&&... args) noexcept(
+      std::is_nothrow_constructible_v<value_type, Args...>)
     requires std::constructible_from<value_type, Args...>
       : m_value(value_type{std::forward<Args>(args)...}) {}
 
   /// \brief Construct the gw::named_type object.
   template <typename U, typename... Args>
-  constexpr named_type(std::initializer_list<U> ilist, Args&&... args) noexcept(
+  GW_FORWARDING constexpr named_type(std::initializer_list<U> ilist, Args&&... args) noexcept(
       std::is_nothrow_constructible_v<value_type, std::initializer_list<U>&, Args...>)
     requires std::constructible_from<value_type, std::initializer_list<U>&, Args...>
       : m_value(value_type{ilist, std::forward<Args>(args)...}) {}
@@ -85,41 +122,48 @@ class named_type final
   //
 
   /// \brief Return the name of the gw::named_type.
-  static constexpr auto name() noexcept { return Name.view(); }
+  GW_FORWARDING static constexpr auto name() noexcept {
+    using name_type = decltype(Name);
+    if constexpr (requires { typename name_type::traits_type::id_type; }) {
+      return std::basic_string_view<typename name_type::value_type>{name_type::traits_type::id_type::name()};
+    } else {
+      return Name.view();
+    }
+  }
 
   //
   // Observers
   //
 
   /// \brief Access the contained value.
-  constexpr auto operator->() const noexcept -> const_pointer { return &m_value; }
+  GW_FORWARDING constexpr auto operator->() const noexcept -> const_pointer { return &m_value; }
 
   /// \brief Access the contained value.
-  constexpr auto operator->() noexcept -> pointer { return &m_value; }
+  GW_FORWARDING constexpr auto operator->() noexcept -> pointer { return &m_value; }
 
   /// \brief Access the contained value.
-  constexpr auto operator*() const& noexcept -> const_reference { return m_value; }
+  GW_FORWARDING constexpr auto operator*() const& noexcept -> const_reference { return m_value; }
 
   /// \brief Access the contained value.
-  constexpr auto operator*() & noexcept -> reference { return m_value; }
+  GW_FORWARDING constexpr auto operator*() & noexcept -> reference { return m_value; }
 
   /// \brief Access the contained value.
-  constexpr auto operator*() const&& noexcept -> const value_type&& { return std::move(m_value); }
+  GW_FORWARDING constexpr auto operator*() const&& noexcept -> const value_type&& { return std::move(m_value); }
 
   /// \brief Access the contained value.
-  constexpr auto operator*() && noexcept -> value_type&& { return std::move(m_value); }
+  GW_FORWARDING constexpr auto operator*() && noexcept -> value_type&& { return std::move(m_value); }
 
   /// \brief Return the contained value.
-  constexpr auto value() const& noexcept -> const_reference { return m_value; }
+  GW_FORWARDING constexpr auto value() const& noexcept -> const_reference { return m_value; }
 
   /// \brief Return the contained value.
-  constexpr auto value() & noexcept -> reference { return m_value; }
+  GW_FORWARDING constexpr auto value() & noexcept -> reference { return m_value; }
 
   /// \brief Return the contained value.
-  constexpr auto value() const&& noexcept -> const value_type&& { return std::move(m_value); }
+  GW_FORWARDING constexpr auto value() const&& noexcept -> const value_type&& { return std::move(m_value); }
 
   /// \brief Return the contained value.
-  constexpr auto value() && noexcept -> value_type&& { return std::move(m_value); }
+  GW_FORWARDING constexpr auto value() && noexcept -> value_type&& { return std::move(m_value); }
 
   //
   // Monadic operations
@@ -190,50 +234,54 @@ class named_type final
   //
 
   /// \brief Compare gw::named_type objects.
-  constexpr auto operator==(const named_type& rhs) const& noexcept(noexcept(m_value == rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator==(const named_type& rhs) const& noexcept(noexcept(m_value == rhs.m_value))
+      -> bool
     requires std::equality_comparable<value_type>
   {
     return m_value == rhs.m_value;
   }
 
   /// \brief Compare gw::named_type objects.
-  constexpr auto operator!=(const named_type& rhs) const& noexcept(noexcept(m_value != rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator!=(const named_type& rhs) const& noexcept(noexcept(m_value != rhs.m_value))
+      -> bool
     requires std::equality_comparable<value_type>
   {
     return m_value != rhs.m_value;
   }
 
   /// \brief Compare gw::named_type objects.
-  constexpr auto operator<(const named_type& rhs) const& noexcept(noexcept(m_value < rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator<(const named_type& rhs) const& noexcept(noexcept(m_value < rhs.m_value)) -> bool
     requires std::totally_ordered<value_type>
   {
     return m_value < rhs.m_value;
   }
 
   /// \brief Compare gw::named_type objects.
-  constexpr auto operator>(const named_type& rhs) const& noexcept(noexcept(m_value > rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator>(const named_type& rhs) const& noexcept(noexcept(m_value > rhs.m_value)) -> bool
     requires std::totally_ordered<value_type>
   {
     return m_value > rhs.m_value;
   }
 
   /// \brief Compare gw::named_type objects.
-  constexpr auto operator<=(const named_type& rhs) const& noexcept(noexcept(m_value <= rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator<=(const named_type& rhs) const& noexcept(noexcept(m_value <= rhs.m_value))
+      -> bool
     requires std::totally_ordered<value_type>
   {
     return m_value <= rhs.m_value;
   }
 
   /// \brief Compare gw::named_type objects.
-  constexpr auto operator>=(const named_type& rhs) const& noexcept(noexcept(m_value >= rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator>=(const named_type& rhs) const& noexcept(noexcept(m_value >= rhs.m_value))
+      -> bool
     requires std::totally_ordered<value_type>
   {
     return m_value >= rhs.m_value;
   }
 
   /// \brief Compare gw::named_type objects.
-  constexpr auto operator<=>(const named_type& rhs) const& noexcept(noexcept(m_value <=>
-                                                                             rhs.m_value)) -> std::strong_ordering
+  /// \details The result is the comparison category of `T`, e.g. `std::partial_ordering` for floating-point values.
+  GW_FORWARDING constexpr auto operator<=>(const named_type& rhs) const& noexcept(noexcept(m_value <=> rhs.m_value))
     requires std::three_way_comparable<value_type>
   {
     return m_value <=> rhs.m_value;
@@ -244,23 +292,23 @@ class named_type final
   //
 
   /// \brief Convert the gw::named_type to its underlying type.
-  constexpr explicit operator const_reference() const& noexcept { return m_value; }
+  GW_FORWARDING constexpr explicit operator const_reference() const& noexcept { return m_value; }
 
   /// \brief Convert the gw::named_type to its underlying type.
-  constexpr explicit operator reference() & noexcept { return m_value; }
+  GW_FORWARDING constexpr explicit operator reference() & noexcept { return m_value; }
 
   /// \brief Convert the gw::named_type to its underlying type.
-  constexpr explicit operator const value_type&&() const&& noexcept { return std::move(m_value); }
+  GW_FORWARDING constexpr explicit operator const value_type&&() const&& noexcept { return std::move(m_value); }
 
   /// \brief Convert the gw::named_type to its underlying type.
-  constexpr explicit operator value_type&&() && noexcept { return std::move(m_value); }
+  GW_FORWARDING constexpr explicit operator value_type&&() && noexcept { return std::move(m_value); }
 
   //
   // Increment and decrement operators
   //
 
   /// \brief increments the contained value
-  constexpr auto operator++() & noexcept(noexcept(++m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator++() & noexcept(noexcept(++m_value)) -> named_type&
     requires incrementable<value_type>
   {
     ++m_value;
@@ -268,7 +316,7 @@ class named_type final
   }
 
   /// \brief increments the contained value
-  constexpr auto operator++() && noexcept(noexcept(++m_value)) -> named_type&&
+  GW_FORWARDING constexpr auto operator++() && noexcept(noexcept(++m_value)) -> named_type&&
     requires incrementable<value_type>
   {
     ++m_value;
@@ -276,21 +324,21 @@ class named_type final
   }
 
   /// \brief increments the contained value
-  constexpr auto operator++(int) & noexcept(noexcept(m_value++)) -> named_type
+  GW_FORWARDING constexpr auto operator++(int) & noexcept(noexcept(m_value++)) -> named_type
     requires incrementable<value_type>
   {
     return named_type{m_value++};
   }
 
   /// \brief increments the contained value
-  constexpr auto operator++(int) && noexcept(noexcept(m_value++)) -> named_type
+  GW_FORWARDING constexpr auto operator++(int) && noexcept(noexcept(m_value++)) -> named_type
     requires incrementable<value_type>
   {
     return named_type{m_value++};
   }
 
   /// \brief decrements the contained value
-  constexpr auto operator--() & noexcept(noexcept(--m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator--() & noexcept(noexcept(--m_value)) -> named_type&
     requires decrementable<value_type>
   {
     --m_value;
@@ -298,7 +346,7 @@ class named_type final
   }
 
   /// \brief decrements the contained value
-  constexpr auto operator--() && noexcept(noexcept(--m_value)) -> named_type&&
+  GW_FORWARDING constexpr auto operator--() && noexcept(noexcept(--m_value)) -> named_type&&
     requires decrementable<value_type>
   {
     --m_value;
@@ -306,14 +354,14 @@ class named_type final
   }
 
   /// \brief decrements the contained value
-  constexpr auto operator--(int) & noexcept(noexcept(m_value--)) -> named_type
+  GW_FORWARDING constexpr auto operator--(int) & noexcept(noexcept(m_value--)) -> named_type
     requires decrementable<value_type>
   {
     return named_type{m_value--};
   }
 
   /// \brief decrements the contained value
-  constexpr auto operator--(int) && noexcept(noexcept(m_value--)) -> named_type
+  GW_FORWARDING constexpr auto operator--(int) && noexcept(noexcept(m_value--)) -> named_type
     requires decrementable<value_type>
   {
     return named_type{m_value--};
@@ -323,200 +371,75 @@ class named_type final
   // Arithmetic operators
   //
 
-  /// \brief affirms the contained value
-  constexpr auto operator+() const& noexcept(noexcept(+m_value)) -> named_type
-    requires std::signed_integral<value_type>
-  {
-    return named_type{+m_value};
-  }
+  // Every operator has a single overload, because `const&` binds rvalues as well, and every overload is declared again
+  // for every name. See compile_time_benchmark.
 
   /// \brief affirms the contained value
-  constexpr auto operator+() && noexcept(noexcept(+m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator+() const& noexcept(noexcept(+m_value)) -> named_type
     requires std::signed_integral<value_type>
   {
     return named_type{+m_value};
   }
 
   /// \brief negates the contained value
-  constexpr auto operator-() const& noexcept(noexcept(-m_value)) -> named_type
-    requires std::signed_integral<value_type>
-  {
-    return named_type{-m_value};
-  }
-
-  /// \brief negates the contained value
-  constexpr auto operator-() && noexcept(noexcept(-m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator-() const& noexcept(noexcept(-m_value)) -> named_type
     requires std::signed_integral<value_type>
   {
     return named_type{-m_value};
   }
 
   /// \brief adds the contained values
-  constexpr auto operator+(const named_type& rhs) const& noexcept(noexcept(m_value + rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value + rhs.m_value};
-  }
-
-  /// \brief adds the contained values
-  constexpr auto operator+(named_type&& rhs) const& noexcept(noexcept(m_value + rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value + rhs.m_value};
-  }
-
-  /// \brief adds the contained values
-  constexpr auto operator+(const named_type& rhs) && noexcept(noexcept(m_value + rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value + rhs.m_value};
-  }
-
-  /// \brief adds the contained values
-  constexpr auto operator+(named_type&& rhs) && noexcept(noexcept(m_value + rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator+(const named_type& rhs) const& noexcept(noexcept(m_value + rhs.m_value))
+      -> named_type
     requires arithmetic<value_type>
   {
     return named_type{m_value + rhs.m_value};
   }
 
   /// \brief subtracts the contained values
-  constexpr auto operator-(const named_type& rhs) const& noexcept(noexcept(m_value - rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value - rhs.m_value};
-  }
-
-  /// \brief subtracts the contained values
-  constexpr auto operator-(named_type&& rhs) const& noexcept(noexcept(m_value - rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value - rhs.m_value};
-  }
-
-  /// \brief subtracts the contained values
-  constexpr auto operator-(const named_type& rhs) && noexcept(noexcept(m_value - rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator-(const named_type& rhs) const& noexcept(noexcept(m_value - rhs.m_value))
+      -> named_type
     requires arithmetic<value_type>
   {
     return named_type{m_value - rhs.m_value};
   }
 
-  /// \brief subtracts the contained values
-  constexpr auto operator-(named_type&& rhs) && noexcept(noexcept(m_value - rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value - rhs.m_value};
-  }
-
-  /// \brief multiplies the contained values
-  constexpr auto operator*(const named_type& rhs) const& noexcept(noexcept(m_value * rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value * rhs.m_value};
-  }
-
-  /// \brief multiplies the contained values
-  constexpr auto operator*(named_type&& rhs) const& noexcept(noexcept(m_value * rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value * rhs.m_value};
-  }
-
   /// \brief multiplies the contained values
-  constexpr auto operator*(const named_type& rhs) && noexcept(noexcept(m_value * rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator*(const named_type& rhs) const& noexcept(noexcept(m_value * rhs.m_value))
+      -> named_type
     requires arithmetic<value_type>
   {
     return named_type{m_value * rhs.m_value};
   }
 
-  /// \brief multiplies the contained values
-  constexpr auto operator*(named_type&& rhs) && noexcept(noexcept(m_value * rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value * rhs.m_value};
-  }
-
-  /// \brief devides the contained values
-  constexpr auto operator/(const named_type& rhs) const& noexcept(noexcept(m_value / rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value / rhs.m_value};
-  }
-
-  /// \brief devides the contained values
-  constexpr auto operator/(named_type&& rhs) const& noexcept(noexcept(m_value / rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value / rhs.m_value};
-  }
-
   /// \brief devides the contained values
-  constexpr auto operator/(const named_type& rhs) && noexcept(noexcept(m_value / rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator/(const named_type& rhs) const& noexcept(noexcept(m_value / rhs.m_value))
+      -> named_type
     requires arithmetic<value_type>
   {
     return named_type{m_value / rhs.m_value};
   }
 
-  /// \brief devides the contained values
-  constexpr auto operator/(named_type&& rhs) && noexcept(noexcept(m_value / rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value / rhs.m_value};
-  }
-
-  /// \brief calculates the remainder of the contained values
-  constexpr auto operator%(const named_type& rhs) const& noexcept(noexcept(m_value % rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value % rhs.m_value};
-  }
-
-  /// \brief calculates the remainder of the contained values
-  constexpr auto operator%(named_type&& rhs) const& noexcept(noexcept(m_value % rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value % rhs.m_value};
-  }
-
-  /// \brief calculates the remainder of the contained values
-  constexpr auto operator%(const named_type& rhs) && noexcept(noexcept(m_value % rhs.m_value)) -> named_type
-    requires arithmetic<value_type>
-  {
-    return named_type{m_value % rhs.m_value};
-  }
-
   /// \brief calculates the remainder of the contained values
-  constexpr auto operator%(named_type&& rhs) && noexcept(noexcept(m_value % rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator%(const named_type& rhs) const& noexcept(noexcept(m_value % rhs.m_value))
+      -> named_type
     requires arithmetic<value_type>
   {
     return named_type{m_value % rhs.m_value};
   }
 
   /// \brief adds the contained values and assigns the result
-  constexpr auto operator+=(const named_type& rhs) & noexcept(noexcept(m_value += rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator+=(const named_type& rhs) & noexcept(noexcept(m_value += rhs.m_value))
+      -> named_type&
     requires arithmetic<value_type>
   {
     m_value += rhs.m_value;
     return *this;
   }
 
-  /// \brief adds the contained values and assigns the result
-  constexpr auto operator+=(named_type&& rhs) & noexcept(noexcept(m_value += rhs.m_value)) -> named_type&
-    requires arithmetic<value_type>
-  {
-    m_value += rhs.m_value;
-    return *this;
-  }
-
-  /// \brief subtracts the contained values and assigns the result
-  constexpr auto operator-=(const named_type& rhs) & noexcept(noexcept(m_value -= rhs.m_value)) -> named_type&
-    requires arithmetic<value_type>
-  {
-    m_value -= rhs.m_value;
-    return *this;
-  }
-
   /// \brief subtracts the contained values and assigns the result
-  constexpr auto operator-=(named_type&& rhs) & noexcept(noexcept(m_value -= rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator-=(const named_type& rhs) & noexcept(noexcept(m_value -= rhs.m_value))
+      -> named_type&
     requires arithmetic<value_type>
   {
     m_value -= rhs.m_value;
@@ -524,15 +447,8 @@ class named_type final
   }
 
   /// \brief multiplies the contained values and assigns the result
-  constexpr auto operator*=(const named_type& rhs) & noexcept(noexcept(m_value *= rhs.m_value)) -> named_type&
-    requires arithmetic<value_type>
-  {
-    m_value *= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief multiplies the contained values and assigns the result
-  constexpr auto operator*=(named_type&& rhs) & noexcept(noexcept(m_value *= rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator*=(const named_type& rhs) & noexcept(noexcept(m_value *= rhs.m_value))
+      -> named_type&
     requires arithmetic<value_type>
   {
     m_value *= rhs.m_value;
@@ -540,15 +456,8 @@ class named_type final
   }
 
   /// \brief devides the contained values and assigns the result
-  constexpr auto operator/=(const named_type& rhs) & noexcept(noexcept(m_value /= rhs.m_value)) -> named_type&
-    requires arithmetic<value_type>
-  {
-    m_value /= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief devides the contained values and assigns the result
-  constexpr auto operator/=(named_type&& rhs) & noexcept(noexcept(m_value /= rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator/=(const named_type& rhs) & noexcept(noexcept(m_value /= rhs.m_value))
+      -> named_type&
     requires arithmetic<value_type>
   {
     m_value /= rhs.m_value;
@@ -556,15 +465,8 @@ class named_type final
   }
 
   /// \brief calculates the remainder of the contained values and assigns the result
-  constexpr auto operator%=(const named_type& rhs) & noexcept(noexcept(m_value %= rhs.m_value)) -> named_type&
-    requires arithmetic<value_type>
-  {
-    m_value %= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief calculates the remainder of the contained values and assigns the result
-  constexpr auto operator%=(named_type&& rhs) & noexcept(noexcept(m_value %= rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator%=(const named_type& rhs) & noexcept(noexcept(m_value %= rhs.m_value))
+      -> named_type&
     requires arithmetic<value_type>
   {
     m_value %= rhs.m_value;
@@ -576,162 +478,55 @@ class named_type final
   //
 
   /// \brief inverts the contained value
-  constexpr auto operator~() const& noexcept(noexcept(~m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator~() const& noexcept(noexcept(~m_value)) -> named_type
     requires std::unsigned_integral<value_type>
   {
     return named_type{~m_value};
   }
 
   /// \brief performs binary AND on the contained values
-  constexpr auto operator&(const named_type& rhs) const& noexcept(noexcept(m_value & rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value & rhs.m_value};
-  }
-
-  /// \brief performs binary AND on the contained values
-  constexpr auto operator&(named_type&& rhs) const& noexcept(noexcept(m_value & rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value & rhs.m_value};
-  }
-
-  /// \brief performs binary AND on the contained values
-  constexpr auto operator&(const named_type& rhs) && noexcept(noexcept(m_value & rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator&(const named_type& rhs) const& noexcept(noexcept(m_value & rhs.m_value))
+      -> named_type
     requires std::unsigned_integral<value_type>
   {
     return named_type{m_value & rhs.m_value};
   }
 
-  /// \brief performs binary AND on the contained values
-  constexpr auto operator&(named_type&& rhs) && noexcept(noexcept(m_value & rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value & rhs.m_value};
-  }
-
-  /// \brief performs binary OR on the contained values
-  constexpr auto operator|(const named_type& rhs) const& noexcept(noexcept(m_value | rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value | rhs.m_value};
-  }
-
   /// \brief performs binary OR on the contained values
-  constexpr auto operator|(named_type&& rhs) const& noexcept(noexcept(m_value | rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator|(const named_type& rhs) const& noexcept(noexcept(m_value | rhs.m_value))
+      -> named_type
     requires std::unsigned_integral<value_type>
   {
     return named_type{m_value | rhs.m_value};
   }
 
-  /// \brief performs binary OR on the contained values
-  constexpr auto operator|(const named_type& rhs) && noexcept(noexcept(m_value | rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value | rhs.m_value};
-  }
-
-  /// \brief performs binary OR on the contained values
-  constexpr auto operator|(named_type&& rhs) && noexcept(noexcept(m_value | rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value | rhs.m_value};
-  }
-
-  /// \brief performs binary XOR on the contained values
-  constexpr auto operator^(const named_type& rhs) const& noexcept(noexcept(m_value ^ rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value ^ rhs.m_value};
-  }
-
   /// \brief performs binary XOR on the contained values
-  constexpr auto operator^(named_type&& rhs) const& noexcept(noexcept(m_value ^ rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value ^ rhs.m_value};
-  }
-
-  /// \brief performs binary XOR on the contained values
-  constexpr auto operator^(const named_type& rhs) && noexcept(noexcept(m_value ^ rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value ^ rhs.m_value};
-  }
-
-  /// \brief performs binary XOR on the contained values
-  constexpr auto operator^(named_type&& rhs) && noexcept(noexcept(m_value ^ rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator^(const named_type& rhs) const& noexcept(noexcept(m_value ^ rhs.m_value))
+      -> named_type
     requires std::unsigned_integral<value_type>
   {
     return named_type{m_value ^ rhs.m_value};
   }
 
   /// \brief performs binary left shift on the contained values
-  constexpr auto operator<<(const named_type& rhs) const& noexcept(noexcept(m_value << rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator<<(const named_type& rhs) const& noexcept(noexcept(m_value << rhs.m_value))
+      -> named_type
     requires std::unsigned_integral<value_type>
   {
     return named_type{m_value << rhs.m_value};
   }
 
-  /// \brief performs binary left shift on the contained values
-  constexpr auto operator<<(named_type&& rhs) const& noexcept(noexcept(m_value << rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value << rhs.m_value};
-  }
-
-  /// \brief performs binary left shift on the contained values
-  constexpr auto operator<<(const named_type& rhs) && noexcept(noexcept(m_value << rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value << rhs.m_value};
-  }
-
-  /// \brief performs binary left shift on the contained values
-  constexpr auto operator<<(named_type&& rhs) && noexcept(noexcept(m_value << rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value << rhs.m_value};
-  }
-
-  /// \brief performs binary right shift on the contained values
-  constexpr auto operator>>(const named_type& rhs) const& noexcept(noexcept(m_value >> rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value >> rhs.m_value};
-  }
-
-  /// \brief performs binary right shift on the contained values
-  constexpr auto operator>>(named_type&& rhs) const& noexcept(noexcept(m_value >> rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value >> rhs.m_value};
-  }
-
   /// \brief performs binary right shift on the contained values
-  constexpr auto operator>>(const named_type& rhs) && noexcept(noexcept(m_value >> rhs.m_value)) -> named_type
-    requires std::unsigned_integral<value_type>
-  {
-    return named_type{m_value >> rhs.m_value};
-  }
-
-  /// \brief performs binary right shift on the contained values
-  constexpr auto operator>>(named_type&& rhs) && noexcept(noexcept(m_value >> rhs.m_value)) -> named_type
+  GW_FORWARDING constexpr auto operator>>(const named_type& rhs) const& noexcept(noexcept(m_value >> rhs.m_value))
+      -> named_type
     requires std::unsigned_integral<value_type>
   {
     return named_type{m_value >> rhs.m_value};
   }
 
   /// \brief performs binary AND on the contained values and assigns the result
-  constexpr auto operator&=(const named_type& rhs) & noexcept(noexcept(m_value &= rhs.m_value)) -> named_type&
-    requires std::unsigned_integral<value_type>
-  {
-    m_value &= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief performs binary AND on the contained values and assigns the result
-  constexpr auto operator&=(named_type&& rhs) & noexcept(noexcept(m_value &= rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator&=(const named_type& rhs) & noexcept(noexcept(m_value &= rhs.m_value))
+      -> named_type&
     requires std::unsigned_integral<value_type>
   {
     m_value &= rhs.m_value;
@@ -739,15 +534,8 @@ class named_type final
   }
 
   /// \brief performs binary OR on the contained values and assigns the result
-  constexpr auto operator|=(const named_type& rhs) & noexcept(noexcept(m_value |= rhs.m_value)) -> named_type&
-    requires std::unsigned_integral<value_type>
-  {
-    m_value |= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief performs binary OR on the contained values and assigns the result
-  constexpr auto operator|=(named_type&& rhs) & noexcept(noexcept(m_value |= rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator|=(const named_type& rhs) & noexcept(noexcept(m_value |= rhs.m_value))
+      -> named_type&
     requires std::unsigned_integral<value_type>
   {
     m_value |= rhs.m_value;
@@ -755,31 +543,17 @@ class named_type final
   }
 
   /// \brief performs binary XOR on the contained values and assigns the result
-  constexpr auto operator^=(const named_type& rhs) & noexcept(noexcept(m_value ^= rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator^=(const named_type& rhs) & noexcept(noexcept(m_value ^= rhs.m_value))
+      -> named_type&
     requires std::unsigned_integral<value_type>
   {
     m_value ^= rhs.m_value;
     return *this;
   }
 
-  /// \brief performs binary XOR on the contained values and assigns the result
-  constexpr auto operator^=(named_type&& rhs) & noexcept(noexcept(m_value ^= rhs.m_value)) -> named_type&
-    requires std::unsigned_integral<value_type>
-  {
-    m_value ^= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief performs binary left shift on the contained values and assigns the result
-  constexpr auto operator<<=(const named_type& rhs) & noexcept(noexcept(m_value <<= rhs.m_value)) -> named_type&
-    requires std::unsigned_integral<value_type>
-  {
-    m_value <<= rhs.m_value;
-    return *this;
-  }
-
   /// \brief performs binary left shift on the contained values and assigns the result
-  constexpr auto operator<<=(named_type&& rhs) & noexcept(noexcept(m_value <<= rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator<<=(const named_type& rhs) & noexcept(noexcept(m_value <<= rhs.m_value))
+      -> named_type&
     requires std::unsigned_integral<value_type>
   {
     m_value <<= rhs.m_value;
@@ -787,15 +561,8 @@ class named_type final
   }
 
   /// \brief performs binary right shift on the contained values and assigns the result
-  constexpr auto operator>>=(const named_type& rhs) & noexcept(noexcept(m_value >>= rhs.m_value)) -> named_type&
-    requires std::unsigned_integral<value_type>
-  {
-    m_value >>= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief performs binary right shift on the contained values and assigns the result
-  constexpr auto operator>>=(named_type&& rhs) & noexcept(noexcept(m_value >>= rhs.m_value)) -> named_type&
+  GW_FORWARDING constexpr auto operator>>=(const named_type& rhs) & noexcept(noexcept(m_value >>= rhs.m_value))
+      -> named_type&
     requires std::unsigned_integral<value_type>
   {
     m_value >>= rhs.m_value;
@@ -807,28 +574,28 @@ class named_type final
   //
 
   /// \brief returns an iterator to the beginning of the contained value
-  constexpr auto begin() const noexcept(noexcept(std::ranges::begin(m_value)))
+  GW_FORWARDING constexpr auto begin() const noexcept(noexcept(std::ranges::begin(m_value)))
     requires std::ranges::range<value_type>
   {
     return std::ranges::begin(m_value);
   }
 
   /// \brief returns an iterator to the beginning of the contained value
-  constexpr auto begin() noexcept(noexcept(std::ranges::begin(m_value)))
+  GW_FORWARDING constexpr auto begin() noexcept(noexcept(std::ranges::begin(m_value)))
     requires std::ranges::range<value_type>
   {
     return std::ranges::begin(m_value);
   }
 
   /// \brief returns an iterator to the end of the contained value
-  constexpr auto end() const noexcept(noexcept(std::ranges::end(m_value)))
+  GW_FORWARDING constexpr auto end() const noexcept(noexcept(std::ranges::end(m_value)))
     requires std::ranges::range<value_type>
   {
     return std::ranges::end(m_value);
   }
 
   /// \brief returns an iterator to the end of the contained value
-  constexpr auto end() noexcept(noexcept(std::ranges::end(m_value)))
+  GW_FORWARDING constexpr auto end() noexcept(noexcept(std::ranges::end(m_value)))
     requires std::ranges::range<value_type>
   {
     return std::ranges::end(m_value);
@@ -889,16 +656,16 @@ constexpr auto make_named_type(T&& value) noexcept(
 namespace std {
 
 /// \brief Hash support for `gw::named_type`.
+/// \details The name is hashed with `gw::fnv1a` at compile time, so only the contained value is hashed at runtime.
 template <::gw::hashable T, ::gw::basic_inplace_string Name>
 // NOLINTNEXTLINE(cert-dcl58-cpp)
 struct hash<::gw::named_type<T, Name>> {
   /// \brief Calculate the hash of the `gw::named_type` object.
   [[nodiscard]] auto inline operator()(const ::gw::named_type<T, Name>& named_type) const noexcept -> size_t {
     using value_type = std::remove_cvref_t<T>;
-    using name_type = std::remove_cvref_t<decltype(Name)>;
+    constexpr auto name_hash = static_cast<size_t>(::gw::fnv1a(::gw::named_type<T, Name>::name()));
     auto value_hash = hash<value_type>{}(named_type.value());
-    auto name_hash = hash<name_type>{}(named_type.name());
-    return value_hash ^ name_hash;
+    return ::gw::hash_combine(name_hash, value_hash);
   }
 };
 
@@ -922,7 +689,7 @@ struct formatter<::gw::named_type<T, Name>, CharT> {
     }
 
     if (it != context.end() && *it != '}') {
-      throw std::format_error("Invalid format args for gw::named_type.");
+      gw::detail::throw_error<std::format_error>("Invalid format args for gw::named_type.");
     }
 
     return it;
@@ -0,0 +1,395 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "gw/error.hpp"
+#include "gw/hash.hpp"
+#include "gw/inplace_string.hpp"
+#include "gw/named_type.hpp"
+#include "gw/strong_type.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+//
+// Packed values
+//
+
+/// \brief The traits of a type that can be stored in a gw::packed_record.
+/// \details Specializations provide the integral `representation_type` and the conversions
+/// `static constexpr auto to_representation(const T&) -> representation_type` and
+/// `static constexpr auto from_representation(representation_type) -> T`. The primary template is not defined.
+template <typename T>
+struct packed_traits;
+
+/// \brief Concept for types that can be stored in a gw::packed_record.
+template <typename T>
+concept packable = requires(const T& value, typename packed_traits<T>::representation_type representation) {
+  requires std::integral<typename packed_traits<T>::representation_type>;
+  { packed_traits<T>::to_representation(value) } -> std::same_as<typename packed_traits<T>::representation_type>;
+  { packed_traits<T>::from_representation(representation) } -> std::same_as<T>;
+};
+
+/// \brief Packed traits for integral types.
+template <std::integral T>
+struct packed_traits<T> {
+  using representation_type = T;  ///< The integral representation.
+
+  /// \brief Return the representation of `value`.
+  static constexpr auto to_representation(const T& value) noexcept -> representation_type { return value; }
+
+  /// \brief Return the value of `representation`.
+  static constexpr auto from_representation(representation_type representation) noexcept -> T {
+    return representation;
+  }
+};
+
+/// \brief Packed traits for enumerations, which are stored as their underlying type.
+template <typename T>
+  requires std::is_enum_v<T>
+struct packed_traits<T> {
+  using representation_type = std::underlying_type_t<T>;  ///< The integral representation.
+
+  /// \brief Return the representation of `value`.
+  static constexpr auto to_representation(const T& value) noexcept -> representation_type {
+    return static_cast<representation_type>(value);
+  }
+
+  /// \brief Return the value of `representation`.
+  static constexpr auto from_representation(representation_type representation) noexcept -> T {
+    return static_cast<T>(representation);
+  }
+};
+
+/// \brief Packed traits for strong types of packable types.
+template <packable T, typename Tag>
+struct packed_traits<strong_type<T, Tag>> {
+  using representation_type = typename packed_traits<T>::representation_type;  ///< The integral representation.
+
+  /// \brief Return the representation of `value`.
+  static constexpr auto to_representation(const strong_type<T, Tag>& value) noexcept -> representation_type {
+    return packed_traits<T>::to_representation(value.value());
+  }
+
+  /// \brief Return the value of `representation`.
+  static constexpr auto from_representation(representation_type representation) noexcept -> strong_type<T, Tag> {
+    return strong_type<T, Tag>{packed_traits<T>::from_representation(representation)};
+  }
+};
+
+/// \brief Packed traits for named types of packable types.
+template <packable T, basic_inplace_string Name>
+struct packed_traits<named_type<T, Name>> {
+  using representation_type = typename packed_traits<T>::representation_type;  ///< The integral representation.
+
+  /// \brief Return the representation of `value`.
+  static constexpr auto to_representation(const named_type<T, Name>& value) noexcept -> representation_type {
+    return packed_traits<T>::to_representation(value.value());
+  }
+
+  /// \brief Return the value of `representation`.
+  static constexpr auto from_representation(representation_type representation) noexcept -> named_type<T, Name> {
+    return named_type<T, Name>{packed_traits<T>::from_representation(representation)};
+  }
+};
+
+//
+// Fields
+//
+
+namespace detail {
+
+template <typename Representation>
+inline constexpr std::size_t k_packed_digits = std::numeric_limits<std::make_unsigned_t<Representation>>::digits;
+
+template <>
+inline constexpr std::size_t k_packed_digits<bool> = 1U;
+
+}  // namespace detail
+
+/// \brief A field of a gw::packed_record, named `Name`, of type `T`, that is stored in `Bits` bits.
+/// \details Signed representations are stored in two's complement and sign-extended when read.
+template <basic_inplace_string Name, packable T, std::size_t Bits>
+  requires(Bits > 0U && Bits <= detail::k_packed_digits<typename packed_traits<T>::representation_type>)
+struct field {
+  static constexpr auto name = Name;                                           ///< The name of the field.
+  static constexpr std::size_t bits = Bits;                                    ///< The width of the field in bits.
+  using value_type = T;                                                        ///< The type of the field.
+  using representation_type = typename packed_traits<T>::representation_type;  ///< The integral representation.
+};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool k_is_field = false;
+
+template <basic_inplace_string Name, typename T, std::size_t Bits>
+inline constexpr bool k_is_field<field<Name, T, Bits>> = true;
+
+template <std::size_t Bits>
+inline constexpr std::uint64_t k_packed_mask = Bits >= 64U ? ~std::uint64_t{} : (std::uint64_t{1} << Bits) - 1U;
+
+template <std::size_t Bits>
+using packed_word_t =
+    std::conditional_t<Bits <= 8U, std::uint8_t,
+                       std::conditional_t<Bits <= 16U, std::uint16_t,
+                                          std::conditional_t<Bits <= 32U, std::uint32_t, std::uint64_t>>>;
+
+template <basic_inplace_string Name, typename... Fields>
+consteval auto packed_field_index() noexcept -> std::size_t {
+  constexpr auto names = std::array<std::string_view, sizeof...(Fields)>{Fields::name.view()...};
+  for (std::size_t index = 0U; index < names.size(); ++index) {
+    if (names[index] == Name.view()) {
+      return index;
+    }
+  }
+  return names.size();
+}
+
+template <basic_inplace_string Name, typename... Fields>
+struct packed_field {};
+
+template <basic_inplace_string Name, typename... Fields>
+  requires(packed_field_index<Name, Fields...>() < sizeof...(Fields))
+struct packed_field<Name, Fields...> {
+  using type = std::tuple_element_t<packed_field_index<Name, Fields...>(), std::tuple<Fields...>>;
+};
+
+template <typename... Fields>
+consteval auto packed_names_unique() noexcept -> bool {
+  constexpr auto names = std::array<std::string_view, sizeof...(Fields)>{Fields::name.view()...};
+  for (std::size_t lhs = 0U; lhs < names.size(); ++lhs) {
+    for (std::size_t rhs = lhs + 1U; rhs < names.size(); ++rhs) {
+      if (names[lhs] == names[rhs]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename Representation>
+constexpr auto to_packed_bits(Representation representation) noexcept -> std::uint64_t {
+  if constexpr (std::same_as<Representation, bool>) {
+    return representation ? 1U : 0U;
+  } else {
+    return static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<Representation>>(representation));
+  }
+}
+
+template <typename Representation, std::size_t Bits>
+constexpr auto from_packed_bits(std::uint64_t bits) noexcept -> Representation {
+  if constexpr (std::same_as<Representation, bool>) {
+    return bits != 0U;
+  } else if constexpr (std::is_signed_v<Representation>) {
+    // Move the sign bit to the top and shift it back arithmetically, which sign-extends without a branch
+    constexpr auto k_shift = 64U - Bits;
+    return static_cast<Representation>(static_cast<std::int64_t>(bits << k_shift) >> k_shift);
+  } else {
+    return static_cast<Representation>(bits);
+  }
+}
+
+template <typename Representation, std::size_t Bits>
+constexpr auto fits_packed_bits(Representation representation) noexcept -> bool {
+  if constexpr (std::same_as<Representation, bool>) {
+    return true;
+  } else if constexpr (std::is_signed_v<Representation>) {
+    if constexpr (Bits >= k_packed_digits<Representation>) {
+      return true;
+    } else {
+      constexpr auto k_max = static_cast<std::int64_t>(k_packed_mask<Bits - 1U>);
+      return representation >= -k_max - 1 && representation <= k_max;
+    }
+  } else {
+    return static_cast<std::uint64_t>(representation) <= k_packed_mask<Bits>;
+  }
+}
+
+}  // namespace detail
+
+//
+// Packed record
+//
+
+/// \example packed_record_example.cpp
+//
+/// \brief A record of fields that are stored in their declared bit widths.
+//
+/// \details The class template `gw::packed_record` stores the values of its gw::field members back to back, in
+/// declaration order, in one word of the smallest unsigned integer type that holds all of them, or in two 64-bit words
+/// if they need more than 64 bits. Fields are read and written by name, and keep their types:
+/// `record.get<"qty">()` returns the `gw::strong_type` it was declared with. Values that do not fit into the width of
+/// their field are rejected when they are set. A record of a 20-bit quantity, a 12-bit venue and an 8-bit side
+/// occupies 8 bytes instead of 12, and can be copied and compared as a single integer.
+/// \tparam Fields The gw::field members of the record.
+template <typename... Fields>
+  requires(sizeof...(Fields) > 0U && (detail::k_is_field<Fields> && ...))
+class packed_record {
+ public:
+  //
+  // Public constants
+  //
+
+  static constexpr std::size_t field_count = sizeof...(Fields);   ///< The number of fields.
+  static constexpr std::size_t bit_count = (Fields::bits + ...);  ///< The total width of the fields in bits.
+
+  static_assert(detail::packed_names_unique<Fields...>(), "gw::packed_record: field names must be unique");
+  static_assert(bit_count <= 128U, "gw::packed_record: fields must fit into two 64-bit words");
+
+  //
+  // Public types
+  //
+
+  using word_type = detail::packed_word_t<bit_count>;  ///< The type of the words that store the fields.
+
+  /// \brief The type of the field named `Name`.
+  template <basic_inplace_string Name>
+  using field_type = typename detail::packed_field<Name, Fields...>::type::value_type;
+
+  static constexpr std::size_t word_count = bit_count <= 64U ? 1U : 2U;  ///< The number of words.
+
+  //
+  // Constructors
+  //
+
+  /// \brief constructs a gw::packed_record whose fields are all zero
+  constexpr packed_record() noexcept = default;
+
+  /// \brief constructs a gw::packed_record from the values of all fields, in declaration order
+  /// \throw std::out_of_range If a value does not fit into its field.
+  constexpr explicit packed_record(const typename Fields::value_type&... values) {
+    (set<Fields::name>(values), ...);
+  }
+
+  //
+  // Field access
+  //
+
+  /// \brief returns the value of the field named `Name`
+  template <basic_inplace_string Name>
+  [[nodiscard]] constexpr auto get() const noexcept -> field_type<Name> {
+    using field_t = field_at<Name>;
+    using traits_t = packed_traits<typename field_t::value_type>;
+    const auto bits = read<offset_of<Name>(), field_t::bits>();
+    return traits_t::from_representation(
+        detail::from_packed_bits<typename field_t::representation_type, field_t::bits>(bits));
+  }
+
+  /// \brief sets the field named `Name` to `value`
+  /// \throw std::out_of_range If `value` does not fit into the field.
+  template <basic_inplace_string Name>
+  constexpr void set(const field_type<Name>& value) {
+    using field_t = field_at<Name>;
+    const auto representation = packed_traits<typename field_t::value_type>::to_representation(value);
+    if (!fits<Name>(value)) {
+      detail::throw_error<std::out_of_range>(std::format("packed_record::set: {} (which is {}) does not fit in {} bits",
+                                                         field_t::name.view(), representation, field_t::bits));
+    }
+    write<offset_of<Name>(), field_t::bits>(detail::to_packed_bits(representation));
+  }
+
+  /// \brief checks whether `value` fits into the field named `Name`
+  template <basic_inplace_string Name>
+  [[nodiscard]] static constexpr auto fits(const field_type<Name>& value) noexcept -> bool {
+    using field_t = field_at<Name>;
+    return detail::fits_packed_bits<typename field_t::representation_type, field_t::bits>(
+        packed_traits<typename field_t::value_type>::to_representation(value));
+  }
+
+  /// \brief returns the words that store the fields
+  [[nodiscard]] constexpr auto words() const noexcept -> const std::array<word_type, word_count>& { return m_words; }
+
+  //
+  // Comparison operators
+  //
+
+  /// \brief compares the fields of two gw::packed_record objects
+  friend constexpr auto operator==(const packed_record& lhs, const packed_record& rhs) noexcept -> bool = default;
+
+ private:
+  static constexpr std::size_t k_word_bits = std::numeric_limits<word_type>::digits;
+
+  template <basic_inplace_string Name>
+  using field_at = typename detail::packed_field<Name, Fields...>::type;
+
+  template <basic_inplace_string Name>
+  static consteval auto offset_of() noexcept -> std::size_t {
+    constexpr auto widths = std::array<std::size_t, field_count>{Fields::bits...};
+    auto offset = std::size_t{};
+    for (std::size_t index = 0U; index < detail::packed_field_index<Name, Fields...>(); ++index) {
+      offset += widths[index];
+    }
+    return offset;
+  }
+
+  template <std::size_t Offset, std::size_t Bits>
+  [[nodiscard]] constexpr auto read() const noexcept -> std::uint64_t {
+    constexpr auto k_word = Offset / k_word_bits;
+    constexpr auto k_shift = Offset % k_word_bits;
+    auto bits = static_cast<std::uint64_t>(m_words[k_word]) >> k_shift;
+    if constexpr (k_shift + Bits > k_word_bits) {
+      bits |= static_cast<std::uint64_t>(m_words[k_word + 1U]) << (k_word_bits - k_shift);
+    }
+    return bits & detail::k_packed_mask<Bits>;
+  }
+
+  template <std::size_t Offset, std::size_t Bits>
+  constexpr void write(std::uint64_t bits) noexcept {
+    constexpr auto k_word = Offset / k_word_bits;
+    constexpr auto k_shift = Offset % k_word_bits;
+    bits &= detail::k_packed_mask<Bits>;
+    const auto low_mask = detail::k_packed_mask<Bits> << k_shift;
+    m_words[k_word] = static_cast<word_type>((m_words[k_word] & ~low_mask) | (bits << k_shift));
+    if constexpr (k_shift + Bits > k_word_bits) {
+      constexpr auto k_high_bits = k_shift + Bits - k_word_bits;
+      m_words[k_word + 1U] = static_cast<word_type>((m_words[k_word + 1U] & ~detail::k_packed_mask<k_high_bits>) |
+                                                    (bits >> (k_word_bits - k_shift)));
+    }
+  }
+
+  std::array<word_type, word_count> m_words{};
+};
+
+/// \brief returns the value of the field named `Name` of `record`
+template <basic_inplace_string Name, typename... Fields>
+[[nodiscard]] constexpr auto get(const packed_record<Fields...>& record) noexcept {
+  return record.template get<Name>();
+}
+
+}  // namespace gw
+
+namespace std {
+
+//
+// Hash calculation
+//
+
+/// \brief hash support for gw::packed_record
+template <typename... Fields>
+// NOLINTNEXTLINE(cert-dcl58-cpp)
+struct hash<::gw::packed_record<Fields...>> {
+  [[nodiscard]] auto inline operator()(const ::gw::packed_record<Fields...>& record) const noexcept -> size_t {
+    auto seed = size_t{};
+    for (const auto word : record.words()) {
+      seed = ::gw::hash_combine(seed, static_cast<size_t>(word));
+    }
+    return seed;
+  }
+};
+
+}  // namespace std
@@ -0,0 +1,182 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "gw/atomic_strong_type.hpp"
+#include "gw/strong_type.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+/// \brief How a gw::sharded_counter selects the shard an increment goes to.
+enum class shard_by {
+  thread,  ///< Every thread is assigned a shard on first use.
+  cpu,     ///< The shard of the CPU the thread runs on, via `sched_getcpu`. Falls back to `thread` where unsupported.
+};
+
+namespace detail {
+
+/// \brief Return a shard hint that is fixed for the calling thread.
+inline auto thread_shard_hint() noexcept -> std::size_t {
+  static auto next_hint = std::atomic<std::size_t>{};
+  thread_local const auto hint = next_hint.fetch_add(1U, std::memory_order_relaxed);
+  return hint;
+}
+
+/// \brief Return a shard hint for the CPU the calling thread runs on.
+/// \details On Linux `sched_getcpu` reads the CPU number without a system call. Where the CPU number is not
+/// available, the thread shard hint is returned instead.
+inline auto cpu_shard_hint() noexcept -> std::size_t {
+#if defined(__linux__)
+  if (const auto cpu = ::sched_getcpu(); cpu >= 0) {
+    return static_cast<std::size_t>(cpu);
+  }
+#endif
+  return thread_shard_hint();
+}
+
+/// \brief Return the default number of shards: the number of hardware threads, rounded up to a power of two.
+inline auto default_shard_count() noexcept -> std::size_t {
+  return std::bit_ceil(std::max<std::size_t>(std::thread::hardware_concurrency(), 1U));
+}
+
+}  // namespace detail
+
+/// \brief A counter that distributes increments over cache-line-padded shards.
+/// \tparam StrongType The gw::strong_type that is counted.
+/// \tparam Sharding How the shard of an increment is selected.
+template <typename StrongType, shard_by Sharding = shard_by::cpu>
+class sharded_counter;
+
+/// \example sharded_counter_example.cpp
+//
+/// \brief A counter that distributes increments over cache-line-padded shards.
+//
+/// \details The class template `gw::sharded_counter` counts `gw::strong_type<T, Tag>` values for integral `T`.
+/// Increments go to one of several shards, selected by the CPU or the thread that increments, and are applied with
+/// relaxed atomics. Every shard is a gw::padded_atomic_strong_type, so that threads on different CPUs never write to
+/// the same cache line. Reads aggregate all shards, which makes them more expensive than increments, and are not a
+/// snapshot of concurrent increments. Increments follow the arithmetic policy of the tag, per shard and in the
+/// aggregation.
+/// \tparam T The type of the counted value.
+/// \tparam Tag The tag type.
+/// \tparam Sharding How the shard of an increment is selected.
+template <typename T, typename Tag, shard_by Sharding>
+  requires detail::atomic_bitwise<T> && detail::atomic_policy<T, Tag>
+class sharded_counter<strong_type<T, Tag>, Sharding> {
+ public:
+  //
+  // Public types
+  //
+
+  using value_type = strong_type<T, Tag>;                ///< The type of the counted value.
+  using shard_type = padded_atomic_strong_type<T, Tag>;  ///< The type of a shard.
+  using size_type = std::size_t;                         ///< The size type.
+
+  //
+  // Public constants
+  //
+
+  /// \brief How the shard of an increment is selected.
+  static constexpr shard_by sharding = Sharding;
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct the counter with one shard per hardware thread.
+  sharded_counter() : sharded_counter(detail::default_shard_count()) {}
+
+  /// \brief Construct the counter with at least `shard_count` shards.
+  /// \param shard_count The minimum number of shards. It is rounded up to a power of two.
+  explicit sharded_counter(size_type shard_count)
+      : m_mask(std::bit_ceil(std::max<size_type>(shard_count, 1U)) - 1U),
+        m_shards(std::make_unique<shard_type[]>(m_mask + 1U)) {}  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+  sharded_counter(const sharded_counter&) = delete;
+  sharded_counter(sharded_counter&&) = delete;
+  auto operator=(const sharded_counter&) -> sharded_counter& = delete;
+  auto operator=(sharded_counter&&) -> sharded_counter& = delete;
+
+  //
+  // Destructor
+  //
+
+  /// \brief Destroy the counter.
+  ~sharded_counter() = default;
+
+  //
+  // Modifiers
+  //
+
+  /// \brief Add `arg` to the shard of the calling thread.
+  void add(value_type arg) noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) {
+    local_shard().fetch_add(arg, std::memory_order_relaxed);
+  }
+
+  /// \brief Add one to the shard of the calling thread.
+  auto operator++() noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> sharded_counter& {
+    add(value_type{T{1}});
+    return *this;
+  }
+
+  /// \brief Add `arg` to the shard of the calling thread.
+  auto operator+=(value_type arg) noexcept(detail::k_nothrow_atomic_arithmetic<T, Tag>) -> sharded_counter& {
+    add(arg);
+    return *this;
+  }
+
+  /// \brief Set all shards to zero.
+  /// \details Increments that happen concurrently with the reset may or may not be lost.
+  void reset() noexcept {
+    for (size_type index = 0U; index <= m_mask; ++index) {
+      m_shards[index].store(value_type{}, std::memory_order_relaxed);
+    }
+  }
+
+  //
+  // Observers
+  //
+
+  /// \brief Return the sum of all shards.
+  [[nodiscard]] auto load() const -> value_type {
+    auto sum = value_type{};
+    for (size_type index = 0U; index <= m_mask; ++index) {
+      sum += m_shards[index].load(std::memory_order_relaxed);
+    }
+    return sum;
+  }
+
+  /// \brief Return the sum of all shards.
+  explicit(false) operator value_type() const { return load(); }  // NOLINT(google-explicit-constructor)
+
+  /// \brief Return the number of shards.
+  [[nodiscard]] auto shard_count() const noexcept -> size_type { return m_mask + 1U; }
+
+ private:
+  auto local_shard() noexcept -> shard_type& {
+    if constexpr (Sharding == shard_by::cpu) {
+      return m_shards[detail::cpu_shard_hint() & m_mask];
+    } else {
+      return m_shards[detail::thread_shard_hint() & m_mask];
+    }
+  }
+
+  size_type m_mask;
+  std::unique_ptr<shard_type[]> m_shards;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+};
+
+}  // namespace gw
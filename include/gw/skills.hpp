@@ -0,0 +1,362 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <concepts>
+#include <iostream>
+#include <utility>
+
+#include "gw/arithmetic.hpp"
+#include "gw/concepts.hpp"
+#include "gw/config.hpp"
+
+// Lay out all empty bases at offset zero, which MSVC does not do for more than one empty base by default
+#if defined(_MSC_VER)
+#define GW_EMPTY_BASES __declspec(empty_bases)
+#else
+#define GW_EMPTY_BASES
+#endif  // defined(_MSC_VER)
+
+/// \brief GW namespace
+namespace gw {
+
+namespace detail {
+
+template <template <typename> class Skill, template <typename> class Other>
+inline constexpr bool k_same_skill = false;
+
+template <template <typename> class Skill>
+inline constexpr bool k_same_skill<Skill, Skill> = true;
+
+/// \brief Whether the operation does not throw under the arithmetic policy of `Derived`.
+template <arithmetic_operation Operation, typename Derived>
+inline constexpr bool k_nothrow_skill_arithmetic =
+    noexcept(Derived::arithmetic_policy_type::template apply<Operation>(
+        std::declval<const typename Derived::value_type&>(), std::declval<const typename Derived::value_type&>()));
+
+/// \brief Whether the arithmetic policy of `Derived` produces a `Derived`, which can be assigned.
+template <typename Derived>
+concept assignable_skill_arithmetic = std::same_as<typename Derived::arithmetic_result_type, Derived>;
+
+}  // namespace detail
+
+/// \brief Whether `Skill` is one of `Skills`.
+template <template <typename> class Skill, template <typename> class... Skills>
+inline constexpr bool k_has_skill = (detail::k_same_skill<Skill, Skills> || ...);
+
+/// \example skills_example.cpp
+//
+/// \brief Skills, which are the capabilities that a gw::strong_type opts into.
+/// \details A skill is a mixin, which provides its operators in terms of the public interface of the derived type,
+/// i.e. `value()`, the explicit constructor and the `arithmetic_policy_type`. The operators are hidden friends, so that
+/// they are found by argument-dependent lookup only, and do not conflict with the operators of other skills. A
+/// `gw::strong_type<T, Tag, gw::skills::with<Skills...>>` declares the operators of its skills only, so that a type
+/// does not pay for the instantiation of the operators it does not use.
+///
+/// The skills of gw only take the derived objects as parameters, and are plain mixins rather than gw::crtp bases, which
+/// would add an instantiation to every skill of every type, see compile_time_benchmark. A custom skill that calls the
+/// member functions of its own object derives from gw::crtp and uses `self()`.
+namespace skills {
+
+/// \brief The skills of a gw::strong_type, e.g. `gw::skills::with<gw::skills::addable, gw::skills::hashable>`.
+/// \details The skills are wrapped, because a parameter pack of gw::strong_type itself makes every instantiation of it
+/// more expensive to compile, including those without skills.
+template <template <typename> class... Skills>
+struct with {};
+
+}  // namespace skills
+
+namespace detail {
+
+template <typename Skills>
+inline constexpr bool k_skill_set = false;
+
+template <template <typename> class... Skills>
+inline constexpr bool k_skill_set<skills::with<Skills...>> = true;
+
+/// \brief Concept for the skills of a gw::strong_type, i.e. a gw::skills::with.
+template <typename Skills>
+concept skill_set = k_skill_set<Skills>;
+
+/// \brief The skills `Skills` of `Derived`, as bases of one class, so that `Derived` does not depend on a pack.
+template <typename Skills, typename Derived>
+struct skill_bases;
+
+template <template <typename> class... Skills, typename Derived>
+struct GW_EMPTY_BASES skill_bases<skills::with<Skills...>, Derived> : Skills<Derived>... {};
+
+}  // namespace detail
+
+namespace skills {
+
+//
+// Comparison
+//
+
+/// \brief Compare objects with `==` and `!=`.
+template <typename Derived>
+struct equality_comparable {};
+
+/// \brief Compare objects with `==`, `!=`, `<`, `>`, `<=`, `>=` and `<=>`.
+template <typename Derived>
+struct comparable {};
+
+//
+// Increment and decrement
+//
+
+/// \brief Increment objects with `++`.
+template <typename Derived>
+struct incrementable {
+  /// \brief increments the contained value
+  GW_FORWARDING friend constexpr auto operator++(Derived& rhs) noexcept(noexcept(++rhs.value())) -> Derived& {
+    ++rhs.value();
+    return rhs;
+  }
+
+  /// \brief increments the contained value
+  GW_FORWARDING friend constexpr auto operator++(Derived& lhs, int) noexcept(noexcept(lhs.value()++)) -> Derived {
+    return Derived{lhs.value()++};
+  }
+};
+
+/// \brief Decrement objects with `--`.
+template <typename Derived>
+struct decrementable {
+  /// \brief decrements the contained value
+  GW_FORWARDING friend constexpr auto operator--(Derived& rhs) noexcept(noexcept(--rhs.value())) -> Derived& {
+    --rhs.value();
+    return rhs;
+  }
+
+  /// \brief decrements the contained value
+  GW_FORWARDING friend constexpr auto operator--(Derived& lhs, int) noexcept(noexcept(lhs.value()--)) -> Derived {
+    return Derived{lhs.value()--};
+  }
+};
+
+//
+// Arithmetic
+//
+
+/// \brief Affirm and negate objects with unary `+` and `-`.
+template <typename Derived>
+struct negatable {
+  /// \brief affirms the contained value
+  GW_FORWARDING friend constexpr auto operator+(const Derived& rhs) noexcept(noexcept(+rhs.value())) -> Derived {
+    return Derived{+rhs.value()};
+  }
+
+  /// \brief negates the contained value
+  GW_FORWARDING friend constexpr auto operator-(const Derived& rhs) noexcept(noexcept(-rhs.value())) -> Derived {
+    return Derived{-rhs.value()};
+  }
+};
+
+/// \brief Add objects with `+` and `+=`, under the arithmetic policy of the tag.
+template <typename Derived>
+struct addable {
+  /// \brief adds the contained values
+  GW_FORWARDING friend constexpr auto operator+(const Derived& lhs, const Derived& rhs) noexcept(
+      detail::k_nothrow_skill_arithmetic<detail::arithmetic_operation::add, Derived>) {
+    using policy = typename Derived::arithmetic_policy_type;
+    return detail::apply_arithmetic<policy, detail::arithmetic_operation::add, Derived>(lhs.value(), rhs.value());
+  }
+
+  /// \brief adds the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator+=(Derived& lhs, const Derived& rhs) noexcept(
+      detail::k_nothrow_skill_arithmetic<detail::arithmetic_operation::add, Derived>) -> Derived&
+    requires detail::assignable_skill_arithmetic<Derived>
+  {
+    using policy = typename Derived::arithmetic_policy_type;
+    lhs.value() = policy::template apply<detail::arithmetic_operation::add>(lhs.value(), rhs.value());
+    return lhs;
+  }
+};
+
+/// \brief Subtract objects with `-` and `-=`, under the arithmetic policy of the tag.
+template <typename Derived>
+struct subtractable {
+  /// \brief subtracts the contained values
+  GW_FORWARDING friend constexpr auto operator-(const Derived& lhs, const Derived& rhs) noexcept(
+      detail::k_nothrow_skill_arithmetic<detail::arithmetic_operation::subtract, Derived>) {
+    using policy = typename Derived::arithmetic_policy_type;
+    return detail::apply_arithmetic<policy, detail::arithmetic_operation::subtract, Derived>(lhs.value(), rhs.value());
+  }
+
+  /// \brief subtracts the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator-=(Derived& lhs, const Derived& rhs) noexcept(
+      detail::k_nothrow_skill_arithmetic<detail::arithmetic_operation::subtract, Derived>) -> Derived&
+    requires detail::assignable_skill_arithmetic<Derived>
+  {
+    using policy = typename Derived::arithmetic_policy_type;
+    lhs.value() = policy::template apply<detail::arithmetic_operation::subtract>(lhs.value(), rhs.value());
+    return lhs;
+  }
+};
+
+/// \brief Multiply objects with `*` and `*=`, under the arithmetic policy of the tag.
+/// \details Not available for unit and decimal tags, which define their own multiplication.
+template <typename Derived>
+struct multipliable {
+  /// \brief multiplies the contained values
+  GW_FORWARDING friend constexpr auto operator*(const Derived& lhs, const Derived& rhs) noexcept(
+      detail::k_nothrow_skill_arithmetic<detail::arithmetic_operation::multiply, Derived>)
+    requires(!scaling_tag<typename Derived::tag_type>)
+  {
+    using policy = typename Derived::arithmetic_policy_type;
+    return detail::apply_arithmetic<policy, detail::arithmetic_operation::multiply, Derived>(lhs.value(), rhs.value());
+  }
+
+  /// \brief multiplies the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator*=(Derived& lhs, const Derived& rhs) noexcept(
+      detail::k_nothrow_skill_arithmetic<detail::arithmetic_operation::multiply, Derived>) -> Derived&
+    requires(!scaling_tag<typename Derived::tag_type>) && detail::assignable_skill_arithmetic<Derived>
+  {
+    using policy = typename Derived::arithmetic_policy_type;
+    lhs.value() = policy::template apply<detail::arithmetic_operation::multiply>(lhs.value(), rhs.value());
+    return lhs;
+  }
+};
+
+/// \brief Divide objects with `/` and `/=`, under the arithmetic policy of the tag.
+/// \details Not available for unit and decimal tags, which define their own division.
+template <typename Derived>
+struct dividable {
+  /// \brief divides the contained values
+  GW_FORWARDING friend constexpr auto operator/(const Derived& lhs, const Derived& rhs) noexcept(
+      detail::k_nothrow_skill_arithmetic<detail::arithmetic_operation::divide, Derived>)
+    requires(!scaling_tag<typename Derived::tag_type>)
+  {
+    using policy = typename Derived::arithmetic_policy_type;
+    return detail::apply_arithmetic<policy, detail::arithmetic_operation::divide, Derived>(lhs.value(), rhs.value());
+  }
+
+  /// \brief divides the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator/=(Derived& lhs, const Derived& rhs) noexcept(
+      detail::k_nothrow_skill_arithmetic<detail::arithmetic_operation::divide, Derived>) -> Derived&
+    requires(!scaling_tag<typename Derived::tag_type>) && detail::assignable_skill_arithmetic<Derived>
+  {
+    using policy = typename Derived::arithmetic_policy_type;
+    lhs.value() = policy::template apply<detail::arithmetic_operation::divide>(lhs.value(), rhs.value());
+    return lhs;
+  }
+};
+
+/// \brief Calculate the remainder of objects with `%` and `%=`.
+template <typename Derived>
+struct modulable {
+  /// \brief calculates the remainder of the contained values
+  GW_FORWARDING friend constexpr auto operator%(const Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() % rhs.value())) -> Derived {
+    return Derived{lhs.value() % rhs.value()};
+  }
+
+  /// \brief calculates the remainder of the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator%=(Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() %= rhs.value())) -> Derived& {
+    lhs.value() %= rhs.value();
+    return lhs;
+  }
+};
+
+//
+// Bitwise
+//
+
+/// \brief Combine objects with `~`, `&`, `|`, `^`, `<<` and `>>`, and the compound assignments of them.
+template <typename Derived>
+struct bitwise {
+  /// \brief inverts the contained value
+  GW_FORWARDING friend constexpr auto operator~(const Derived& rhs) noexcept(noexcept(~rhs.value())) -> Derived {
+    return Derived{~rhs.value()};
+  }
+
+  /// \brief performs binary AND on the contained values
+  GW_FORWARDING friend constexpr auto operator&(const Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() & rhs.value())) -> Derived {
+    return Derived{lhs.value() & rhs.value()};
+  }
+
+  /// \brief performs binary OR on the contained values
+  GW_FORWARDING friend constexpr auto operator|(const Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() | rhs.value())) -> Derived {
+    return Derived{lhs.value() | rhs.value()};
+  }
+
+  /// \brief performs binary XOR on the contained values
+  GW_FORWARDING friend constexpr auto operator^(const Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() ^ rhs.value())) -> Derived {
+    return Derived{lhs.value() ^ rhs.value()};
+  }
+
+  /// \brief performs binary left shift on the contained values
+  GW_FORWARDING friend constexpr auto operator<<(const Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() << rhs.value())) -> Derived {
+    return Derived{lhs.value() << rhs.value()};
+  }
+
+  /// \brief performs binary right shift on the contained values
+  GW_FORWARDING friend constexpr auto operator>>(const Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() >> rhs.value())) -> Derived {
+    return Derived{lhs.value() >> rhs.value()};
+  }
+
+  /// \brief performs binary AND on the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator&=(Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() &= rhs.value())) -> Derived& {
+    lhs.value() &= rhs.value();
+    return lhs;
+  }
+
+  /// \brief performs binary OR on the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator|=(Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() |= rhs.value())) -> Derived& {
+    lhs.value() |= rhs.value();
+    return lhs;
+  }
+
+  /// \brief performs binary XOR on the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator^=(Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() ^= rhs.value())) -> Derived& {
+    lhs.value() ^= rhs.value();
+    return lhs;
+  }
+
+  /// \brief performs binary left shift on the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator<<=(Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() <<= rhs.value())) -> Derived& {
+    lhs.value() <<= rhs.value();
+    return lhs;
+  }
+
+  /// \brief performs binary right shift on the contained values and assigns the result
+  GW_FORWARDING friend constexpr auto operator>>=(Derived& lhs, const Derived& rhs) noexcept(
+      noexcept(lhs.value() >>= rhs.value())) -> Derived& {
+    lhs.value() >>= rhs.value();
+    return lhs;
+  }
+};
+
+//
+// Hashing and printing
+//
+
+/// \brief Hash objects with `std::hash`.
+template <typename Derived>
+struct hashable {};
+
+/// \brief Print objects with `operator<<` and `std::format`.
+template <typename Derived>
+struct printable {
+  /// \brief inserts formatted data
+  friend inline auto operator<<(std::ostream& ostream, const Derived& rhs) noexcept(noexcept(ostream << rhs.value()))
+      -> std::ostream& {
+    return ostream << rhs.value();
+  }
+};
+
+}  // namespace skills
+
+}  // namespace gw
@@ -0,0 +1,377 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "gw/error.hpp"
+#include "gw/hash.hpp"
+#include "gw/strong_type.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+/// \brief A generational handle to an element of a gw::slot_map.
+//
+/// \details A key consists of the index of a slot, which is a `gw::strong_type<std::uint32_t, IdTag>`, and the
+/// generation of the slot at the time the element was inserted. Erasing an element increments the generation of its
+/// slot, so keys to erased elements are detected even after the slot is reused. A default constructed key never refers
+/// to an element.
+/// \tparam IdTag The tag type of the slot index.
+template <typename IdTag>
+class slot_key {
+ public:
+  //
+  // Public types
+  //
+
+  using index_type = strong_type<std::uint32_t, IdTag>;  ///< The type of the slot index.
+  using generation_type = std::uint32_t;                 ///< The type of the generation.
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct a key that never refers to an element.
+  constexpr slot_key() noexcept = default;
+
+  /// \brief Construct the key from a slot index and a generation.
+  constexpr slot_key(index_type index, generation_type generation) noexcept
+      : m_index(index), m_generation(generation) {}
+
+  //
+  // Observers
+  //
+
+  /// \brief Return the index of the slot.
+  [[nodiscard]] constexpr auto index() const noexcept -> index_type { return m_index; }
+
+  /// \brief Return the generation of the slot at the time the element was inserted.
+  [[nodiscard]] constexpr auto generation() const noexcept -> generation_type { return m_generation; }
+
+  //
+  // Comparison operators
+  //
+
+  /// \brief Compare two keys.
+  constexpr auto operator<=>(const slot_key&) const noexcept = default;
+
+ private:
+  index_type m_index{};
+  generation_type m_generation{};
+};
+
+/// \example slot_map_example.cpp
+//
+/// \brief An associative container with O(1) insertion, erasure and lookup by generational keys.
+//
+/// \details The class template `gw::slot_map` stores its elements contiguously and hands out gw::slot_key handles.
+/// A key refers to a slot, which stores the position of the element in the dense storage and the generation of the
+/// slot. Lookup is two array accesses and a generation comparison, without hashing. Erasure moves the last element into
+/// the erased position, so iteration always covers a contiguous array, but the order of the elements is unspecified.
+/// Erased slots are reused in LIFO order; their generation is incremented, so stale keys are detected.
+/// \tparam T The type of the elements.
+/// \tparam IdTag The tag type of the slot index.
+/// \tparam Allocator The allocator type for the element storage.
+template <typename T, typename IdTag, typename Allocator = std::allocator<T>>
+class slot_map {
+ public:
+  //
+  // Public types
+  //
+
+  using key_type = slot_key<IdTag>;                                                ///< The key type.
+  using index_type = typename key_type::index_type;                                ///< The type of the slot index.
+  using generation_type = typename key_type::generation_type;                      ///< The type of the generation.
+  using value_type = T;                                                            ///< The type of the elements.
+  using allocator_type = Allocator;                                                ///< The allocator type.
+  using size_type = std::size_t;                                                   ///< The size type.
+  using difference_type = std::ptrdiff_t;                                          ///< The difference type.
+  using reference = value_type&;                                                   ///< The reference type.
+  using const_reference = const value_type&;                                       ///< The const reference type.
+  using pointer = value_type*;                                                     ///< The pointer type.
+  using const_pointer = const value_type*;                                         ///< The const pointer type.
+  using container_type = std::vector<T, Allocator>;                                ///< The type of the dense storage.
+  using iterator = typename container_type::iterator;                              ///< The iterator type.
+  using const_iterator = typename container_type::const_iterator;                  ///< The const iterator type.
+  using reverse_iterator = typename container_type::reverse_iterator;              ///< The reverse iterator type.
+  using const_reverse_iterator = typename container_type::const_reverse_iterator;  ///< The const reverse iterator.
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct an empty slot map.
+  slot_map() = default;
+
+  /// \brief Construct an empty slot map with the allocator.
+  explicit slot_map(const allocator_type& alloc) : m_values(alloc) {}
+
+  //
+  // Element access
+  //
+
+  /// \brief Return a pointer to the element referred to by `key`, or `nullptr` if `key` is stale.
+  [[nodiscard]] auto find(key_type key) noexcept -> pointer {
+    return contains(key) ? &m_values[m_slots[*key.index()].position] : nullptr;
+  }
+
+  /// \brief Return a pointer to the element referred to by `key`, or `nullptr` if `key` is stale.
+  [[nodiscard]] auto find(key_type key) const noexcept -> const_pointer {
+    return contains(key) ? &m_values[m_slots[*key.index()].position] : nullptr;
+  }
+
+  /// \brief Return the element referred to by `key`.
+  /// \throw std::out_of_range If `key` is stale.
+  [[nodiscard]] auto at(key_type key) -> reference {
+    check_key(key, "at");
+    return m_values[m_slots[*key.index()].position];
+  }
+
+  /// \brief Return the element referred to by `key`.
+  /// \throw std::out_of_range If `key` is stale.
+  [[nodiscard]] auto at(key_type key) const -> const_reference {
+    check_key(key, "at");
+    return m_values[m_slots[*key.index()].position];
+  }
+
+  /// \brief Return the element referred to by `key`.
+  /// \pre `contains(key)`
+  [[nodiscard]] auto operator[](key_type key) noexcept -> reference { return m_values[m_slots[*key.index()].position]; }
+
+  /// \brief Return the element referred to by `key`.
+  /// \pre `contains(key)`
+  [[nodiscard]] auto operator[](key_type key) const noexcept -> const_reference {
+    return m_values[m_slots[*key.index()].position];
+  }
+
+  /// \brief Return the elements as a contiguous range.
+  [[nodiscard]] auto values() noexcept -> std::span<value_type> { return m_values; }
+
+  /// \brief Return the elements as a contiguous range.
+  [[nodiscard]] auto values() const noexcept -> std::span<const value_type> { return m_values; }
+
+  /// \brief Return the key of the element at `position` in the dense storage.
+  /// \pre `position < size()`
+  [[nodiscard]] auto key_at(size_type position) const noexcept -> key_type {
+    const auto slot = m_slot_of[position];
+    return key_type{index_type{slot}, m_slots[slot].generation};
+  }
+
+  //
+  // Iterators
+  //
+
+  /// \brief Return an iterator to the first element.
+  [[nodiscard]] auto begin() noexcept -> iterator { return m_values.begin(); }
+
+  /// \brief Return an iterator to the first element.
+  [[nodiscard]] auto begin() const noexcept -> const_iterator { return m_values.begin(); }
+
+  /// \brief Return an iterator to the first element.
+  [[nodiscard]] auto cbegin() const noexcept -> const_iterator { return m_values.cbegin(); }
+
+  /// \brief Return an iterator past the last element.
+  [[nodiscard]] auto end() noexcept -> iterator { return m_values.end(); }
+
+  /// \brief Return an iterator past the last element.
+  [[nodiscard]] auto end() const noexcept -> const_iterator { return m_values.end(); }
+
+  /// \brief Return an iterator past the last element.
+  [[nodiscard]] auto cend() const noexcept -> const_iterator { return m_values.cend(); }
+
+  /// \brief Return a reverse iterator to the last element.
+  [[nodiscard]] auto rbegin() noexcept -> reverse_iterator { return m_values.rbegin(); }
+
+  /// \brief Return a reverse iterator to the last element.
+  [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator { return m_values.rbegin(); }
+
+  /// \brief Return a reverse iterator before the first element.
+  [[nodiscard]] auto rend() noexcept -> reverse_iterator { return m_values.rend(); }
+
+  /// \brief Return a reverse iterator before the first element.
+  [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator { return m_values.rend(); }
+
+  //
+  // Capacity
+  //
+
+  /// \brief Check whether the slot map is empty.
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_values.empty(); }
+
+  /// \brief Return the number of elements.
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_values.size(); }
+
+  /// \brief Return the maximum number of elements.
+  [[nodiscard]] auto max_size() const noexcept -> size_type {
+    return std::min<size_type>(m_values.max_size(), k_no_slot);
+  }
+
+  /// \brief Return the number of elements that can be held without reallocation.
+  [[nodiscard]] auto capacity() const noexcept -> size_type { return m_values.capacity(); }
+
+  /// \brief Reserve storage for `new_cap` elements.
+  /// \throw std::length_error If `new_cap` is greater than `max_size`.
+  void reserve(size_type new_cap) {
+    if (new_cap > max_size()) {
+      detail::throw_error<std::length_error>(
+          std::format("slot_map::reserve: new_cap (which is {}) > max_size (which is {})", new_cap, max_size()));
+    }
+    m_values.reserve(new_cap);
+    m_slot_of.reserve(new_cap);
+    m_slots.reserve(new_cap);
+  }
+
+  //
+  // Lookup
+  //
+
+  /// \brief Check whether `key` refers to an element.
+  [[nodiscard]] auto contains(key_type key) const noexcept -> bool {
+    const auto slot = *key.index();
+    return (key.generation() & 1U) != 0U && slot < m_slots.size() && m_slots[slot].generation == key.generation();
+  }
+
+  //
+  // Modifiers
+  //
+
+  /// \brief Insert `value`.
+  /// \return The key of the inserted element.
+  /// \throw std::length_error If the slot map is full.
+  auto insert(const value_type& value) -> key_type { return emplace(value); }
+
+  /// \brief Insert `value`.
+  /// \return The key of the inserted element.
+  /// \throw std::length_error If the slot map is full.
+  auto insert(value_type&& value) -> key_type { return emplace(std::move(value)); }
+
+  /// \brief Insert an element constructed in place from `args`.
+  /// \return The key of the inserted element.
+  /// \throw std::length_error If the slot map is full.
+  template <typename... Args>
+  auto emplace(Args&&... args) -> key_type {
+    if (size() >= max_size()) {
+      detail::throw_error<std::length_error>(
+          std::format("slot_map::emplace: size (which is {}) >= max_size (which is {})", size(), max_size()));
+    }
+
+    const auto position = static_cast<std::uint32_t>(m_values.size());
+    m_values.emplace_back(std::forward<Args>(args)...);
+
+    const auto reuse = m_free_head != k_no_slot;
+    const auto slot = reuse ? m_free_head : static_cast<std::uint32_t>(m_slots.size());
+    // Removes the element again if the slots cannot grow, without a try block, so that it builds without exceptions
+    struct rollback {
+      slot_map* self;
+      ~rollback() {
+        if (self != nullptr) {
+          self->m_values.pop_back();
+        }
+      }
+    } guard{this};
+    if (!reuse) {
+      m_slots.push_back(slot_entry{k_no_slot, generation_type{}});
+    }
+    m_slot_of.push_back(slot);
+    guard.self = nullptr;
+
+    auto& entry = m_slots[slot];
+    if (reuse) {
+      m_free_head = entry.position;
+    }
+    entry.position = position;
+    ++entry.generation;
+    return key_type{index_type{slot}, entry.generation};
+  }
+
+  /// \brief Erase the element referred to by `key`.
+  /// \details The last element is moved into the position of the erased element.
+  /// \return True if an element was erased, false if `key` is stale.
+  auto erase(key_type key) noexcept(std::is_nothrow_move_assignable_v<value_type>) -> bool {
+    if (!contains(key)) {
+      return false;
+    }
+
+    const auto slot = *key.index();
+    const auto position = m_slots[slot].position;
+    const auto last = static_cast<std::uint32_t>(m_values.size() - 1U);
+    if (position != last) {
+      m_values[position] = std::move(m_values[last]);
+      m_slot_of[position] = m_slot_of[last];
+      m_slots[m_slot_of[position]].position = position;
+    }
+    m_values.pop_back();
+    m_slot_of.pop_back();
+    release(slot);
+    return true;
+  }
+
+  /// \brief Erase all elements.
+  /// \details All keys become stale.
+  void clear() noexcept {
+    for (const auto slot : m_slot_of) {
+      release(slot);
+    }
+    m_values.clear();
+    m_slot_of.clear();
+  }
+
+ private:
+  static constexpr std::uint32_t k_no_slot = std::numeric_limits<std::uint32_t>::max();
+
+  /// The generation of a slot is odd while the slot holds an element and even while it is free. Insertion and erasure
+  /// both increment it, and it wraps around to zero.
+  /// The position is that of the element in the dense storage, or the next free slot if the slot is free.
+  struct slot_entry {
+    std::uint32_t position;
+    generation_type generation;
+  };
+
+  void release(std::uint32_t slot) noexcept {
+    auto& entry = m_slots[slot];
+    ++entry.generation;
+    entry.position = m_free_head;
+    m_free_head = slot;
+  }
+
+  void check_key(key_type key, const char* function) const {
+    if (!contains(key)) {
+      detail::throw_error<std::out_of_range>(std::format("slot_map::{}: key (index {}, generation {}) is stale",
+                                                         function, *key.index(), key.generation()));
+    }
+  }
+
+  container_type m_values;
+  std::vector<std::uint32_t> m_slot_of;
+  std::vector<slot_entry> m_slots;
+  std::uint32_t m_free_head{k_no_slot};
+};
+
+}  // namespace gw
+
+namespace std {
+
+/// \brief hash support for gw::slot_key
+template <typename IdTag>
+// NOLINTNEXTLINE(cert-dcl58-cpp)
+struct hash<::gw::slot_key<IdTag>> {
+  [[nodiscard]] auto inline operator()(const ::gw::slot_key<IdTag>& key) const noexcept -> size_t {
+    return ::gw::hash_tuple(key.index(), key.generation());
+  }
+};
+
+}  // namespace std
@@ -0,0 +1,710 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "gw/error.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+namespace detail {
+
+/// \brief The type of the words that the bitsets store their bits in.
+using bitset_word = std::uint64_t;
+
+/// \brief The number of bits per word.
+inline constexpr std::size_t k_bitset_word_bits = std::numeric_limits<bitset_word>::digits;
+
+/// \brief Return the number of words needed to store `bits` bits.
+constexpr auto bitset_words(std::size_t bits) noexcept -> std::size_t {
+  return (bits + k_bitset_word_bits - 1U) / k_bitset_word_bits;
+}
+
+/// \brief Return the mask of the bits in use in the last word of a bitset with `bits` bits.
+constexpr auto bitset_last_word_mask(std::size_t bits) noexcept -> bitset_word {
+  const auto used = bits % k_bitset_word_bits;
+  return used == 0U ? ~bitset_word{} : (bitset_word{1U} << used) - 1U;
+}
+
+//
+// Word-wise algorithms
+//
+// The loops run over raw words with no early exit and no cross-iteration dependency other than reductions, so the
+// compiler vectorizes them.
+//
+
+/// \brief `lhs &= rhs`
+constexpr void bitset_and(std::span<bitset_word> lhs, std::span<const bitset_word> rhs) noexcept {
+  for (std::size_t index = 0U; index < lhs.size(); ++index) {
+    lhs[index] &= rhs[index];
+  }
+}
+
+/// \brief `lhs |= rhs`
+constexpr void bitset_or(std::span<bitset_word> lhs, std::span<const bitset_word> rhs) noexcept {
+  for (std::size_t index = 0U; index < lhs.size(); ++index) {
+    lhs[index] |= rhs[index];
+  }
+}
+
+/// \brief `lhs ^= rhs`
+constexpr void bitset_xor(std::span<bitset_word> lhs, std::span<const bitset_word> rhs) noexcept {
+  for (std::size_t index = 0U; index < lhs.size(); ++index) {
+    lhs[index] ^= rhs[index];
+  }
+}
+
+/// \brief `lhs &= ~rhs`
+constexpr void bitset_and_not(std::span<bitset_word> lhs, std::span<const bitset_word> rhs) noexcept {
+  for (std::size_t index = 0U; index < lhs.size(); ++index) {
+    lhs[index] &= ~rhs[index];
+  }
+}
+
+/// \brief `words = ~words`, keeping the bits past `bits` zero.
+constexpr void bitset_flip(std::span<bitset_word> words, std::size_t bits) noexcept {
+  for (auto& word : words) {
+    word = ~word;
+  }
+  if (!words.empty()) {
+    words.back() &= bitset_last_word_mask(bits);
+  }
+}
+
+/// \brief Set all words to `value`, keeping the bits past `bits` zero.
+constexpr void bitset_fill(std::span<bitset_word> words, std::size_t bits, bool value) noexcept {
+  std::ranges::fill(words, value ? ~bitset_word{} : bitset_word{});
+  if (!words.empty()) {
+    words.back() &= bitset_last_word_mask(bits);
+  }
+}
+
+/// \brief Return the number of set bits.
+constexpr auto bitset_count(std::span<const bitset_word> words) noexcept -> std::size_t {
+  auto count = std::size_t{};
+  for (const auto word : words) {
+    count += static_cast<std::size_t>(std::popcount(word));
+  }
+  return count;
+}
+
+/// \brief Return whether `lhs & rhs` has any set bit.
+constexpr auto bitset_intersects(std::span<const bitset_word> lhs, std::span<const bitset_word> rhs) noexcept -> bool {
+  auto any = bitset_word{};
+  for (std::size_t index = 0U; index < lhs.size(); ++index) {
+    any |= lhs[index] & rhs[index];
+  }
+  return any != 0U;
+}
+
+/// \brief Return whether every set bit of `lhs` is set in `rhs`.
+constexpr auto bitset_is_subset_of(std::span<const bitset_word> lhs, std::span<const bitset_word> rhs) noexcept
+    -> bool {
+  auto extra = bitset_word{};
+  for (std::size_t index = 0U; index < lhs.size(); ++index) {
+    extra |= lhs[index] & ~rhs[index];
+  }
+  return extra == 0U;
+}
+
+/// \brief Return the position of the first set bit at or after `pos`, or `npos` if there is none.
+constexpr auto bitset_find_from(std::span<const bitset_word> words, std::size_t pos, std::size_t npos) noexcept
+    -> std::size_t {
+  auto index = pos / k_bitset_word_bits;
+  if (index >= words.size()) {
+    return npos;
+  }
+  auto word = words[index] & (~bitset_word{} << (pos % k_bitset_word_bits));
+  while (word == 0U) {
+    if (++index == words.size()) {
+      return npos;
+    }
+    word = words[index];
+  }
+  return index * k_bitset_word_bits + static_cast<std::size_t>(std::countr_zero(word));
+}
+
+}  // namespace detail
+
+/// \brief A forward iterator over the positions of the set bits of a bitset.
+class set_bit_iterator {
+ public:
+  //
+  // Public types
+  //
+
+  using iterator_concept = std::forward_iterator_tag;  ///< The iterator concept.
+  using iterator_category = std::forward_iterator_tag;  ///< The iterator category.
+  using value_type = std::size_t;                       ///< The position of a set bit.
+  using difference_type = std::ptrdiff_t;               ///< The difference type.
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct the end iterator.
+  constexpr set_bit_iterator() noexcept = default;
+
+  /// \brief Construct the iterator to the first set bit of `words`.
+  constexpr explicit set_bit_iterator(std::span<const detail::bitset_word> words) noexcept : m_words(words) {
+    if (!m_words.empty()) {
+      m_word = m_words.front();
+      skip_empty_words();
+    }
+  }
+
+  //
+  // Operations
+  //
+
+  /// \brief Return the position of the current set bit.
+  constexpr auto operator*() const noexcept -> value_type {
+    return m_index * detail::k_bitset_word_bits + static_cast<std::size_t>(std::countr_zero(m_word));
+  }
+
+  /// \brief Advance to the next set bit.
+  constexpr auto operator++() noexcept -> set_bit_iterator& {
+    m_word &= m_word - 1U;
+    skip_empty_words();
+    return *this;
+  }
+
+  /// \brief Advance to the next set bit.
+  constexpr auto operator++(int) noexcept -> set_bit_iterator {
+    auto copy = *this;
+    ++*this;
+    return copy;
+  }
+
+  /// \brief Compare two iterators.
+  constexpr auto operator==(const set_bit_iterator& rhs) const noexcept -> bool {
+    return m_index == rhs.m_index && m_word == rhs.m_word;
+  }
+
+  /// \brief Compare the iterator with the end.
+  constexpr auto operator==(std::default_sentinel_t /*sentinel*/) const noexcept -> bool { return m_word == 0U; }
+
+ private:
+  constexpr void skip_empty_words() noexcept {
+    while (m_word == 0U && m_index + 1U < m_words.size()) {
+      m_word = m_words[++m_index];
+    }
+    if (m_word == 0U) {
+      m_index = 0U;
+    }
+  }
+
+  std::span<const detail::bitset_word> m_words;
+  std::size_t m_index{};
+  detail::bitset_word m_word{};
+};
+
+/// \brief The range of the positions of the set bits of a bitset.
+class set_bit_range {
+ public:
+  /// \brief Construct the range over `words`.
+  constexpr explicit set_bit_range(std::span<const detail::bitset_word> words) noexcept : m_words(words) {}
+
+  /// \brief Return an iterator to the first set bit.
+  [[nodiscard]] constexpr auto begin() const noexcept -> set_bit_iterator { return set_bit_iterator{m_words}; }
+
+  /// \brief Return the end iterator.
+  [[nodiscard]] constexpr auto end() const noexcept -> set_bit_iterator { return set_bit_iterator{}; }
+
+ private:
+  std::span<const detail::bitset_word> m_words;
+};
+
+/// \example strong_bitset_example.cpp
+//
+/// \brief A fixed-size bitset that is distinct per tag.
+//
+/// \details The class template `gw::strong_bitset` stores `Bits` bits in 64-bit words. Bitsets with different tags are
+/// different types, so that for example permission masks cannot be combined with feature masks. The set operations,
+/// population count and subset tests are word-wise loops without early exits, which the compiler vectorizes. Set bits
+/// are found with `std::countr_zero` and iterated with `set_bits()`.
+/// \tparam Bits The number of bits.
+/// \tparam Tag The tag type.
+template <std::size_t Bits, typename Tag>
+class strong_bitset {
+ public:
+  //
+  // Public types
+  //
+
+  using tag_type = Tag;                     ///< The tag type.
+  using size_type = std::size_t;            ///< The size type.
+  using word_type = detail::bitset_word;    ///< The type of the words that store the bits.
+
+  //
+  // Public constants
+  //
+
+  /// \brief The value returned by the find functions if no set bit is found.
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct the bitset with all bits reset.
+  constexpr strong_bitset() noexcept = default;
+
+  //
+  // Element access
+  //
+
+  /// \brief Return the value of the bit at `pos`.
+  /// \throw std::out_of_range If `pos` is not less than `size()`.
+  [[nodiscard]] constexpr auto test(size_type pos) const -> bool {
+    check_position(pos, "test");
+    return (*this)[pos];
+  }
+
+  /// \brief Return the value of the bit at `pos`.
+  /// \pre `pos < size()`
+  [[nodiscard]] constexpr auto operator[](size_type pos) const noexcept -> bool {
+    return ((m_words[pos / detail::k_bitset_word_bits] >> (pos % detail::k_bitset_word_bits)) & 1U) != 0U;
+  }
+
+  /// \brief Return the words that store the bits. The bits past `size()` are zero.
+  [[nodiscard]] constexpr auto words() const noexcept -> std::span<const word_type> { return m_words; }
+
+  //
+  // Capacity
+  //
+
+  /// \brief Return the number of bits.
+  [[nodiscard]] static constexpr auto size() noexcept -> size_type { return Bits; }
+
+  //
+  // Observers
+  //
+
+  /// \brief Return the number of set bits.
+  [[nodiscard]] constexpr auto count() const noexcept -> size_type { return detail::bitset_count(m_words); }
+
+  /// \brief Check whether all bits are set.
+  [[nodiscard]] constexpr auto all() const noexcept -> bool { return count() == size(); }
+
+  /// \brief Check whether any bit is set.
+  [[nodiscard]] constexpr auto any() const noexcept -> bool { return !none(); }
+
+  /// \brief Check whether no bit is set.
+  [[nodiscard]] constexpr auto none() const noexcept -> bool {
+    return std::ranges::all_of(m_words, [](word_type word) { return word == 0U; });
+  }
+
+  /// \brief Check whether any bit is set in both bitsets.
+  [[nodiscard]] constexpr auto intersects(const strong_bitset& rhs) const noexcept -> bool {
+    return detail::bitset_intersects(m_words, rhs.m_words);
+  }
+
+  /// \brief Check whether every set bit is also set in `rhs`.
+  [[nodiscard]] constexpr auto is_subset_of(const strong_bitset& rhs) const noexcept -> bool {
+    return detail::bitset_is_subset_of(m_words, rhs.m_words);
+  }
+
+  /// \brief Return the position of the first set bit, or `npos` if no bit is set.
+  [[nodiscard]] constexpr auto find_first() const noexcept -> size_type {
+    return detail::bitset_find_from(m_words, 0U, npos);
+  }
+
+  /// \brief Return the position of the first set bit after `pos`, or `npos` if there is none or `pos` is out of range.
+  [[nodiscard]] constexpr auto find_next(size_type pos) const noexcept -> size_type {
+    return pos >= size() || pos + 1U >= size() ? npos : detail::bitset_find_from(m_words, pos + 1U, npos);
+  }
+
+  /// \brief Return the range of the positions of the set bits, in ascending order.
+  [[nodiscard]] constexpr auto set_bits() const noexcept -> set_bit_range { return set_bit_range{m_words}; }
+
+  //
+  // Modifiers
+  //
+
+  /// \brief Set all bits.
+  constexpr auto set() noexcept -> strong_bitset& {
+    detail::bitset_fill(m_words, Bits, true);
+    return *this;
+  }
+
+  /// \brief Set the bit at `pos` to `value`.
+  /// \throw std::out_of_range If `pos` is not less than `size()`.
+  constexpr auto set(size_type pos, bool value = true) -> strong_bitset& {
+    check_position(pos, "set");
+    const auto mask = word_type{1U} << (pos % detail::k_bitset_word_bits);
+    auto& word = m_words[pos / detail::k_bitset_word_bits];
+    word = value ? word | mask : word & ~mask;
+    return *this;
+  }
+
+  /// \brief Reset all bits.
+  constexpr auto reset() noexcept -> strong_bitset& {
+    detail::bitset_fill(m_words, Bits, false);
+    return *this;
+  }
+
+  /// \brief Reset the bit at `pos`.
+  /// \throw std::out_of_range If `pos` is not less than `size()`.
+  constexpr auto reset(size_type pos) -> strong_bitset& { return set(pos, false); }
+
+  /// \brief Reset the bits that are set in `mask`.
+  constexpr auto reset(const strong_bitset& mask) noexcept -> strong_bitset& {
+    detail::bitset_and_not(m_words, mask.m_words);
+    return *this;
+  }
+
+  /// \brief Flip all bits.
+  constexpr auto flip() noexcept -> strong_bitset& {
+    detail::bitset_flip(m_words, Bits);
+    return *this;
+  }
+
+  /// \brief Flip the bit at `pos`.
+  /// \throw std::out_of_range If `pos` is not less than `size()`.
+  constexpr auto flip(size_type pos) -> strong_bitset& {
+    check_position(pos, "flip");
+    m_words[pos / detail::k_bitset_word_bits] ^= word_type{1U} << (pos % detail::k_bitset_word_bits);
+    return *this;
+  }
+
+  //
+  // Bitwise operators
+  //
+
+  /// \brief Set the bits to the intersection with `rhs`.
+  constexpr auto operator&=(const strong_bitset& rhs) noexcept -> strong_bitset& {
+    detail::bitset_and(m_words, rhs.m_words);
+    return *this;
+  }
+
+  /// \brief Set the bits to the union with `rhs`.
+  constexpr auto operator|=(const strong_bitset& rhs) noexcept -> strong_bitset& {
+    detail::bitset_or(m_words, rhs.m_words);
+    return *this;
+  }
+
+  /// \brief Set the bits to the symmetric difference with `rhs`.
+  constexpr auto operator^=(const strong_bitset& rhs) noexcept -> strong_bitset& {
+    detail::bitset_xor(m_words, rhs.m_words);
+    return *this;
+  }
+
+  /// \brief Return the complement of the bitset.
+  [[nodiscard]] constexpr auto operator~() const noexcept -> strong_bitset { return strong_bitset{*this}.flip(); }
+
+  /// \brief Return the intersection of two bitsets.
+  [[nodiscard]] friend constexpr auto operator&(strong_bitset lhs, const strong_bitset& rhs) noexcept -> strong_bitset {
+    return lhs &= rhs;
+  }
+
+  /// \brief Return the union of two bitsets.
+  [[nodiscard]] friend constexpr auto operator|(strong_bitset lhs, const strong_bitset& rhs) noexcept -> strong_bitset {
+    return lhs |= rhs;
+  }
+
+  /// \brief Return the symmetric difference of two bitsets.
+  [[nodiscard]] friend constexpr auto operator^(strong_bitset lhs, const strong_bitset& rhs) noexcept -> strong_bitset {
+    return lhs ^= rhs;
+  }
+
+  /// \brief Return the bits of `lhs` that are not set in `rhs`.
+  [[nodiscard]] friend constexpr auto and_not(strong_bitset lhs, const strong_bitset& rhs) noexcept -> strong_bitset {
+    return lhs.reset(rhs);
+  }
+
+  //
+  // Comparison operators
+  //
+
+  /// \brief Compare two bitsets for equality.
+  constexpr auto operator==(const strong_bitset&) const noexcept -> bool = default;
+
+ private:
+  constexpr void check_position(size_type pos, const char* function) const {
+    if (pos >= size()) {
+      detail::throw_error<std::out_of_range>(
+          std::format("strong_bitset::{}: pos (which is {}) >= size (which is {})", function, pos, size()));
+    }
+  }
+
+  std::array<word_type, detail::bitset_words(Bits)> m_words{};
+};
+
+/// \brief A dynamically sized bitset that is distinct per tag.
+//
+/// \details The class template `gw::dynamic_strong_bitset` provides the operations of gw::strong_bitset for a number of
+/// bits that is chosen at run time. Set operations between bitsets of different sizes throw `std::invalid_argument`.
+/// \tparam Tag The tag type.
+/// \tparam Allocator The allocator type for the words.
+template <typename Tag, typename Allocator = std::allocator<detail::bitset_word>>
+class dynamic_strong_bitset {
+ public:
+  //
+  // Public types
+  //
+
+  using tag_type = Tag;                     ///< The tag type.
+  using size_type = std::size_t;            ///< The size type.
+  using word_type = detail::bitset_word;    ///< The type of the words that store the bits.
+  using allocator_type = Allocator;         ///< The allocator type.
+
+  //
+  // Public constants
+  //
+
+  /// \brief The value returned by the find functions if no set bit is found.
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct an empty bitset.
+  dynamic_strong_bitset() = default;
+
+  /// \brief Construct the bitset with `bits` bits set to `value`.
+  explicit dynamic_strong_bitset(size_type bits, bool value = false, const allocator_type& alloc = allocator_type{})
+      : m_words(detail::bitset_words(bits), word_type{}, alloc), m_bits(bits) {
+    detail::bitset_fill(m_words, m_bits, value);
+  }
+
+  //
+  // Element access
+  //
+
+  /// \brief Return the value of the bit at `pos`.
+  /// \throw std::out_of_range If `pos` is not less than `size()`.
+  [[nodiscard]] auto test(size_type pos) const -> bool {
+    check_position(pos, "test");
+    return (*this)[pos];
+  }
+
+  /// \brief Return the value of the bit at `pos`.
+  /// \pre `pos < size()`
+  [[nodiscard]] auto operator[](size_type pos) const noexcept -> bool {
+    return ((m_words[pos / detail::k_bitset_word_bits] >> (pos % detail::k_bitset_word_bits)) & 1U) != 0U;
+  }
+
+  /// \brief Return the words that store the bits. The bits past `size()` are zero.
+  [[nodiscard]] auto words() const noexcept -> std::span<const word_type> { return m_words; }
+
+  //
+  // Capacity
+  //
+
+  /// \brief Return the number of bits.
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_bits; }
+
+  /// \brief Check whether the bitset has no bits.
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_bits == 0U; }
+
+  /// \brief Change the number of bits to `bits`. New bits are set to `value`.
+  void resize(size_type bits, bool value = false) {
+    const auto old_bits = m_bits;
+    m_words.resize(detail::bitset_words(bits), value ? ~word_type{} : word_type{});
+    m_bits = bits;
+    if (value && old_bits % detail::k_bitset_word_bits != 0U && old_bits < bits) {
+      m_words[old_bits / detail::k_bitset_word_bits] |= ~detail::bitset_last_word_mask(old_bits);
+    }
+    if (!m_words.empty()) {
+      m_words.back() &= detail::bitset_last_word_mask(m_bits);
+    }
+  }
+
+  //
+  // Observers
+  //
+
+  /// \brief Return the number of set bits.
+  [[nodiscard]] auto count() const noexcept -> size_type { return detail::bitset_count(m_words); }
+
+  /// \brief Check whether all bits are set.
+  [[nodiscard]] auto all() const noexcept -> bool { return count() == size(); }
+
+  /// \brief Check whether any bit is set.
+  [[nodiscard]] auto any() const noexcept -> bool { return !none(); }
+
+  /// \brief Check whether no bit is set.
+  [[nodiscard]] auto none() const noexcept -> bool {
+    return std::ranges::all_of(m_words, [](word_type word) { return word == 0U; });
+  }
+
+  /// \brief Check whether any bit is set in both bitsets.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  [[nodiscard]] auto intersects(const dynamic_strong_bitset& rhs) const -> bool {
+    check_size(rhs, "intersects");
+    return detail::bitset_intersects(m_words, rhs.m_words);
+  }
+
+  /// \brief Check whether every set bit is also set in `rhs`.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  [[nodiscard]] auto is_subset_of(const dynamic_strong_bitset& rhs) const -> bool {
+    check_size(rhs, "is_subset_of");
+    return detail::bitset_is_subset_of(m_words, rhs.m_words);
+  }
+
+  /// \brief Return the position of the first set bit, or `npos` if no bit is set.
+  [[nodiscard]] auto find_first() const noexcept -> size_type { return detail::bitset_find_from(m_words, 0U, npos); }
+
+  /// \brief Return the position of the first set bit after `pos`, or `npos` if there is none or `pos` is out of range.
+  [[nodiscard]] auto find_next(size_type pos) const noexcept -> size_type {
+    return pos >= size() || pos + 1U >= size() ? npos : detail::bitset_find_from(m_words, pos + 1U, npos);
+  }
+
+  /// \brief Return the range of the positions of the set bits, in ascending order.
+  [[nodiscard]] auto set_bits() const noexcept -> set_bit_range { return set_bit_range{m_words}; }
+
+  //
+  // Modifiers
+  //
+
+  /// \brief Set all bits.
+  auto set() noexcept -> dynamic_strong_bitset& {
+    detail::bitset_fill(m_words, m_bits, true);
+    return *this;
+  }
+
+  /// \brief Set the bit at `pos` to `value`.
+  /// \throw std::out_of_range If `pos` is not less than `size()`.
+  auto set(size_type pos, bool value = true) -> dynamic_strong_bitset& {
+    check_position(pos, "set");
+    const auto mask = word_type{1U} << (pos % detail::k_bitset_word_bits);
+    auto& word = m_words[pos / detail::k_bitset_word_bits];
+    word = value ? word | mask : word & ~mask;
+    return *this;
+  }
+
+  /// \brief Reset all bits.
+  auto reset() noexcept -> dynamic_strong_bitset& {
+    detail::bitset_fill(m_words, m_bits, false);
+    return *this;
+  }
+
+  /// \brief Reset the bit at `pos`.
+  /// \throw std::out_of_range If `pos` is not less than `size()`.
+  auto reset(size_type pos) -> dynamic_strong_bitset& { return set(pos, false); }
+
+  /// \brief Reset the bits that are set in `mask`.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  auto reset(const dynamic_strong_bitset& mask) -> dynamic_strong_bitset& {
+    check_size(mask, "reset");
+    detail::bitset_and_not(m_words, mask.m_words);
+    return *this;
+  }
+
+  /// \brief Flip all bits.
+  auto flip() noexcept -> dynamic_strong_bitset& {
+    detail::bitset_flip(m_words, m_bits);
+    return *this;
+  }
+
+  /// \brief Flip the bit at `pos`.
+  /// \throw std::out_of_range If `pos` is not less than `size()`.
+  auto flip(size_type pos) -> dynamic_strong_bitset& {
+    check_position(pos, "flip");
+    m_words[pos / detail::k_bitset_word_bits] ^= word_type{1U} << (pos % detail::k_bitset_word_bits);
+    return *this;
+  }
+
+  //
+  // Bitwise operators
+  //
+
+  /// \brief Set the bits to the intersection with `rhs`.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  auto operator&=(const dynamic_strong_bitset& rhs) -> dynamic_strong_bitset& {
+    check_size(rhs, "operator&=");
+    detail::bitset_and(m_words, rhs.m_words);
+    return *this;
+  }
+
+  /// \brief Set the bits to the union with `rhs`.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  auto operator|=(const dynamic_strong_bitset& rhs) -> dynamic_strong_bitset& {
+    check_size(rhs, "operator|=");
+    detail::bitset_or(m_words, rhs.m_words);
+    return *this;
+  }
+
+  /// \brief Set the bits to the symmetric difference with `rhs`.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  auto operator^=(const dynamic_strong_bitset& rhs) -> dynamic_strong_bitset& {
+    check_size(rhs, "operator^=");
+    detail::bitset_xor(m_words, rhs.m_words);
+    return *this;
+  }
+
+  /// \brief Return the complement of the bitset.
+  [[nodiscard]] auto operator~() const -> dynamic_strong_bitset { return dynamic_strong_bitset{*this}.flip(); }
+
+  /// \brief Return the intersection of two bitsets.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  [[nodiscard]] friend auto operator&(dynamic_strong_bitset lhs, const dynamic_strong_bitset& rhs)
+      -> dynamic_strong_bitset {
+    return std::move(lhs &= rhs);
+  }
+
+  /// \brief Return the union of two bitsets.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  [[nodiscard]] friend auto operator|(dynamic_strong_bitset lhs, const dynamic_strong_bitset& rhs)
+      -> dynamic_strong_bitset {
+    return std::move(lhs |= rhs);
+  }
+
+  /// \brief Return the symmetric difference of two bitsets.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  [[nodiscard]] friend auto operator^(dynamic_strong_bitset lhs, const dynamic_strong_bitset& rhs)
+      -> dynamic_strong_bitset {
+    return std::move(lhs ^= rhs);
+  }
+
+  /// \brief Return the bits of `lhs` that are not set in `rhs`.
+  /// \throw std::invalid_argument If the sizes of the bitsets differ.
+  [[nodiscard]] friend auto and_not(dynamic_strong_bitset lhs, const dynamic_strong_bitset& rhs)
+      -> dynamic_strong_bitset {
+    return std::move(lhs.reset(rhs));
+  }
+
+  //
+  // Comparison operators
+  //
+
+  /// \brief Compare two bitsets for equality.
+  auto operator==(const dynamic_strong_bitset&) const noexcept -> bool = default;
+
+ private:
+  void check_position(size_type pos, const char* function) const {
+    if (pos >= size()) {
+      detail::throw_error<std::out_of_range>(
+          std::format("dynamic_strong_bitset::{}: pos (which is {}) >= size (which is {})", function, pos, size()));
+    }
+  }
+
+  void check_size(const dynamic_strong_bitset& rhs, const char* function) const {
+    if (rhs.size() != size()) {
+      detail::throw_error<std::invalid_argument>(
+          std::format("dynamic_strong_bitset::{}: rhs.size() (which is {}) != size (which is {})", function, rhs.size(),
+                      size()));
+    }
+  }
+
+  std::vector<word_type, Allocator> m_words;
+  size_type m_bits{};
+};
+
+}  // namespace gw
@@ -11,12 +11,16 @@
 #include <initializer_list>
 #include <iostream>
 #include <ranges>
+#include <span>
 #include <string>
 #include <type_traits>
-#include <typeindex>
 #include <utility>
 
+#include "gw/arithmetic.hpp"
 #include "gw/concepts.hpp"
+#include "gw/config.hpp"
+#include "gw/hash.hpp"
+#include "gw/skills.hpp"
 
 /// \brief GW namespace
 namespace gw {
@@ -27,6 +31,13 @@ struct strong_type_empty_base {
   constexpr auto operator<=>(const strong_type_empty_base&) const noexcept -> std::strong_ordering = default;
 };
 
+/// \brief Whether a gw::strong_type with the skills `Skills` has the skill `Skill`; one without skills has all of them.
+template <template <typename> class Skill, typename Skills>
+inline constexpr bool k_strong_type_has_skill = true;
+
+template <template <typename> class Skill, template <typename> class... Skills>
+inline constexpr bool k_strong_type_has_skill<Skill, skills::with<Skills...>> = k_has_skill<Skill, Skills...>;
+
 }  // namespace detail
 
 /// \example strong_type_example.cpp
@@ -39,10 +50,14 @@ struct strong_type_empty_base {
 /// type. For example, a `std::string` can be used to represent a person's name, but it can also be used to represent a
 /// person's address. Using `gw::strong_type` to create a `name_t` and an `address_t` allows the compiler to catch
 /// errors where a `name_t` is used where an `address_t` is expected, and vice versa.
+///
+/// Without skills, a gw::strong_type provides every operator that `T` supports. With skills, e.g.
+/// `gw::strong_type<T, Tag, gw::skills::with<gw::skills::addable, gw::skills::comparable>>`, it provides only the
+/// operators of the skills, see gw::skills.
 //
-template <typename T, typename Tag>
+template <typename T, typename Tag, typename Skills = void>
 class strong_type final
-    : public std::conditional_t<std::ranges::range<T>, std::ranges::view_interface<strong_type<T, Tag>>,
+    : public std::conditional_t<std::ranges::range<T>, std::ranges::view_interface<strong_type<T, Tag, Skills>>,
                                 detail::strong_type_empty_base> {
  public:
   //
@@ -52,19 +67,27 @@ class strong_type final
   using value_type = T;  ///< The type of the contained value.
   using tag_type = Tag;  ///< The tag type.
 
+  /// \brief The arithmetic policy of `+`, `-`, `*` and `/`, declared by the tag as `Tag::arithmetic_policy`.
+  /// \details Defaults to gw::unchecked_arithmetic, which performs the raw operations of the contained type.
+  using arithmetic_policy_type = detail::tag_arithmetic_policy_t<Tag>;
+
+  /// \brief The result type of `+`, `-`, `*` and `/`, which is `std::expected` under gw::expected_arithmetic.
+  using arithmetic_result_type = detail::arithmetic_result_t<arithmetic_policy_type, strong_type>;
+
   //
   // Constructors
   //
 
   /// \brief Construct the gw::strong_type object
   template <typename... Args>
-  constexpr explicit strong_type(Args&&... args) noexcept(std::is_nothrow_constructible_v<value_type, Args...>)
+  GW_FORWARDING constexpr explicit strong_type(Args&&... args) noexcept(
+      std::is_nothrow_constructible_v<value_type, Args...>)
     requires std::constructible_from<value_type, Args...>
       : m_value(value_type{std::forward<Args>(args)...}) {}
 
   /// \brief constructs the gw::strong_type object
   template <typename U, typename... Args>
-  constexpr strong_type(std::initializer_list<U> ilist, Args&&... args) noexcept(
+  GW_FORWARDING constexpr strong_type(std::initializer_list<U> ilist, Args&&... args) noexcept(
       std::is_nothrow_constructible_v<value_type, std::initializer_list<U>&, Args...>)
     requires std::constructible_from<value_type, std::initializer_list<U>&, Args...>
       : m_value(value_type{ilist, std::forward<Args>(args)...}) {}
@@ -81,34 +104,34 @@ class strong_type final
   //
 
   /// \brief accesses the contained value
-  constexpr auto operator->() const noexcept -> const value_type* { return &m_value; }
+  GW_FORWARDING constexpr auto operator->() const noexcept -> const value_type* { return &m_value; }
 
   /// \brief accesses the contained value
-  constexpr auto operator->() noexcept -> value_type* { return &m_value; }
+  GW_FORWARDING constexpr auto operator->() noexcept -> value_type* { return &m_value; }
 
   /// \brief accesses the contained value
-  constexpr auto operator*() const& noexcept -> const value_type& { return m_value; }
+  GW_FORWARDING constexpr auto operator*() const& noexcept -> const value_type& { return m_value; }
 
   /// \brief accesses the contained value
-  constexpr auto operator*() & noexcept -> value_type& { return m_value; }
+  GW_FORWARDING constexpr auto operator*() & noexcept -> value_type& { return m_value; }
 
   /// \brief accesses the contained value
-  constexpr auto operator*() const&& noexcept -> const value_type&& { return std::move(m_value); }
+  GW_FORWARDING constexpr auto operator*() const&& noexcept -> const value_type&& { return std::move(m_value); }
 
   /// \brief accesses the contained value
-  constexpr auto operator*() && noexcept -> value_type&& { return std::move(m_value); }
+  GW_FORWARDING constexpr auto operator*() && noexcept -> value_type&& { return std::move(m_value); }
 
   /// \brief returns the contained value
-  constexpr auto value() const& noexcept -> const value_type& { return m_value; }
+  GW_FORWARDING constexpr auto value() const& noexcept -> const value_type& { return m_value; }
 
   /// \brief returns the contained value
-  constexpr auto value() & noexcept -> value_type& { return m_value; }
+  GW_FORWARDING constexpr auto value() & noexcept -> value_type& { return m_value; }
 
   /// \brief returns the contained value
-  constexpr auto value() const&& noexcept -> const value_type&& { return std::move(m_value); }
+  GW_FORWARDING constexpr auto value() const&& noexcept -> const value_type&& { return std::move(m_value); }
 
   /// \brief returns the contained value
-  constexpr auto value() && noexcept -> value_type&& { return std::move(m_value); }
+  GW_FORWARDING constexpr auto value() && noexcept -> value_type&& { return std::move(m_value); }
 
   //
   // Monadic operations
@@ -180,50 +203,56 @@ class strong_type final
   //
 
   /// \brief compares gw::strong_type objects
-  constexpr auto operator==(const strong_type& rhs) const& noexcept(noexcept(m_value == rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator==(const strong_type& rhs) const& noexcept(noexcept(m_value == rhs.m_value))
+      -> bool
     requires std::equality_comparable<value_type>
   {
     return m_value == rhs.m_value;
   }
 
   /// \brief compares gw::strong_type objects
-  constexpr auto operator!=(const strong_type& rhs) const& noexcept(noexcept(m_value != rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator!=(const strong_type& rhs) const& noexcept(noexcept(m_value != rhs.m_value))
+      -> bool
     requires std::equality_comparable<value_type>
   {
     return m_value != rhs.m_value;
   }
 
   /// \brief compares gw::strong_type objects
-  constexpr auto operator<(const strong_type& rhs) const& noexcept(noexcept(m_value < rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator<(const strong_type& rhs) const& noexcept(noexcept(m_value < rhs.m_value))
+      -> bool
     requires std::totally_ordered<value_type>
   {
     return m_value < rhs.m_value;
   }
 
   /// \brief compares gw::strong_type objects
-  constexpr auto operator>(const strong_type& rhs) const& noexcept(noexcept(m_value > rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator>(const strong_type& rhs) const& noexcept(noexcept(m_value > rhs.m_value))
+      -> bool
     requires std::totally_ordered<value_type>
   {
     return m_value > rhs.m_value;
   }
 
   /// \brief compares gw::strong_type objects
-  constexpr auto operator<=(const strong_type& rhs) const& noexcept(noexcept(m_value <= rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator<=(const strong_type& rhs) const& noexcept(noexcept(m_value <= rhs.m_value))
+      -> bool
     requires std::totally_ordered<value_type>
   {
     return m_value <= rhs.m_value;
   }
 
   /// \brief compares gw::strong_type objects
-  constexpr auto operator>=(const strong_type& rhs) const& noexcept(noexcept(m_value >= rhs.m_value)) -> bool
+  GW_FORWARDING constexpr auto operator>=(const strong_type& rhs) const& noexcept(noexcept(m_value >= rhs.m_value))
+      -> bool
     requires std::totally_ordered<value_type>
   {
     return m_value >= rhs.m_value;
   }
 
   /// \brief compares gw::strong_type objects
-  constexpr auto operator<=>(const strong_type& rhs) const& noexcept(noexcept(m_value <=>
-                                                                              rhs.m_value)) -> std::strong_ordering
+  /// \details The result is the comparison category of `T`, e.g. `std::partial_ordering` for floating-point values.
+  GW_FORWARDING constexpr auto operator<=>(const strong_type& rhs) const& noexcept(noexcept(m_value <=> rhs.m_value))
     requires std::three_way_comparable<value_type>
   {
     return m_value <=> rhs.m_value;
@@ -234,23 +263,23 @@ class strong_type final
   //
 
   /// \brief converts the gw::strong_type to its underlying type
-  constexpr explicit operator const value_type&() const& noexcept { return m_value; }
+  GW_FORWARDING constexpr explicit operator const value_type&() const& noexcept { return m_value; }
 
   /// \brief converts the gw::strong_type to its underlying type
-  constexpr explicit operator value_type&() & noexcept { return m_value; }
+  GW_FORWARDING constexpr explicit operator value_type&() & noexcept { return m_value; }
 
   /// \brief converts the gw::strong_type to its underlying type
-  constexpr explicit operator const value_type&&() const&& noexcept { return std::move(m_value); }
+  GW_FORWARDING constexpr explicit operator const value_type&&() const&& noexcept { return std::move(m_value); }
 
   /// \brief converts the gw::strong_type to its underlying type
-  constexpr explicit operator value_type&&() && noexcept { return std::move(m_value); }
+  GW_FORWARDING constexpr explicit operator value_type&&() && noexcept { return std::move(m_value); }
 
   //
   // Increment and decrement operators
   //
 
   /// \brief increments the contained value
-  constexpr auto operator++() & noexcept(noexcept(++m_value)) -> strong_type&
+  GW_FORWARDING constexpr auto operator++() & noexcept(noexcept(++m_value)) -> strong_type&
     requires incrementable<value_type>
   {
     ++m_value;
@@ -258,7 +287,7 @@ class strong_type final
   }
 
   /// \brief increments the contained value
-  constexpr auto operator++() && noexcept(noexcept(++m_value)) -> strong_type&&
+  GW_FORWARDING constexpr auto operator++() && noexcept(noexcept(++m_value)) -> strong_type&&
     requires incrementable<value_type>
   {
     ++m_value;
@@ -266,21 +295,21 @@ class strong_type final
   }
 
   /// \brief increments the contained value
-  constexpr auto operator++(int) & noexcept(noexcept(m_value++)) -> strong_type
+  GW_FORWARDING constexpr auto operator++(int) & noexcept(noexcept(m_value++)) -> strong_type
     requires incrementable<value_type>
   {
     return strong_type{m_value++};
   }
 
   /// \brief increments the contained value
-  constexpr auto operator++(int) && noexcept(noexcept(m_value++)) -> strong_type
+  GW_FORWARDING constexpr auto operator++(int) && noexcept(noexcept(m_value++)) -> strong_type
     requires incrementable<value_type>
   {
     return strong_type{m_value++};
   }
 
   /// \brief decrements the contained value
-  constexpr auto operator--() & noexcept(noexcept(--m_value)) -> strong_type&
+  GW_FORWARDING constexpr auto operator--() & noexcept(noexcept(--m_value)) -> strong_type&
     requires decrementable<value_type>
   {
     --m_value;
@@ -288,7 +317,7 @@ class strong_type final
   }
 
   /// \brief decrements the contained value
-  constexpr auto operator--() && noexcept(noexcept(--m_value)) -> strong_type&&
+  GW_FORWARDING constexpr auto operator--() && noexcept(noexcept(--m_value)) -> strong_type&&
     requires decrementable<value_type>
   {
     --m_value;
@@ -296,14 +325,14 @@ class strong_type final
   }
 
   /// \brief decrements the contained value
-  constexpr auto operator--(int) & noexcept(noexcept(m_value--)) -> strong_type
+  GW_FORWARDING constexpr auto operator--(int) & noexcept(noexcept(m_value--)) -> strong_type
     requires decrementable<value_type>
   {
     return strong_type{m_value--};
   }
 
   /// \brief decrements the contained value
-  constexpr auto operator--(int) && noexcept(noexcept(m_value--)) -> strong_type
+  GW_FORWARDING constexpr auto operator--(int) && noexcept(noexcept(m_value--)) -> strong_type
     requires decrementable<value_type>
   {
     return strong_type{m_value--};
@@ -313,248 +342,102 @@ class strong_type final
   // Arithmetic operators
   //
 
-  /// \brief affirms the contained value
-  constexpr auto operator+() const& noexcept(noexcept(+m_value)) -> strong_type
-    requires std::signed_integral<value_type>
-  {
-    return strong_type{+m_value};
-  }
+  // Every operator has a single overload, because `const&` binds rvalues as well, and every overload is declared again
+  // for every tag. See compile_time_benchmark.
 
   /// \brief affirms the contained value
-  constexpr auto operator+() && noexcept(noexcept(+m_value)) -> strong_type
+  GW_FORWARDING constexpr auto operator+() const& noexcept(noexcept(+m_value)) -> strong_type
     requires std::signed_integral<value_type>
   {
     return strong_type{+m_value};
   }
 
   /// \brief negates the contained value
-  constexpr auto operator-() const& noexcept(noexcept(-m_value)) -> strong_type
-    requires std::signed_integral<value_type>
-  {
-    return strong_type{-m_value};
-  }
-
-  /// \brief negates the contained value
-  constexpr auto operator-() && noexcept(noexcept(-m_value)) -> strong_type
+  GW_FORWARDING constexpr auto operator-() const& noexcept(noexcept(-m_value)) -> strong_type
     requires std::signed_integral<value_type>
   {
     return strong_type{-m_value};
   }
 
   /// \brief adds the contained values
-  constexpr auto operator+(const strong_type& rhs) const& noexcept(noexcept(m_value + rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value + rhs.m_value};
-  }
-
-  /// \brief adds the contained values
-  constexpr auto operator+(strong_type&& rhs) const& noexcept(noexcept(m_value + rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value + rhs.m_value};
-  }
-
-  /// \brief adds the contained values
-  constexpr auto operator+(const strong_type& rhs) && noexcept(noexcept(m_value + rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value + rhs.m_value};
-  }
-
-  /// \brief adds the contained values
-  constexpr auto operator+(strong_type&& rhs) && noexcept(noexcept(m_value + rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value + rhs.m_value};
-  }
-
-  /// \brief subtracts the contained values
-  constexpr auto operator-(const strong_type& rhs) const& noexcept(noexcept(m_value - rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value - rhs.m_value};
-  }
-
-  /// \brief subtracts the contained values
-  constexpr auto operator-(strong_type&& rhs) const& noexcept(noexcept(m_value - rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value - rhs.m_value};
-  }
-
-  /// \brief subtracts the contained values
-  constexpr auto operator-(const strong_type& rhs) && noexcept(noexcept(m_value - rhs.m_value)) -> strong_type
+  GW_FORWARDING constexpr auto operator+(const strong_type& rhs) const& noexcept(k_nothrow_arithmetic<operation::add>)
+      -> arithmetic_result_type
     requires arithmetic<value_type>
   {
-    return strong_type{m_value - rhs.m_value};
+    return detail::apply_arithmetic<arithmetic_policy_type, operation::add, strong_type>(m_value, rhs.m_value);
   }
 
   /// \brief subtracts the contained values
-  constexpr auto operator-(strong_type&& rhs) && noexcept(noexcept(m_value - rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value - rhs.m_value};
-  }
-
-  /// \brief multiplies the contained values
-  constexpr auto operator*(const strong_type& rhs) const& noexcept(noexcept(m_value * rhs.m_value)) -> strong_type
+  GW_FORWARDING constexpr auto operator-(const strong_type& rhs) const& noexcept(
+      k_nothrow_arithmetic<operation::subtract>) -> arithmetic_result_type
     requires arithmetic<value_type>
   {
-    return strong_type{m_value * rhs.m_value};
+    return detail::apply_arithmetic<arithmetic_policy_type, operation::subtract, strong_type>(m_value, rhs.m_value);
   }
 
   /// \brief multiplies the contained values
-  constexpr auto operator*(strong_type&& rhs) const& noexcept(noexcept(m_value * rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
+  GW_FORWARDING constexpr auto operator*(const strong_type& rhs) const& noexcept(
+      k_nothrow_arithmetic<operation::multiply>) -> arithmetic_result_type
+    requires arithmetic<value_type> && (!scaling_tag<tag_type>)
   {
-    return strong_type{m_value * rhs.m_value};
-  }
-
-  /// \brief multiplies the contained values
-  constexpr auto operator*(const strong_type& rhs) && noexcept(noexcept(m_value * rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value * rhs.m_value};
-  }
-
-  /// \brief multiplies the contained values
-  constexpr auto operator*(strong_type&& rhs) && noexcept(noexcept(m_value * rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value * rhs.m_value};
-  }
-
-  /// \brief devides the contained values
-  constexpr auto operator/(const strong_type& rhs) const& noexcept(noexcept(m_value / rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value / rhs.m_value};
-  }
-
-  /// \brief devides the contained values
-  constexpr auto operator/(strong_type&& rhs) const& noexcept(noexcept(m_value / rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value / rhs.m_value};
-  }
-
-  /// \brief devides the contained values
-  constexpr auto operator/(const strong_type& rhs) && noexcept(noexcept(m_value / rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value / rhs.m_value};
+    return detail::apply_arithmetic<arithmetic_policy_type, operation::multiply, strong_type>(m_value, rhs.m_value);
   }
 
   /// \brief devides the contained values
-  constexpr auto operator/(strong_type&& rhs) && noexcept(noexcept(m_value / rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
+  GW_FORWARDING constexpr auto operator/(const strong_type& rhs) const& noexcept(
+      k_nothrow_arithmetic<operation::divide>) -> arithmetic_result_type
+    requires arithmetic<value_type> && (!scaling_tag<tag_type>)
   {
-    return strong_type{m_value / rhs.m_value};
-  }
-
-  /// \brief calculates the remainder of the contained values
-  constexpr auto operator%(const strong_type& rhs) const& noexcept(noexcept(m_value % rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value % rhs.m_value};
+    return detail::apply_arithmetic<arithmetic_policy_type, operation::divide, strong_type>(m_value, rhs.m_value);
   }
 
   /// \brief calculates the remainder of the contained values
-  constexpr auto operator%(strong_type&& rhs) const& noexcept(noexcept(m_value % rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value % rhs.m_value};
-  }
-
-  /// \brief calculates the remainder of the contained values
-  constexpr auto operator%(const strong_type& rhs) && noexcept(noexcept(m_value % rhs.m_value)) -> strong_type
-    requires arithmetic<value_type>
-  {
-    return strong_type{m_value % rhs.m_value};
-  }
-
-  /// \brief calculates the remainder of the contained values
-  constexpr auto operator%(strong_type&& rhs) && noexcept(noexcept(m_value % rhs.m_value)) -> strong_type
+  GW_FORWARDING constexpr auto operator%(const strong_type& rhs) const& noexcept(noexcept(m_value % rhs.m_value))
+      -> strong_type
     requires arithmetic<value_type>
   {
     return strong_type{m_value % rhs.m_value};
   }
 
   /// \brief adds the contained values and assigns the result
-  constexpr auto operator+=(const strong_type& rhs) & noexcept(noexcept(m_value += rhs.m_value)) -> strong_type&
-    requires arithmetic<value_type>
+  GW_FORWARDING constexpr auto operator+=(const strong_type& rhs) & noexcept(k_nothrow_arithmetic<operation::add>)
+      -> strong_type&
+    requires arithmetic<value_type> && std::same_as<arithmetic_result_type, strong_type>
   {
-    m_value += rhs.m_value;
-    return *this;
-  }
-
-  /// \brief adds the contained values and assigns the result
-  constexpr auto operator+=(strong_type&& rhs) & noexcept(noexcept(m_value += rhs.m_value)) -> strong_type&
-    requires arithmetic<value_type>
-  {
-    m_value += rhs.m_value;
+    m_value = arithmetic_policy_type::template apply<operation::add>(m_value, rhs.m_value);
     return *this;
   }
 
   /// \brief subtracts the contained values and assigns the result
-  constexpr auto operator-=(const strong_type& rhs) & noexcept(noexcept(m_value -= rhs.m_value)) -> strong_type&
-    requires arithmetic<value_type>
+  GW_FORWARDING constexpr auto operator-=(const strong_type& rhs) & noexcept(k_nothrow_arithmetic<operation::subtract>)
+      -> strong_type&
+    requires arithmetic<value_type> && std::same_as<arithmetic_result_type, strong_type>
   {
-    m_value -= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief subtracts the contained values and assigns the result
-  constexpr auto operator-=(strong_type&& rhs) & noexcept(noexcept(m_value -= rhs.m_value)) -> strong_type&
-    requires arithmetic<value_type>
-  {
-    m_value -= rhs.m_value;
+    m_value = arithmetic_policy_type::template apply<operation::subtract>(m_value, rhs.m_value);
     return *this;
   }
 
   /// \brief multiplies the contained values and assigns the result
-  constexpr auto operator*=(const strong_type& rhs) & noexcept(noexcept(m_value *= rhs.m_value)) -> strong_type&
-    requires arithmetic<value_type>
+  GW_FORWARDING constexpr auto operator*=(const strong_type& rhs) & noexcept(k_nothrow_arithmetic<operation::multiply>)
+      -> strong_type&
+    requires arithmetic<value_type> && (!scaling_tag<tag_type>) && std::same_as<arithmetic_result_type, strong_type>
   {
-    m_value *= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief multiplies the contained values and assigns the result
-  constexpr auto operator*=(strong_type&& rhs) & noexcept(noexcept(m_value *= rhs.m_value)) -> strong_type&
-    requires arithmetic<value_type>
-  {
-    m_value *= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief devides the contained values and assigns the result
-  constexpr auto operator/=(const strong_type& rhs) & noexcept(noexcept(m_value /= rhs.m_value)) -> strong_type&
-    requires arithmetic<value_type>
-  {
-    m_value /= rhs.m_value;
+    m_value = arithmetic_policy_type::template apply<operation::multiply>(m_value, rhs.m_value);
     return *this;
   }
 
   /// \brief devides the contained values and assigns the result
-  constexpr auto operator/=(strong_type&& rhs) & noexcept(noexcept(m_value /= rhs.m_value)) -> strong_type&
-    requires arithmetic<value_type>
-  {
-    m_value /= rhs.m_value;
-    return *this;
-  }
-
-  /// \brief calculates the remainder of the contained values and assigns the result
-  constexpr auto operator%=(const strong_type& rhs) & noexcept(noexcept(m_value %= rhs.m_value)) -> strong_type&
-    requires arithmetic<value_type>
+  GW_FORWARDING constexpr auto operator/=(const strong_type& rhs) & noexcept(k_nothrow_arithmetic<operation::divide>)
+      -> strong_type&
+    requires arithmetic<value_type> && (!scaling_tag<tag_type>) && std::same_as<arithmetic_result_type, strong_type>
   {
-    m_value %= rhs.m_value;
+    m_value = arithmetic_policy_type::template apply<operation::divide>(m_value, rhs.m_value);
     return *this;
   }
 
   /// \brief calculates the remainder of the contained values and assigns the result
-  constexpr auto operator%=(strong_type&& rhs) & noexcept(noexcept(m_value %= rhs.m_value)) -> strong_type&
+  GW_FORWARDING constexpr auto operator%=(const strong_type& rhs) & noexcept(noexcept(m_value %= rhs.m_value))
+      -> strong_type&
     requires arithmetic<value_type>
   {
     m_value %= rhs.m_value;
@@ -566,284 +449,384 @@ class strong_type final
   //
 
   /// \brief inverts the contained value
-  constexpr auto operator~() const& noexcept(noexcept(~m_value)) -> strong_type
+  GW_FORWARDING constexpr auto operator~() const& noexcept(noexcept(~m_value)) -> strong_type
     requires std::unsigned_integral<value_type>
   {
     return strong_type{~m_value};
   }
 
   /// \brief performs binary AND on the contained values
-  constexpr auto operator&(const strong_type& rhs) const& noexcept(noexcept(m_value & rhs.m_value)) -> strong_type
+  GW_FORWARDING constexpr auto operator&(const strong_type& rhs) const& noexcept(noexcept(m_value & rhs.m_value))
+      -> strong_type
     requires std::unsigned_integral<value_type>
   {
     return strong_type{m_value & rhs.m_value};
   }
 
-  /// \brief performs binary AND on the contained values
-  constexpr auto operator&(strong_type&& rhs) const& noexcept(noexcept(m_value & rhs.m_value)) -> strong_type
+  /// \brief performs binary OR on the contained values
+  GW_FORWARDING constexpr auto operator|(const strong_type& rhs) const& noexcept(noexcept(m_value | rhs.m_value))
+      -> strong_type
     requires std::unsigned_integral<value_type>
   {
-    return strong_type{m_value & rhs.m_value};
+    return strong_type{m_value | rhs.m_value};
   }
 
-  /// \brief performs binary AND on the contained values
-  constexpr auto operator&(const strong_type& rhs) && noexcept(noexcept(m_value & rhs.m_value)) -> strong_type
+  /// \brief performs binary XOR on the contained values
+  GW_FORWARDING constexpr auto operator^(const strong_type& rhs) const& noexcept(noexcept(m_value ^ rhs.m_value))
+      -> strong_type
     requires std::unsigned_integral<value_type>
   {
-    return strong_type{m_value & rhs.m_value};
+    return strong_type{m_value ^ rhs.m_value};
   }
 
-  /// \brief performs binary AND on the contained values
-  constexpr auto operator&(strong_type&& rhs) && noexcept(noexcept(m_value & rhs.m_value)) -> strong_type
+  /// \brief performs binary left shift on the contained values
+  GW_FORWARDING constexpr auto operator<<(const strong_type& rhs) const& noexcept(noexcept(m_value << rhs.m_value))
+      -> strong_type
     requires std::unsigned_integral<value_type>
   {
-    return strong_type{m_value & rhs.m_value};
+    return strong_type{m_value << rhs.m_value};
   }
 
-  /// \brief performs binary OR on the contained values
-  constexpr auto operator|(const strong_type& rhs) const& noexcept(noexcept(m_value | rhs.m_value)) -> strong_type
+  /// \brief performs binary right shift on the contained values
+  GW_FORWARDING constexpr auto operator>>(const strong_type& rhs) const& noexcept(noexcept(m_value >> rhs.m_value))
+      -> strong_type
     requires std::unsigned_integral<value_type>
   {
-    return strong_type{m_value | rhs.m_value};
+    return strong_type{m_value >> rhs.m_value};
   }
 
-  /// \brief performs binary OR on the contained values
-  constexpr auto operator|(strong_type&& rhs) const& noexcept(noexcept(m_value | rhs.m_value)) -> strong_type
+  /// \brief performs binary AND on the contained values and assigns the result
+  GW_FORWARDING constexpr auto operator&=(const strong_type& rhs) & noexcept(noexcept(m_value &= rhs.m_value))
+      -> strong_type&
     requires std::unsigned_integral<value_type>
   {
-    return strong_type{m_value | rhs.m_value};
+    m_value &= rhs.m_value;
+    return *this;
   }
 
-  /// \brief performs binary OR on the contained values
-  constexpr auto operator|(const strong_type& rhs) && noexcept(noexcept(m_value | rhs.m_value)) -> strong_type
+  /// \brief performs binary OR on the contained values and assigns the result
+  GW_FORWARDING constexpr auto operator|=(const strong_type& rhs) & noexcept(noexcept(m_value |= rhs.m_value))
+      -> strong_type&
     requires std::unsigned_integral<value_type>
   {
-    return strong_type{m_value | rhs.m_value};
+    m_value |= rhs.m_value;
+    return *this;
   }
 
-  /// \brief performs binary OR on the contained values
-  constexpr auto operator|(strong_type&& rhs) && noexcept(noexcept(m_value | rhs.m_value)) -> strong_type
+  /// \brief performs binary XOR on the contained values and assigns the result
+  GW_FORWARDING constexpr auto operator^=(const strong_type& rhs) & noexcept(noexcept(m_value ^= rhs.m_value))
+      -> strong_type&
     requires std::unsigned_integral<value_type>
   {
-    return strong_type{m_value | rhs.m_value};
+    m_value ^= rhs.m_value;
+    return *this;
   }
 
-  /// \brief performs binary XOR on the contained values
-  constexpr auto operator^(const strong_type& rhs) const& noexcept(noexcept(m_value ^ rhs.m_value)) -> strong_type
+  /// \brief performs binary left shift on the contained values and assigns the result
+  GW_FORWARDING constexpr auto operator<<=(const strong_type& rhs) & noexcept(noexcept(m_value <<= rhs.m_value))
+      -> strong_type&
     requires std::unsigned_integral<value_type>
   {
-    return strong_type{m_value ^ rhs.m_value};
+    m_value <<= rhs.m_value;
+    return *this;
   }
 
-  /// \brief performs binary XOR on the contained values
-  constexpr auto operator^(strong_type&& rhs) const& noexcept(noexcept(m_value ^ rhs.m_value)) -> strong_type
+  /// \brief performs binary right shift on the contained values and assigns the result
+  GW_FORWARDING constexpr auto operator>>=(const strong_type& rhs) & noexcept(noexcept(m_value >>= rhs.m_value))
+      -> strong_type&
     requires std::unsigned_integral<value_type>
   {
-    return strong_type{m_value ^ rhs.m_value};
+    m_value >>= rhs.m_value;
+    return *this;
   }
 
-  /// \brief performs binary XOR on the contained values
-  constexpr auto operator^(const strong_type& rhs) && noexcept(noexcept(m_value ^ rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
-  {
-    return strong_type{m_value ^ rhs.m_value};
-  }
+  //
+  // Ranges interface
+  //
 
-  /// \brief performs binary XOR on the contained values
-  constexpr auto operator^(strong_type&& rhs) && noexcept(noexcept(m_value ^ rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
+  /// \brief returns an iterator to the beginning of the contained value
+  GW_FORWARDING constexpr auto begin() const noexcept(noexcept(std::ranges::begin(m_value)))
+    requires std::ranges::range<value_type>
   {
-    return strong_type{m_value ^ rhs.m_value};
+    return std::ranges::begin(m_value);
   }
 
-  /// \brief performs binary left shift on the contained values
-  constexpr auto operator<<(const strong_type& rhs) const& noexcept(noexcept(m_value << rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
+  /// \brief returns an iterator to the beginning of the contained value
+  GW_FORWARDING constexpr auto begin() noexcept(noexcept(std::ranges::begin(m_value)))
+    requires std::ranges::range<value_type>
   {
-    return strong_type{m_value << rhs.m_value};
+    return std::ranges::begin(m_value);
   }
 
-  /// \brief performs binary left shift on the contained values
-  constexpr auto operator<<(strong_type&& rhs) const& noexcept(noexcept(m_value << rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
+  /// \brief returns an iterator to the end of the contained value
+  GW_FORWARDING constexpr auto end() const noexcept(noexcept(std::ranges::end(m_value)))
+    requires std::ranges::range<value_type>
   {
-    return strong_type{m_value << rhs.m_value};
+    return std::ranges::end(m_value);
   }
 
-  /// \brief performs binary left shift on the contained values
-  constexpr auto operator<<(const strong_type& rhs) && noexcept(noexcept(m_value << rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
+  /// \brief returns an iterator to the end of the contained value
+  GW_FORWARDING constexpr auto end() noexcept(noexcept(std::ranges::end(m_value)))
+    requires std::ranges::range<value_type>
   {
-    return strong_type{m_value << rhs.m_value};
+    return std::ranges::end(m_value);
   }
 
-  /// \brief performs binary left shift on the contained values
-  constexpr auto operator<<(strong_type&& rhs) && noexcept(noexcept(m_value << rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
-  {
-    return strong_type{m_value << rhs.m_value};
-  }
+  //
+  // Stream operators
+  //
 
-  /// \brief performs binary right shift on the contained values
-  constexpr auto operator>>(const strong_type& rhs) const& noexcept(noexcept(m_value >> rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
+  /// \brief inserts formatted data
+  friend inline auto operator<<(std::ostream& ostream,
+                                const strong_type& rhs) noexcept(noexcept(ostream << rhs.m_value)) -> std::ostream&
+    requires ostreamable<value_type> && (!decimal_tag<tag_type>)
   {
-    return strong_type{m_value >> rhs.m_value};
+    return ostream << rhs.m_value;
   }
 
-  /// \brief performs binary right shift on the contained values
-  constexpr auto operator>>(strong_type&& rhs) const& noexcept(noexcept(m_value >> rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
+  /// \brief extracts formatted data
+  friend inline auto operator>>(std::istream& istream,
+                                strong_type& rhs) noexcept(noexcept(istream >> rhs.m_value)) -> std::istream&
+    requires istreamable<value_type> && (!decimal_tag<tag_type>)
   {
-    return strong_type{m_value >> rhs.m_value};
+    return istream >> rhs.m_value;
   }
 
-  /// \brief performs binary right shift on the contained values
-  constexpr auto operator>>(const strong_type& rhs) && noexcept(noexcept(m_value >> rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
-  {
-    return strong_type{m_value >> rhs.m_value};
-  }
+ private:
+  using operation = detail::arithmetic_operation;
 
-  /// \brief performs binary right shift on the contained values
-  constexpr auto operator>>(strong_type&& rhs) && noexcept(noexcept(m_value >> rhs.m_value)) -> strong_type
-    requires std::unsigned_integral<value_type>
-  {
-    return strong_type{m_value >> rhs.m_value};
-  }
+  template <operation Operation>
+  static constexpr bool k_nothrow_arithmetic =
+      noexcept(arithmetic_policy_type::template apply<Operation>(std::declval<const T&>(), std::declval<const T&>()));
 
-  /// \brief performs binary AND on the contained values and assigns the result
-  constexpr auto operator&=(const strong_type& rhs) & noexcept(noexcept(m_value &= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
-  {
-    m_value &= rhs.m_value;
-    return *this;
-  }
+  value_type m_value{};
+};
 
-  /// \brief performs binary AND on the contained values and assigns the result
-  constexpr auto operator&=(strong_type&& rhs) & noexcept(noexcept(m_value &= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
+/// \brief Strong type wrapper with opt-in operators.
+/// \details The core of gw::strong_type, i.e. the constructors, the observers, the modifiers and the conversions, and
+/// the operators of `Skills`. `==` and `<=>` are declared only for the comparison skills, and `std::hash`,
+/// `std::format` and `operator<<` are available only for gw::skills::hashable and gw::skills::printable.
+///
+/// The core is declared again rather than shared with the primary template. A common base of both, or a single class
+/// with the operators of the primary template constrained on `Skills`, costs more per instantiation than the repeated
+/// declarations. The operators of the primary template are members rather than hidden friends of a default skill,
+/// because with GCC, the lookup of a hidden friend takes longer with every type that declares one of the same name.
+/// See compile_time_benchmark.
+template <typename T, typename Tag, typename Skills>
+  requires detail::skill_set<Skills>
+class GW_EMPTY_BASES strong_type<T, Tag, Skills> final
+    : public std::conditional_t<std::ranges::range<T>, std::ranges::view_interface<strong_type<T, Tag, Skills>>,
+                                detail::strong_type_empty_base>,
+      public detail::skill_bases<Skills, strong_type<T, Tag, Skills>> {
+ public:
+  //
+  // Public types
+  //
+
+  using value_type = T;  ///< The type of the contained value.
+  using tag_type = Tag;  ///< The tag type.
+
+  /// \brief The arithmetic policy of the arithmetic skills, declared by the tag as `Tag::arithmetic_policy`.
+  using arithmetic_policy_type = detail::tag_arithmetic_policy_t<Tag>;
+
+  /// \brief The result type of the arithmetic skills, which is `std::expected` under gw::expected_arithmetic.
+  using arithmetic_result_type = detail::arithmetic_result_t<arithmetic_policy_type, strong_type>;
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct the gw::strong_type object
+  template <typename... Args>
+  GW_FORWARDING constexpr explicit strong_type(Args&&... args) noexcept(
+      std::is_nothrow_constructible_v<value_type, Args...>)
+    requires std::constructible_from<value_type, Args...>
+      : m_value(value_type{std::forward<Args>(args)...}) {}
+
+  /// \brief constructs the gw::strong_type object
+  template <typename U, typename... Args>
+  GW_FORWARDING constexpr strong_type(std::initializer_list<U> ilist, Args&&... args) noexcept(
+      std::is_nothrow_constructible_v<value_type, std::initializer_list<U>&, Args...>)
+    requires std::constructible_from<value_type, std::initializer_list<U>&, Args...>
+      : m_value(value_type{ilist, std::forward<Args>(args)...}) {}
+
+  //
+  // Destructor
+  //
+
+  /// \brief destroys the contained value
+  ~strong_type() noexcept(std::is_nothrow_destructible_v<value_type>) = default;
+
+  //
+  // Observers
+  //
+
+  /// \brief accesses the contained value
+  GW_FORWARDING constexpr auto operator->() const noexcept -> const value_type* { return &m_value; }
+
+  /// \brief accesses the contained value
+  GW_FORWARDING constexpr auto operator->() noexcept -> value_type* { return &m_value; }
+
+  /// \brief accesses the contained value
+  GW_FORWARDING constexpr auto operator*() const& noexcept -> const value_type& { return m_value; }
+
+  /// \brief accesses the contained value
+  GW_FORWARDING constexpr auto operator*() & noexcept -> value_type& { return m_value; }
+
+  /// \brief accesses the contained value
+  GW_FORWARDING constexpr auto operator*() const&& noexcept -> const value_type&& { return std::move(m_value); }
+
+  /// \brief accesses the contained value
+  GW_FORWARDING constexpr auto operator*() && noexcept -> value_type&& { return std::move(m_value); }
+
+  /// \brief returns the contained value
+  GW_FORWARDING constexpr auto value() const& noexcept -> const value_type& { return m_value; }
+
+  /// \brief returns the contained value
+  GW_FORWARDING constexpr auto value() & noexcept -> value_type& { return m_value; }
+
+  /// \brief returns the contained value
+  GW_FORWARDING constexpr auto value() const&& noexcept -> const value_type&& { return std::move(m_value); }
+
+  /// \brief returns the contained value
+  GW_FORWARDING constexpr auto value() && noexcept -> value_type&& { return std::move(m_value); }
+
+  //
+  // Monadic operations
+  //
+
+  /// \brief returns a gw::strong_type containing the transformed contained value
+  template <typename F>
+  constexpr auto transform(F&& func) const& noexcept(noexcept(func(m_value))) -> strong_type
+    requires std::invocable<F, const value_type&>
   {
-    m_value &= rhs.m_value;
-    return *this;
+    return strong_type{func(m_value)};
   }
 
-  /// \brief performs binary OR on the contained values and assigns the result
-  constexpr auto operator|=(const strong_type& rhs) & noexcept(noexcept(m_value |= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
+  /// \brief returns a gw::strong_type containing the transformed contained value
+  template <typename F>
+  constexpr auto transform(F&& func) & noexcept(noexcept(func(m_value))) -> strong_type
+    requires std::invocable<F, value_type&>
   {
-    m_value |= rhs.m_value;
-    return *this;
+    return strong_type{func(m_value)};
   }
 
-  /// \brief performs binary OR on the contained values and assigns the result
-  constexpr auto operator|=(strong_type&& rhs) & noexcept(noexcept(m_value |= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
+  /// \brief returns a gw::strong_type containing the transformed contained value
+  template <typename F>
+  constexpr auto transform(F&& func) const&& noexcept(noexcept(func(std::move(m_value)))) -> strong_type
+    requires std::invocable<F, const value_type&&>
   {
-    m_value |= rhs.m_value;
-    return *this;
+    return strong_type{func(std::move(m_value))};
   }
 
-  /// \brief performs binary XOR on the contained values and assigns the result
-  constexpr auto operator^=(const strong_type& rhs) & noexcept(noexcept(m_value ^= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
+  /// \brief returns a gw::strong_type containing the transformed contained value
+  template <typename F>
+  constexpr auto transform(F&& func) && noexcept(noexcept(func(std::move(m_value)))) -> strong_type
+    requires std::invocable<F, value_type&&>
   {
-    m_value ^= rhs.m_value;
-    return *this;
+    return strong_type{func(std::move(m_value))};
   }
 
-  /// \brief performs binary XOR on the contained values and assigns the result
-  constexpr auto operator^=(strong_type&& rhs) & noexcept(noexcept(m_value ^= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
+  //
+  // Modifiers
+  //
+
+  /// \brief specializes the std::swap algorithm
+  constexpr void swap(strong_type& rhs) noexcept(std::is_nothrow_swappable_v<value_type>)
+    requires std::swappable<value_type>
   {
-    m_value ^= rhs.m_value;
-    return *this;
+    using std::swap;
+    swap(m_value, rhs.m_value);
   }
 
-  /// \brief performs binary left shift on the contained values and assigns the result
-  constexpr auto operator<<=(const strong_type& rhs) & noexcept(noexcept(m_value <<= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
+  /// \brief destroys any contained value
+  constexpr void reset() noexcept(std::is_nothrow_default_constructible_v<value_type>)
+    requires std::default_initializable<value_type>
   {
-    m_value <<= rhs.m_value;
-    return *this;
+    m_value = value_type{};
   }
 
-  /// \brief performs binary left shift on the contained values and assigns the result
-  constexpr auto operator<<=(strong_type&& rhs) & noexcept(noexcept(m_value <<= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
+  /// \brief constructs the contained value in-place
+  template <typename... Args>
+  constexpr auto emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<value_type, Args...>) -> value_type&
+    requires std::constructible_from<value_type, Args...>
   {
-    m_value <<= rhs.m_value;
-    return *this;
+    m_value = value_type{std::forward<Args>(args)...};
+    return m_value;
   }
 
-  /// \brief performs binary right shift on the contained values and assigns the result
-  constexpr auto operator>>=(const strong_type& rhs) & noexcept(noexcept(m_value >>= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
+  //
+  // Comparison operators
+  //
+
+  // Declared here rather than in the skills, because they hide the comparisons of gw::crtp bases of custom skills.
+  // `!=`, `<`, `>`, `<=` and `>=` are rewritten to them.
+
+  /// \brief compares gw::strong_type objects
+  GW_FORWARDING constexpr auto operator==(const strong_type& rhs) const& noexcept(noexcept(m_value == rhs.m_value))
+      -> bool
+    requires(detail::k_strong_type_has_skill<skills::equality_comparable, Skills> ||
+             detail::k_strong_type_has_skill<skills::comparable, Skills>) && std::equality_comparable<value_type>
   {
-    m_value >>= rhs.m_value;
-    return *this;
+    return m_value == rhs.m_value;
   }
 
-  /// \brief performs binary right shift on the contained values and assigns the result
-  constexpr auto operator>>=(strong_type&& rhs) & noexcept(noexcept(m_value >>= rhs.m_value)) -> strong_type&
-    requires std::unsigned_integral<value_type>
+  /// \brief compares gw::strong_type objects
+  /// \details The result is the comparison category of `T`, e.g. `std::partial_ordering` for floating-point values.
+  GW_FORWARDING constexpr auto operator<=>(const strong_type& rhs) const& noexcept(noexcept(m_value <=> rhs.m_value))
+    requires detail::k_strong_type_has_skill<skills::comparable, Skills> && std::three_way_comparable<value_type>
   {
-    m_value >>= rhs.m_value;
-    return *this;
+    return m_value <=> rhs.m_value;
   }
 
+  //
+  // Conversion operators
+  //
+
+  /// \brief converts the gw::strong_type to its underlying type
+  GW_FORWARDING constexpr explicit operator const value_type&() const& noexcept { return m_value; }
+
+  /// \brief converts the gw::strong_type to its underlying type
+  GW_FORWARDING constexpr explicit operator value_type&() & noexcept { return m_value; }
+
+  /// \brief converts the gw::strong_type to its underlying type
+  GW_FORWARDING constexpr explicit operator const value_type&&() const&& noexcept { return std::move(m_value); }
+
+  /// \brief converts the gw::strong_type to its underlying type
+  GW_FORWARDING constexpr explicit operator value_type&&() && noexcept { return std::move(m_value); }
+
   //
   // Ranges interface
   //
 
   /// \brief returns an iterator to the beginning of the contained value
-  constexpr auto begin() const noexcept(noexcept(std::ranges::begin(m_value)))
+  GW_FORWARDING constexpr auto begin() const noexcept(noexcept(std::ranges::begin(m_value)))
     requires std::ranges::range<value_type>
   {
     return std::ranges::begin(m_value);
   }
 
   /// \brief returns an iterator to the beginning of the contained value
-  constexpr auto begin() noexcept(noexcept(std::ranges::begin(m_value)))
+  GW_FORWARDING constexpr auto begin() noexcept(noexcept(std::ranges::begin(m_value)))
     requires std::ranges::range<value_type>
   {
     return std::ranges::begin(m_value);
   }
 
   /// \brief returns an iterator to the end of the contained value
-  constexpr auto end() const noexcept(noexcept(std::ranges::end(m_value)))
+  GW_FORWARDING constexpr auto end() const noexcept(noexcept(std::ranges::end(m_value)))
     requires std::ranges::range<value_type>
   {
     return std::ranges::end(m_value);
   }
 
   /// \brief returns an iterator to the end of the contained value
-  constexpr auto end() noexcept(noexcept(std::ranges::end(m_value)))
+  GW_FORWARDING constexpr auto end() noexcept(noexcept(std::ranges::end(m_value)))
     requires std::ranges::range<value_type>
   {
     return std::ranges::end(m_value);
   }
 
-  //
-  // Stream operators
-  //
-
-  /// \brief inserts formatted data
-  friend inline auto operator<<(std::ostream& ostream,
-                                const strong_type& rhs) noexcept(noexcept(ostream << rhs.m_value)) -> std::ostream&
-    requires ostreamable<value_type>
-  {
-    return ostream << rhs.m_value;
-  }
-
-  /// \brief extracts formatted data
-  friend inline auto operator>>(std::istream& istream,
-                                strong_type& rhs) noexcept(noexcept(istream >> rhs.m_value)) -> std::istream&
-    requires istreamable<value_type>
-  {
-    return istream >> rhs.m_value;
-  }
-
  private:
   value_type m_value{};
 };
@@ -878,6 +861,109 @@ constexpr auto make_strong_type(T&& value) noexcept(
   return strong_type<std::remove_cvref_t<T>, Tag>{std::forward<T>(value)};
 }
 
+//
+// Range reinterpretation
+//
+
+namespace detail {
+
+template <typename T, typename Tag, typename Skills>
+constexpr void assert_layout_compatible() noexcept {
+  using strong_type_t = strong_type<T, Tag, Skills>;
+  static_assert(sizeof(strong_type_t) == sizeof(T), "gw::strong_type must have the same size as T");
+  static_assert(alignof(strong_type_t) == alignof(T), "gw::strong_type must have the same alignment as T");
+  static_assert(std::is_standard_layout_v<strong_type_t>, "gw::strong_type must be a standard layout type");
+}
+
+}  // namespace detail
+
+/// \brief views a contiguous sequence of gw::strong_type objects as a sequence of their contained values
+/// \details The returned span refers to the same storage, so no values are copied. This allows numeric kernels that
+/// operate on plain `T` to run directly on tagged data.
+template <typename T, typename Tag, typename Skills, std::size_t Extent>
+auto as_underlying(std::span<strong_type<T, Tag, Skills>, Extent> span) noexcept -> std::span<T, Extent> {
+  detail::assert_layout_compatible<T, Tag, Skills>();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return std::span<T, Extent>{reinterpret_cast<T*>(span.data()), span.size()};
+}
+
+/// \brief views a contiguous sequence of gw::strong_type objects as a sequence of their contained values
+template <typename T, typename Tag, typename Skills, std::size_t Extent>
+auto as_underlying(std::span<const strong_type<T, Tag, Skills>, Extent> span) noexcept -> std::span<const T, Extent> {
+  detail::assert_layout_compatible<T, Tag, Skills>();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return std::span<const T, Extent>{reinterpret_cast<const T*>(span.data()), span.size()};
+}
+
+/// \brief views a contiguous sequence of values as a sequence of gw::strong_type objects with the tag `Tag`
+/// \details The returned span refers to the same storage, so no values are copied. The strong types have the skills
+/// `Skills`, e.g. `gw::as_strong<Tag, gw::skills::with<gw::skills::addable>>(span)`, and all operators by default.
+template <typename Tag, typename Skills = void, typename T, std::size_t Extent>
+  requires(!std::is_const_v<T>)
+auto as_strong(std::span<T, Extent> span) noexcept -> std::span<strong_type<T, Tag, Skills>, Extent> {
+  using strong_type_t = strong_type<T, Tag, Skills>;
+  detail::assert_layout_compatible<T, Tag, Skills>();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return std::span<strong_type_t, Extent>{reinterpret_cast<strong_type_t*>(span.data()), span.size()};
+}
+
+/// \brief views a contiguous sequence of values as a sequence of gw::strong_type objects with the tag `Tag`
+template <typename Tag, typename Skills = void, typename T, std::size_t Extent>
+auto as_strong(std::span<const T, Extent> span) noexcept -> std::span<const strong_type<T, Tag, Skills>, Extent> {
+  using strong_type_t = strong_type<T, Tag, Skills>;
+  detail::assert_layout_compatible<T, Tag, Skills>();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return std::span<const strong_type_t, Extent>{reinterpret_cast<const strong_type_t*>(span.data()), span.size()};
+}
+
+//
+// Batch operations
+//
+
+/// \brief Add `rhs` to `lhs` element-wise under the arithmetic policy of the tag.
+/// \details With skills, only for gw::skills::addable.
+/// \see gw::batch_add
+template <typename T, typename Tag, typename Skills, std::size_t Extent>
+  requires detail::k_strong_type_has_skill<skills::addable, Skills>
+constexpr auto batch_add(std::span<strong_type<T, Tag, Skills>, Extent> lhs,
+                         std::span<const std::type_identity_t<strong_type<T, Tag, Skills>>> rhs)
+    -> detail::batch_result_t<detail::tag_arithmetic_policy_t<Tag>> {
+  return batch_add<detail::tag_arithmetic_policy_t<Tag>>(as_underlying(lhs), as_underlying(rhs));
+}
+
+/// \brief Subtract `rhs` from `lhs` element-wise under the arithmetic policy of the tag.
+/// \details With skills, only for gw::skills::subtractable.
+/// \see gw::batch_subtract
+template <typename T, typename Tag, typename Skills, std::size_t Extent>
+  requires detail::k_strong_type_has_skill<skills::subtractable, Skills>
+constexpr auto batch_subtract(std::span<strong_type<T, Tag, Skills>, Extent> lhs,
+                              std::span<const std::type_identity_t<strong_type<T, Tag, Skills>>> rhs)
+    -> detail::batch_result_t<detail::tag_arithmetic_policy_t<Tag>> {
+  return batch_subtract<detail::tag_arithmetic_policy_t<Tag>>(as_underlying(lhs), as_underlying(rhs));
+}
+
+/// \brief Multiply `lhs` by `rhs` element-wise under the arithmetic policy of the tag.
+/// \details With skills, only for gw::skills::multipliable.
+/// \see gw::batch_multiply
+template <typename T, typename Tag, typename Skills, std::size_t Extent>
+  requires(!scaling_tag<Tag>) && detail::k_strong_type_has_skill<skills::multipliable, Skills>
+constexpr auto batch_multiply(std::span<strong_type<T, Tag, Skills>, Extent> lhs,
+                              std::span<const std::type_identity_t<strong_type<T, Tag, Skills>>> rhs)
+    -> detail::batch_result_t<detail::tag_arithmetic_policy_t<Tag>> {
+  return batch_multiply<detail::tag_arithmetic_policy_t<Tag>>(as_underlying(lhs), as_underlying(rhs));
+}
+
+/// \brief Divide `lhs` by `rhs` element-wise under the arithmetic policy of the tag.
+/// \details With skills, only for gw::skills::dividable.
+/// \see gw::batch_divide
+template <typename T, typename Tag, typename Skills, std::size_t Extent>
+  requires(!scaling_tag<Tag>) && detail::k_strong_type_has_skill<skills::dividable, Skills>
+constexpr auto batch_divide(std::span<strong_type<T, Tag, Skills>, Extent> lhs,
+                            std::span<const std::type_identity_t<strong_type<T, Tag, Skills>>> rhs)
+    -> detail::batch_result_t<detail::tag_arithmetic_policy_t<Tag>> {
+  return batch_divide<detail::tag_arithmetic_policy_t<Tag>>(as_underlying(lhs), as_underlying(rhs));
+}
+
 }  // namespace gw
 
 namespace std {
@@ -887,13 +973,15 @@ namespace std {
 //
 
 /// \brief hash support for gw::strong_type
-template <::gw::hashable T, ::gw::complete Tag>
+/// \details The tag identity is `gw::type_hash_v<Tag>`, which is computed at compile time and does not require RTTI.
+template <::gw::hashable T, typename Tag, typename Skills>
+  requires ::gw::detail::k_strong_type_has_skill<::gw::skills::hashable, Skills>
 // NOLINTNEXTLINE(cert-dcl58-cpp)
-struct hash<::gw::strong_type<T, Tag>> {
-  [[nodiscard]] auto inline operator()(const ::gw::strong_type<T, Tag>& strong_type) const noexcept -> size_t {
-    auto tag_hash = hash<type_index>{}(type_index{typeid(Tag)});
+struct hash<::gw::strong_type<T, Tag, Skills>> {
+  [[nodiscard]] auto inline operator()(const ::gw::strong_type<T, Tag, Skills>& strong_type) const noexcept -> size_t {
+    constexpr auto tag_hash = static_cast<size_t>(::gw::type_hash_v<Tag>);
     auto value_hash = hash<T>{}(strong_type.value());
-    return tag_hash ^ value_hash;
+    return ::gw::hash_combine(tag_hash, value_hash);
   }
 };
 
@@ -903,9 +991,10 @@ struct hash<::gw::strong_type<T, Tag>> {
 
 /// \brief Format the `gw::strong_type` object.
 ///
-template <typename T, typename Tag, class CharT>
+template <typename T, typename Tag, typename Skills, class CharT>
+  requires ::gw::detail::k_strong_type_has_skill<::gw::skills::printable, Skills>
 // NOLINTNEXTLINE(cert-dcl58-cpp)
-struct formatter<::gw::strong_type<T, Tag>, CharT> {
+struct formatter<::gw::strong_type<T, Tag, Skills>, CharT> {
   /// \brief Parse the format string.
   ///
   template <class ParseContext>
@@ -916,7 +1005,8 @@ struct formatter<::gw::strong_type<T, Tag>, CharT> {
   /// \brief Format the `gw::strong_type` object.
   ///
   template <class FormatContext>
-  auto format(const ::gw::strong_type<T, Tag>& strong_type, FormatContext& context) const -> FormatContext::iterator
+  auto format(const ::gw::strong_type<T, Tag, Skills>& strong_type, FormatContext& context) const
+      -> FormatContext::iterator
 #if __cplusplus > 202002L
     requires std::formattable<T, CharT>
 #endif  // __cplusplus > 202002L
@@ -0,0 +1,588 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "gw/arithmetic.hpp"
+#include "gw/concepts.hpp"
+#include "gw/error.hpp"
+#include "gw/strong_type.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+namespace detail {
+
+/// \brief The number of independent accumulators used by the reductions of gw::strong_vector.
+inline constexpr std::size_t k_strong_vector_lanes = 8U;
+
+/// \brief Reduce `count` elements produced by `load` with `op`, using independent accumulators per lane.
+/// \details Splitting the reduction into lanes breaks the loop-carried dependency on a single accumulator, which lets
+/// the compiler keep the lanes in vector registers. For floating-point types the result may therefore differ from a
+/// strictly sequential reduction in the last bits.
+template <typename T, typename BinaryOp, typename Load>
+auto reduce_lanes(std::size_t count, T init, BinaryOp op, Load load) -> T {
+  auto lanes = std::array<T, k_strong_vector_lanes>{};
+  lanes.fill(init);
+
+  auto index = std::size_t{};
+  for (; index + k_strong_vector_lanes <= count; index += k_strong_vector_lanes) {
+    for (auto lane = std::size_t{}; lane < k_strong_vector_lanes; ++lane) {
+      lanes[lane] = op(lanes[lane], load(index + lane));
+    }
+  }
+
+  auto result = init;
+  for (const auto& lane : lanes) {
+    result = op(result, lane);
+  }
+  for (; index < count; ++index) {
+    result = op(result, load(index));
+  }
+  return result;
+}
+
+/// \brief Concept for tags whose arithmetic policy produces values, which excludes gw::expected_arithmetic.
+template <typename Tag>
+concept value_arithmetic_tag = std::is_void_v<batch_result_t<tag_arithmetic_policy_t<Tag>>>;
+
+}  // namespace detail
+
+/// \example strong_vector_example.cpp
+//
+/// \brief A contiguous sequence of gw::strong_type objects with whole-array operations.
+//
+/// \details The class template `gw::strong_vector` stores its elements as plain `T` in contiguous storage and exposes
+/// them as `gw::strong_type<T, Tag>`. Element-wise arithmetic, scaling, reductions and comparisons operate on the
+/// underlying values in simple loops over raw pointers, which the compiler can vectorize reliably. The results keep the
+/// tag, and the same tag rules apply as for the scalar `gw::strong_type` operators: only vectors with the same tag can
+/// be combined, and vectors of units or decimals, whose products change the unit or the scale, are not multiplied or
+/// divided element-wise. Vectors of decimals are not divided by a factor either, which would truncate instead of
+/// rounding with the rounding mode of the decimal. The element-wise operations follow the arithmetic policy of the tag
+/// like gw::batch_add, and are not available for tags with gw::expected_arithmetic. The reductions use the raw
+/// operations of `T`.
+/// \tparam T The type of the contained values.
+/// \tparam Tag The tag type.
+/// \tparam Allocator The allocator type for the underlying storage.
+template <typename T, typename Tag, typename Allocator = std::allocator<T>>
+class strong_vector {
+ public:
+  //
+  // Public types
+  //
+
+  using value_type = strong_type<T, Tag>;                                ///< The type of the elements.
+  using underlying_type = T;                                             ///< The type of the contained values.
+  using tag_type = Tag;                                                  ///< The tag type.
+  using allocator_type = Allocator;                                      ///< The allocator type.
+  using size_type = std::size_t;                                         ///< The size type.
+  using difference_type = std::ptrdiff_t;                                ///< The difference type.
+  using reference = value_type&;                                         ///< The reference type.
+  using const_reference = const value_type&;                             ///< The const reference type.
+  using pointer = value_type*;                                           ///< The pointer type.
+  using const_pointer = const value_type*;                               ///< The const pointer type.
+  using iterator = value_type*;                                          ///< The iterator type.
+  using const_iterator = const value_type*;                              ///< The const iterator type.
+  using reverse_iterator = std::reverse_iterator<iterator>;              ///< The reverse iterator type.
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;  ///< The const reverse iterator type.
+  using mask_type = std::vector<std::uint8_t>;  ///< The result of comparisons, one byte of `0` or `1` per element.
+  using arithmetic_policy_type = typename value_type::arithmetic_policy_type;  ///< The arithmetic policy of the tag.
+
+  //
+  // Constructors
+  //
+
+  /// \brief Construct an empty vector.
+  strong_vector() = default;
+
+  /// \brief Construct the vector with `count` value-initialized elements.
+  /// \param count The number of elements.
+  explicit strong_vector(size_type count) : m_values(count) {}
+
+  /// \brief Construct the vector with `count` copies of `value`.
+  /// \param count The number of elements.
+  /// \param value The value to initialize the elements with.
+  strong_vector(size_type count, const value_type& value) : m_values(count, value.value()) {}
+
+  /// \brief Construct the vector with the contents of the initializer list.
+  /// \param ilist The initializer list to initialize the elements with.
+  strong_vector(std::initializer_list<value_type> ilist) : strong_vector(ilist.begin(), ilist.end()) {}
+
+  /// \brief Construct the vector with the contents of the range [first, last).
+  /// \tparam InputIt The type of the iterators.
+  /// \param first The beginning of the range.
+  /// \param last The end of the range.
+  template <std::input_iterator InputIt>
+    requires std::convertible_to<std::iter_reference_t<InputIt>, const value_type&>
+  strong_vector(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  /// \brief Construct the vector from the contained values.
+  /// \param values The contained values.
+  explicit strong_vector(std::vector<T, Allocator> values) noexcept : m_values(std::move(values)) {}
+
+  //
+  // Element access
+  //
+
+  /// \brief Get a reference to the element at the specified position.
+  /// \param pos The position of the element.
+  /// \return A reference to the element.
+  /// \throw std::out_of_range If `pos` is out of range.
+  auto at(size_type pos) -> reference {
+    if (pos >= size()) {
+      detail::throw_error<std::out_of_range>(
+          std::format("strong_vector::at: pos (which is {}) >= size (which is {})", pos, size()));
+    }
+    return (*this)[pos];
+  }
+
+  /// \brief Get a const reference to the element at the specified position.
+  /// \param pos The position of the element.
+  /// \return A const reference to the element.
+  /// \throw std::out_of_range If `pos` is out of range.
+  auto at(size_type pos) const -> const_reference {
+    if (pos >= size()) {
+      detail::throw_error<std::out_of_range>(
+          std::format("strong_vector::at: pos (which is {}) >= size (which is {})", pos, size()));
+    }
+    return (*this)[pos];
+  }
+
+  /// \brief Get a reference to the element at the specified position.
+  auto operator[](size_type pos) noexcept -> reference { return data()[pos]; }
+
+  /// \brief Get a const reference to the element at the specified position.
+  auto operator[](size_type pos) const noexcept -> const_reference { return data()[pos]; }
+
+  /// \brief Get a reference to the first element.
+  auto front() noexcept -> reference { return data()[0]; }
+
+  /// \brief Get a const reference to the first element.
+  auto front() const noexcept -> const_reference { return data()[0]; }
+
+  /// \brief Get a reference to the last element.
+  auto back() noexcept -> reference { return data()[size() - 1U]; }
+
+  /// \brief Get a const reference to the last element.
+  auto back() const noexcept -> const_reference { return data()[size() - 1U]; }
+
+  /// \brief Get a pointer to the elements.
+  auto data() noexcept -> pointer { return as_strong<Tag>(std::span{m_values}).data(); }
+
+  /// \brief Get a const pointer to the elements.
+  auto data() const noexcept -> const_pointer { return as_strong<Tag>(std::span{m_values}).data(); }
+
+  /// \brief Get a span of the contained values.
+  auto underlying() noexcept -> std::span<T> { return m_values; }
+
+  /// \brief Get a span of the contained values.
+  auto underlying() const noexcept -> std::span<const T> { return m_values; }
+
+  //
+  // Iterators
+  //
+
+  /// \brief Get an iterator to the beginning.
+  auto begin() noexcept -> iterator { return data(); }
+
+  /// \brief Get a const iterator to the beginning.
+  auto begin() const noexcept -> const_iterator { return data(); }
+
+  /// \brief Get a const iterator to the beginning.
+  auto cbegin() const noexcept -> const_iterator { return data(); }
+
+  /// \brief Get an iterator to the end.
+  auto end() noexcept -> iterator { return std::ranges::next(data(), size()); }
+
+  /// \brief Get a const iterator to the end.
+  auto end() const noexcept -> const_iterator { return std::ranges::next(data(), size()); }
+
+  /// \brief Get a const iterator to the end.
+  auto cend() const noexcept -> const_iterator { return std::ranges::next(data(), size()); }
+
+  /// \brief Get a reverse iterator to the end.
+  auto rbegin() noexcept -> reverse_iterator { return reverse_iterator{end()}; }
+
+  /// \brief Get a const reverse iterator to the end.
+  auto rbegin() const noexcept -> const_reverse_iterator { return const_reverse_iterator{end()}; }
+
+  /// \brief Get a reverse iterator to the beginning.
+  auto rend() noexcept -> reverse_iterator { return reverse_iterator{begin()}; }
+
+  /// \brief Get a const reverse iterator to the beginning.
+  auto rend() const noexcept -> const_reverse_iterator { return const_reverse_iterator{begin()}; }
+
+  //
+  // Capacity
+  //
+
+  /// \brief Check if the vector is empty.
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_values.empty(); }
+
+  /// \brief Get the number of elements.
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_values.size(); }
+
+  /// \brief Get the number of elements that can be held in the currently allocated storage.
+  [[nodiscard]] auto capacity() const noexcept -> size_type { return m_values.capacity(); }
+
+  /// \brief Reserve storage for `new_cap` elements.
+  void reserve(size_type new_cap) { m_values.reserve(new_cap); }
+
+  //
+  // Modifiers
+  //
+
+  /// \brief Remove all elements.
+  void clear() noexcept { m_values.clear(); }
+
+  /// \brief Append an element.
+  void push_back(const value_type& value) { m_values.push_back(value.value()); }
+
+  /// \brief Construct an element in-place at the end.
+  template <typename... Args>
+    requires std::constructible_from<T, Args...>
+  auto emplace_back(Args&&... args) -> reference {
+    m_values.emplace_back(std::forward<Args>(args)...);
+    return back();
+  }
+
+  /// \brief Remove the last element.
+  void pop_back() noexcept { m_values.pop_back(); }
+
+  /// \brief Resize the vector to `count` elements.
+  void resize(size_type count) { m_values.resize(count); }
+
+  /// \brief Resize the vector to `count` elements, filling new elements with `value`.
+  void resize(size_type count, const value_type& value) { m_values.resize(count, value.value()); }
+
+  /// \brief Swap the contents with another vector.
+  void swap(strong_vector& other) noexcept { m_values.swap(other.m_values); }
+
+  //
+  // Element-wise arithmetic
+  //
+
+  /// \brief Add the elements of `rhs` to the elements of the vector.
+  /// \throw std::invalid_argument If the sizes of the vectors differ.
+  /// \throw std::overflow_error If any element overflows under gw::checked_arithmetic. All elements are still computed.
+  auto operator+=(const strong_vector& rhs) -> strong_vector&
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag>
+  {
+    return apply<operation::add>(rhs, "operator+=");
+  }
+
+  /// \brief Subtract the elements of `rhs` from the elements of the vector.
+  /// \throw std::invalid_argument If the sizes of the vectors differ.
+  /// \throw std::overflow_error If any element overflows under gw::checked_arithmetic. All elements are still computed.
+  auto operator-=(const strong_vector& rhs) -> strong_vector&
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag>
+  {
+    return apply<operation::subtract>(rhs, "operator-=");
+  }
+
+  /// \brief Multiply the elements of the vector by the elements of `rhs`.
+  /// \throw std::invalid_argument If the sizes of the vectors differ.
+  /// \throw std::overflow_error If any element overflows under gw::checked_arithmetic. All elements are still computed.
+  auto operator*=(const strong_vector& rhs) -> strong_vector&
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag> && (!scaling_tag<Tag>)
+  {
+    return apply<operation::multiply>(rhs, "operator*=");
+  }
+
+  /// \brief Divide the elements of the vector by the elements of `rhs`.
+  /// \throw std::invalid_argument If the sizes of the vectors differ.
+  /// \throw std::overflow_error If any element overflows under gw::checked_arithmetic. All elements are still computed.
+  auto operator/=(const strong_vector& rhs) -> strong_vector&
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag> && (!scaling_tag<Tag>)
+  {
+    return apply<operation::divide>(rhs, "operator/=");
+  }
+
+  /// \brief Scale the elements of the vector by `factor`.
+  /// \throw std::overflow_error If an element overflows under gw::checked_arithmetic.
+  auto operator*=(const T& factor) noexcept(!detail::k_reports_overflow<arithmetic_policy_type>) -> strong_vector&
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag>
+  {
+    return apply<operation::multiply>(factor);
+  }
+
+  /// \brief Divide the elements of the vector by `divisor`.
+  /// \throw std::overflow_error If an element overflows under gw::checked_arithmetic.
+  auto operator/=(const T& divisor) noexcept(!detail::k_reports_overflow<arithmetic_policy_type>) -> strong_vector&
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag> && (!decimal_tag<Tag>)
+  {
+    return apply<operation::divide>(divisor);
+  }
+
+  /// \brief Add the elements of two vectors.
+  friend auto operator+(strong_vector lhs, const strong_vector& rhs) -> strong_vector
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag>
+  {
+    return lhs += rhs;
+  }
+
+  /// \brief Subtract the elements of two vectors.
+  friend auto operator-(strong_vector lhs, const strong_vector& rhs) -> strong_vector
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag>
+  {
+    return lhs -= rhs;
+  }
+
+  /// \brief Multiply the elements of two vectors.
+  friend auto operator*(strong_vector lhs, const strong_vector& rhs) -> strong_vector
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag> && (!scaling_tag<Tag>)
+  {
+    return lhs *= rhs;
+  }
+
+  /// \brief Divide the elements of two vectors.
+  friend auto operator/(strong_vector lhs, const strong_vector& rhs) -> strong_vector
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag> && (!scaling_tag<Tag>)
+  {
+    return lhs /= rhs;
+  }
+
+  /// \brief Scale the elements of a vector by `factor`.
+  friend auto operator*(strong_vector lhs, const T& factor) -> strong_vector
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag>
+  {
+    return lhs *= factor;
+  }
+
+  /// \brief Scale the elements of a vector by `factor`.
+  friend auto operator*(const T& factor, strong_vector rhs) -> strong_vector
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag>
+  {
+    return rhs *= factor;
+  }
+
+  /// \brief Divide the elements of a vector by `divisor`.
+  friend auto operator/(strong_vector lhs, const T& divisor) -> strong_vector
+    requires arithmetic<T> && detail::value_arithmetic_tag<Tag> && (!decimal_tag<Tag>)
+  {
+    return lhs /= divisor;
+  }
+
+  //
+  // Reductions
+  //
+
+  /// \brief Calculate the sum of the elements.
+  auto sum() const noexcept -> value_type
+    requires arithmetic<T>
+  {
+    return value_type{
+        detail::reduce_lanes(size(), T{}, std::plus<>{}, [this](size_type idx) { return m_values[idx]; })};
+  }
+
+  /// \brief Find the smallest element.
+  /// \pre The vector is not empty.
+  auto min() const noexcept -> value_type
+    requires std::totally_ordered<T>
+  {
+    return value_type{detail::reduce_lanes(
+        size(), m_values.front(), [](const T& lhs, const T& rhs) { return rhs < lhs ? rhs : lhs; },
+        [this](size_type idx) { return m_values[idx]; })};
+  }
+
+  /// \brief Find the largest element.
+  /// \pre The vector is not empty.
+  auto max() const noexcept -> value_type
+    requires std::totally_ordered<T>
+  {
+    return value_type{detail::reduce_lanes(
+        size(), m_values.front(), [](const T& lhs, const T& rhs) { return lhs < rhs ? rhs : lhs; },
+        [this](size_type idx) { return m_values[idx]; })};
+  }
+
+  /// \brief Calculate the dot product with another vector.
+  /// \throw std::invalid_argument If the sizes of the vectors differ.
+  auto dot(const strong_vector& rhs) const -> value_type
+    requires arithmetic<T> && (!scaling_tag<Tag>)
+  {
+    check_size(rhs, "dot");
+    return value_type{detail::reduce_lanes(size(), T{}, std::plus<>{},
+                                           [&](size_type idx) { return m_values[idx] * rhs.m_values[idx]; })};
+  }
+
+  /// \brief Calculate the inclusive prefix sum of the elements.
+  auto prefix_sum() const -> strong_vector
+    requires arithmetic<T>
+  {
+    auto result = std::vector<T, Allocator>(m_values.size(), m_values.get_allocator());
+    auto running = T{};
+    for (auto idx = size_type{}; idx < size(); ++idx) {
+      running += m_values[idx];
+      result[idx] = running;
+    }
+    return strong_vector{std::move(result)};
+  }
+
+  //
+  // Element-wise comparisons
+  //
+
+  /// \brief Compare the elements for equality.
+  auto equal_to(const strong_vector& rhs) const -> mask_type
+    requires std::equality_comparable<T>
+  {
+    return compare(rhs, std::equal_to<>{}, "equal_to");
+  }
+
+  /// \brief Compare the elements for inequality.
+  auto not_equal_to(const strong_vector& rhs) const -> mask_type
+    requires std::equality_comparable<T>
+  {
+    return compare(rhs, std::not_equal_to<>{}, "not_equal_to");
+  }
+
+  /// \brief Check which elements are less than the elements of `rhs`.
+  auto less(const strong_vector& rhs) const -> mask_type
+    requires std::totally_ordered<T>
+  {
+    return compare(rhs, std::less<>{}, "less");
+  }
+
+  /// \brief Check which elements are less than or equal to the elements of `rhs`.
+  auto less_equal(const strong_vector& rhs) const -> mask_type
+    requires std::totally_ordered<T>
+  {
+    return compare(rhs, std::less_equal<>{}, "less_equal");
+  }
+
+  /// \brief Check which elements are greater than the elements of `rhs`.
+  auto greater(const strong_vector& rhs) const -> mask_type
+    requires std::totally_ordered<T>
+  {
+    return compare(rhs, std::greater<>{}, "greater");
+  }
+
+  /// \brief Check which elements are greater than or equal to the elements of `rhs`.
+  auto greater_equal(const strong_vector& rhs) const -> mask_type
+    requires std::totally_ordered<T>
+  {
+    return compare(rhs, std::greater_equal<>{}, "greater_equal");
+  }
+
+  /// \brief Compare the elements to `value` for equality.
+  auto equal_to(const value_type& value) const -> mask_type
+    requires std::equality_comparable<T>
+  {
+    return compare(value, std::equal_to<>{});
+  }
+
+  /// \brief Compare the elements to `value` for inequality.
+  auto not_equal_to(const value_type& value) const -> mask_type
+    requires std::equality_comparable<T>
+  {
+    return compare(value, std::not_equal_to<>{});
+  }
+
+  /// \brief Check which elements are less than `value`.
+  auto less(const value_type& value) const -> mask_type
+    requires std::totally_ordered<T>
+  {
+    return compare(value, std::less<>{});
+  }
+
+  /// \brief Check which elements are less than or equal to `value`.
+  auto less_equal(const value_type& value) const -> mask_type
+    requires std::totally_ordered<T>
+  {
+    return compare(value, std::less_equal<>{});
+  }
+
+  /// \brief Check which elements are greater than `value`.
+  auto greater(const value_type& value) const -> mask_type
+    requires std::totally_ordered<T>
+  {
+    return compare(value, std::greater<>{});
+  }
+
+  /// \brief Check which elements are greater than or equal to `value`.
+  auto greater_equal(const value_type& value) const -> mask_type
+    requires std::totally_ordered<T>
+  {
+    return compare(value, std::greater_equal<>{});
+  }
+
+  //
+  // Comparison operators
+  //
+
+  /// \brief Compare two vectors.
+  friend auto operator==(const strong_vector& lhs, const strong_vector& rhs) -> bool
+    requires std::equality_comparable<T>
+  {
+    return lhs.m_values == rhs.m_values;
+  }
+
+ private:
+  using operation = detail::arithmetic_operation;
+
+  std::vector<T, Allocator> m_values;
+
+  void check_size(const strong_vector& rhs, const char* function) const {
+    if (rhs.size() != size()) {
+      detail::throw_error<std::invalid_argument>(
+          std::format("strong_vector::{}: rhs.size() (which is {}) != size (which is {})", function, rhs.size(),
+                      size()));
+    }
+  }
+
+  template <operation Operation>
+  auto apply(const strong_vector& rhs, const char* function) -> strong_vector& {
+    check_size(rhs, function);
+    detail::batch_apply<arithmetic_policy_type, Operation>(std::span{m_values}, std::span<const T>{rhs.m_values});
+    return *this;
+  }
+
+  template <operation Operation>
+  auto apply(const T& rhs) noexcept(!detail::k_reports_overflow<arithmetic_policy_type>) -> strong_vector& {
+    for (auto& value : m_values) {
+      value = arithmetic_policy_type::template apply<Operation>(value, rhs);
+    }
+    return *this;
+  }
+
+  template <typename Compare>
+  auto compare(const strong_vector& rhs, Compare comp, const char* function) const -> mask_type {
+    check_size(rhs, function);
+    auto mask = mask_type(size());
+    for (auto idx = size_type{}; idx < size(); ++idx) {
+      mask[idx] = static_cast<std::uint8_t>(comp(m_values[idx], rhs.m_values[idx]));
+    }
+    return mask;
+  }
+
+  template <typename Compare>
+  auto compare(const value_type& value, Compare comp) const -> mask_type {
+    auto mask = mask_type(size());
+    for (auto idx = size_type{}; idx < size(); ++idx) {
+      mask[idx] = static_cast<std::uint8_t>(comp(m_values[idx], value.value()));
+    }
+    return mask;
+  }
+};
+
+}  // namespace gw
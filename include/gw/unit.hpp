@@ -0,0 +1,224 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <numeric>
+#include <ratio>
+#include <type_traits>
+
+#include "gw/concepts.hpp"
+#include "gw/strong_type.hpp"
+
+/// \brief GW namespace
+namespace gw {
+
+//
+// Dimensions
+//
+
+/// \brief The exponents of the seven SI base dimensions.
+/// \tparam Length The exponent of length.
+/// \tparam Mass The exponent of mass.
+/// \tparam Time The exponent of time.
+/// \tparam Current The exponent of electric current.
+/// \tparam Temperature The exponent of thermodynamic temperature.
+/// \tparam Amount The exponent of amount of substance.
+/// \tparam Luminosity The exponent of luminous intensity.
+template <int Length = 0, int Mass = 0, int Time = 0, int Current = 0, int Temperature = 0, int Amount = 0,
+          int Luminosity = 0>
+struct dimension {
+  static constexpr int length = Length;            ///< The exponent of length.
+  static constexpr int mass = Mass;                ///< The exponent of mass.
+  static constexpr int time = Time;                ///< The exponent of time.
+  static constexpr int current = Current;          ///< The exponent of electric current.
+  static constexpr int temperature = Temperature;  ///< The exponent of thermodynamic temperature.
+  static constexpr int amount = Amount;            ///< The exponent of amount of substance.
+  static constexpr int luminosity = Luminosity;    ///< The exponent of luminous intensity.
+};
+
+/// \brief The product of two dimensions.
+template <typename D1, typename D2>
+using dimension_multiply =
+    dimension<D1::length + D2::length, D1::mass + D2::mass, D1::time + D2::time, D1::current + D2::current,
+              D1::temperature + D2::temperature, D1::amount + D2::amount, D1::luminosity + D2::luminosity>;
+
+/// \brief The quotient of two dimensions.
+template <typename D1, typename D2>
+using dimension_divide =
+    dimension<D1::length - D2::length, D1::mass - D2::mass, D1::time - D2::time, D1::current - D2::current,
+              D1::temperature - D2::temperature, D1::amount - D2::amount, D1::luminosity - D2::luminosity>;
+
+using dimensionless = dimension<>;                       ///< The dimension of pure numbers.
+using length_dimension = dimension<1>;                   ///< The dimension of length.
+using mass_dimension = dimension<0, 1>;                  ///< The dimension of mass.
+using time_dimension = dimension<0, 0, 1>;               ///< The dimension of time.
+using current_dimension = dimension<0, 0, 0, 1>;         ///< The dimension of electric current.
+using temperature_dimension = dimension<0, 0, 0, 0, 1>;  ///< The dimension of thermodynamic temperature.
+
+//
+// Units
+//
+
+/// \example unit_example.cpp
+//
+/// \brief A unit tag for gw::strong_type.
+//
+/// \details A `gw::strong_type` tagged with a `gw::unit` is a quantity. Multiplying or dividing two quantities yields a
+/// quantity of the derived unit, whose dimension and ratio are computed at compile time. Quantities of the same
+/// dimension but different ratios are converted with `gw::quantity_cast` in the style of `std::chrono::duration_cast`,
+/// and are added, subtracted and compared in their common unit. The ratio only exists in the type, so a quantity has
+/// the same size as its value.
+/// \tparam Dimension The dimension of the unit.
+/// \tparam Ratio The ratio of the unit to the coherent SI unit of the dimension.
+template <typename Dimension, typename Ratio = std::ratio<1>>
+struct unit {
+  using dimension = Dimension;         ///< The dimension of the unit.
+  using ratio = typename Ratio::type;  ///< The ratio of the unit to the coherent SI unit of the dimension.
+};
+
+/// \brief The product of two units.
+template <unit_tag U1, unit_tag U2>
+using unit_multiply = unit<dimension_multiply<typename U1::dimension, typename U2::dimension>,
+                           std::ratio_multiply<typename U1::ratio, typename U2::ratio>>;
+
+/// \brief The quotient of two units.
+template <unit_tag U1, unit_tag U2>
+using unit_divide = unit<dimension_divide<typename U1::dimension, typename U2::dimension>,
+                         std::ratio_divide<typename U1::ratio, typename U2::ratio>>;
+
+/// \brief The finest unit that both units can be converted to without loss, like `std::common_type` for durations.
+template <unit_tag U1, unit_tag U2>
+  requires std::same_as<typename U1::dimension, typename U2::dimension>
+using common_unit = unit<typename U1::dimension, std::ratio<std::gcd(U1::ratio::num, U2::ratio::num),
+                                                            std::lcm(U1::ratio::den, U2::ratio::den)>>;
+
+using meter = unit<length_dimension>;                   ///< The meter.
+using kilometer = unit<length_dimension, std::kilo>;    ///< The kilometer.
+using millimeter = unit<length_dimension, std::milli>;  ///< The millimeter.
+using kilogram = unit<mass_dimension>;                  ///< The kilogram.
+using gram = unit<mass_dimension, std::milli>;          ///< The gram.
+using second = unit<time_dimension>;                    ///< The second.
+using millisecond = unit<time_dimension, std::milli>;   ///< The millisecond.
+using hour = unit<time_dimension, std::ratio<3600>>;    ///< The hour.
+
+/// \brief A gw::strong_type tagged with a unit.
+template <typename T, unit_tag Unit>
+using quantity = strong_type<T, Unit>;
+
+//
+// Conversions
+//
+
+/// \brief converts a quantity to another unit of the same dimension
+/// \details The conversion factor is computed at compile time. Conversions between equal ratios compile to nothing,
+/// integral conversions multiply or divide by an integer and floating-point conversions multiply by a constant.
+template <unit_tag ToUnit, typename T, unit_tag FromUnit>
+  requires std::same_as<typename ToUnit::dimension, typename FromUnit::dimension>
+constexpr auto quantity_cast(const strong_type<T, FromUnit>& from) noexcept -> strong_type<T, ToUnit> {
+  using factor = std::ratio_divide<typename FromUnit::ratio, typename ToUnit::ratio>;
+
+  if constexpr (factor::num == 1 && factor::den == 1) {
+    return strong_type<T, ToUnit>{from.value()};
+  } else if constexpr (std::floating_point<T>) {
+    constexpr auto k_factor = static_cast<T>(factor::num) / static_cast<T>(factor::den);
+    return strong_type<T, ToUnit>{static_cast<T>(from.value() * k_factor)};
+  } else if constexpr (factor::den == 1) {
+    return strong_type<T, ToUnit>{static_cast<T>(from.value() * static_cast<T>(factor::num))};
+  } else if constexpr (factor::num == 1) {
+    return strong_type<T, ToUnit>{static_cast<T>(from.value() / static_cast<T>(factor::den))};
+  } else {
+    using intermediate = std::common_type_t<T, std::intmax_t>;
+    return strong_type<T, ToUnit>{
+        static_cast<T>(static_cast<intermediate>(from.value()) * factor::num / factor::den)};
+  }
+}
+
+//
+// Arithmetic operators
+//
+
+/// \brief multiplies two quantities, deriving the unit of the result
+template <typename T, unit_tag U1, unit_tag U2>
+constexpr auto operator*(const strong_type<T, U1>& lhs, const strong_type<T, U2>& rhs) noexcept(
+    noexcept(lhs.value() * rhs.value())) -> strong_type<T, unit_multiply<U1, U2>> {
+  return strong_type<T, unit_multiply<U1, U2>>{lhs.value() * rhs.value()};
+}
+
+/// \brief divides two quantities, deriving the unit of the result
+template <typename T, unit_tag U1, unit_tag U2>
+constexpr auto operator/(const strong_type<T, U1>& lhs, const strong_type<T, U2>& rhs) noexcept(
+    noexcept(lhs.value() / rhs.value())) -> strong_type<T, unit_divide<U1, U2>> {
+  return strong_type<T, unit_divide<U1, U2>>{lhs.value() / rhs.value()};
+}
+
+/// \brief scales a quantity
+template <typename T, unit_tag U>
+constexpr auto operator*(const strong_type<T, U>& lhs, const T& rhs) noexcept(noexcept(lhs.value() * rhs))
+    -> strong_type<T, U> {
+  return strong_type<T, U>{lhs.value() * rhs};
+}
+
+/// \brief scales a quantity
+template <typename T, unit_tag U>
+constexpr auto operator*(const T& lhs, const strong_type<T, U>& rhs) noexcept(noexcept(lhs * rhs.value()))
+    -> strong_type<T, U> {
+  return strong_type<T, U>{lhs * rhs.value()};
+}
+
+/// \brief scales a quantity
+template <typename T, unit_tag U>
+constexpr auto operator/(const strong_type<T, U>& lhs, const T& rhs) noexcept(noexcept(lhs.value() / rhs))
+    -> strong_type<T, U> {
+  return strong_type<T, U>{lhs.value() / rhs};
+}
+
+/// \brief divides a number by a quantity, inverting the unit
+template <typename T, unit_tag U>
+constexpr auto operator/(const T& lhs, const strong_type<T, U>& rhs) noexcept(noexcept(lhs / rhs.value()))
+    -> strong_type<T, unit_divide<unit<dimensionless>, U>> {
+  return strong_type<T, unit_divide<unit<dimensionless>, U>>{lhs / rhs.value()};
+}
+
+/// \brief adds two quantities of the same dimension in their common unit
+template <typename T, unit_tag U1, unit_tag U2>
+  requires(!std::same_as<U1, U2>) && std::same_as<typename U1::dimension, typename U2::dimension>
+constexpr auto operator+(const strong_type<T, U1>& lhs, const strong_type<T, U2>& rhs) noexcept
+    -> strong_type<T, common_unit<U1, U2>> {
+  using common = common_unit<U1, U2>;
+  return strong_type<T, common>{quantity_cast<common>(lhs).value() + quantity_cast<common>(rhs).value()};
+}
+
+/// \brief subtracts two quantities of the same dimension in their common unit
+template <typename T, unit_tag U1, unit_tag U2>
+  requires(!std::same_as<U1, U2>) && std::same_as<typename U1::dimension, typename U2::dimension>
+constexpr auto operator-(const strong_type<T, U1>& lhs, const strong_type<T, U2>& rhs) noexcept
+    -> strong_type<T, common_unit<U1, U2>> {
+  using common = common_unit<U1, U2>;
+  return strong_type<T, common>{quantity_cast<common>(lhs).value() - quantity_cast<common>(rhs).value()};
+}
+
+//
+// Comparison operators
+//
+
+/// \brief compares two quantities of the same dimension in their common unit
+template <typename T, unit_tag U1, unit_tag U2>
+  requires(!std::same_as<U1, U2>) && std::same_as<typename U1::dimension, typename U2::dimension>
+constexpr auto operator==(const strong_type<T, U1>& lhs, const strong_type<T, U2>& rhs) noexcept -> bool {
+  using common = common_unit<U1, U2>;
+  return quantity_cast<common>(lhs).value() == quantity_cast<common>(rhs).value();
+}
+
+/// \brief compares two quantities of the same dimension in their common unit
+template <typename T, unit_tag U1, unit_tag U2>
+  requires(!std::same_as<U1, U2>) && std::same_as<typename U1::dimension, typename U2::dimension>
+constexpr auto operator<=>(const strong_type<T, U1>& lhs, const strong_type<T, U2>& rhs) noexcept {
+  using common = common_unit<U1, U2>;
+  return quantity_cast<common>(lhs).value() <=> quantity_cast<common>(rhs).value();
+}
+
+}  // namespace gw
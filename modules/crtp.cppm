@@ -0,0 +1,15 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+module;
+
+#include "gw/crtp.hpp"
+
+export module gw.crtp;
+
+/// \brief GW namespace
+export namespace gw {
+
+using gw::crtp;
+
+}  // namespace gw
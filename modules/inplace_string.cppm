@@ -0,0 +1,32 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+module;
+
+#include "gw/inplace_string.hpp"
+#include "gw/inplace_string_statistics.hpp"
+
+export module gw.inplace_string;
+
+/// \brief GW namespace
+export namespace gw {
+
+using gw::basic_inplace_string;
+using gw::get_inplace_string_sink;
+using gw::inplace_string;
+using gw::inplace_string_capacity_statistics;
+using gw::inplace_string_sink;
+using gw::inplace_string_statistics;
+using gw::inplace_u16string;
+using gw::inplace_u32string;
+using gw::inplace_wstring;
+using gw::k_inplace_string_instrumentation;
+using gw::set_inplace_string_sink;
+
+// gw/error.hpp
+using gw::error_handler;
+using gw::error_kind;
+using gw::get_error_handler;
+using gw::set_error_handler;
+
+}  // namespace gw
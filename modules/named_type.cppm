@@ -0,0 +1,50 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+module;
+
+#include "gw/named_type.hpp"
+
+export module gw.named_type;
+
+// The names of gw::named_type are gw::basic_inplace_string objects
+export import gw.inplace_string;
+
+/// \brief GW namespace
+export namespace gw {
+
+using gw::make_named_type;
+using gw::name_id;
+using gw::name_of;
+using gw::named_type;
+
+// gw/concepts.hpp
+using gw::arithmetic;
+using gw::complete;
+using gw::decimal_tag;
+using gw::decrementable;
+using gw::hashable;
+using gw::incrementable;
+using gw::istreamable;
+using gw::named;
+using gw::ostreamable;
+using gw::scaling_tag;
+using gw::unit_tag;
+
+// gw/error.hpp
+using gw::error_handler;
+using gw::error_kind;
+using gw::get_error_handler;
+using gw::set_error_handler;
+
+// gw/hash.hpp
+using gw::fnv1a;
+using gw::hash_combine;
+using gw::hash_mix;
+using gw::hash_tuple;
+using gw::k_fnv1a_offset_basis;
+using gw::k_fnv1a_prime;
+using gw::type_hash_v;
+using gw::type_name;
+
+}  // namespace gw
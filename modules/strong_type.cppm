@@ -0,0 +1,85 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+module;
+
+#include "gw/strong_type.hpp"
+
+export module gw.strong_type;
+
+// Custom skills of gw::strong_type derive from gw::crtp
+export import gw.crtp;
+
+/// \brief GW namespace
+export namespace gw {
+
+using gw::as_strong;
+using gw::as_underlying;
+using gw::k_has_skill;
+using gw::make_strong_type;
+using gw::strong_type;
+
+/// \brief Skills namespace
+namespace skills {
+
+using gw::skills::addable;
+using gw::skills::bitwise;
+using gw::skills::comparable;
+using gw::skills::decrementable;
+using gw::skills::dividable;
+using gw::skills::equality_comparable;
+using gw::skills::hashable;
+using gw::skills::incrementable;
+using gw::skills::modulable;
+using gw::skills::multipliable;
+using gw::skills::negatable;
+using gw::skills::printable;
+using gw::skills::subtractable;
+using gw::skills::with;
+
+}  // namespace skills
+
+// gw/arithmetic.hpp
+using gw::arithmetic_policy;
+using gw::batch_add;
+using gw::batch_divide;
+using gw::batch_multiply;
+using gw::batch_subtract;
+using gw::checked_arithmetic;
+#if defined(__cpp_lib_expected)
+using gw::expected_arithmetic;
+#endif  // defined(__cpp_lib_expected)
+using gw::saturating_arithmetic;
+using gw::unchecked_arithmetic;
+using gw::wrapping_arithmetic;
+
+// gw/concepts.hpp
+using gw::arithmetic;
+using gw::complete;
+using gw::decimal_tag;
+using gw::decrementable;
+using gw::hashable;
+using gw::incrementable;
+using gw::istreamable;
+using gw::named;
+using gw::ostreamable;
+using gw::scaling_tag;
+using gw::unit_tag;
+
+// gw/error.hpp
+using gw::error_handler;
+using gw::error_kind;
+using gw::get_error_handler;
+using gw::set_error_handler;
+
+// gw/hash.hpp
+using gw::fnv1a;
+using gw::hash_combine;
+using gw::hash_mix;
+using gw::hash_tuple;
+using gw::k_fnv1a_offset_basis;
+using gw::k_fnv1a_prime;
+using gw::type_hash_v;
+using gw::type_name;
+
+}  // namespace gw
@@ -0,0 +1,246 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "support/allocation.hpp"
+
+#include <array>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gw/arithmetic.hpp"
+#include "gw/inplace_string.hpp"
+#include "gw/named_type.hpp"
+#include "gw/skills.hpp"
+#include "gw/strong_type.hpp"
+
+// The [allocation] cases cover every operation of gw::basic_inplace_string, gw::strong_type and gw::named_type that
+// does not throw, except:
+// - operator<< and operator>>, because the streams allocate by design
+// - std::format to a std::string, which allocates the string; std::format_to a buffer is covered instead
+// - the operations on an overflow under gw::checked_arithmetic and gw::expected_arithmetic, which throw or report it
+// The gw::basic_inplace_string case is in inplace_string_test.cpp.
+
+namespace {
+
+auto g_sink = std::string{};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct allocation_tag {};
+
+/// \brief gw::strong_type of any type, named by `allocation_tag`.
+struct strong_types {
+  template <typename T>
+  using type = gw::strong_type<T, allocation_tag>;
+
+  template <typename T>
+  static constexpr auto make(T value) noexcept -> type<T> {
+    return gw::make_strong_type<allocation_tag>(value);
+  }
+};
+
+/// \brief gw::strong_type of any type with all skills, named by `allocation_tag`.
+struct skilled_strong_types {
+  using skills_type =
+      gw::skills::with<gw::skills::comparable, gw::skills::incrementable, gw::skills::decrementable,
+                       gw::skills::negatable, gw::skills::addable, gw::skills::subtractable, gw::skills::multipliable,
+                       gw::skills::dividable, gw::skills::modulable, gw::skills::bitwise, gw::skills::hashable,
+                       gw::skills::printable>;
+
+  template <typename T>
+  using type = gw::strong_type<T, allocation_tag, skills_type>;
+
+  template <typename T>
+  static constexpr auto make(T value) noexcept -> type<T> {
+    return type<T>{value};
+  }
+};
+
+/// \brief gw::named_type of any type, named "Allocation".
+struct named_types {
+  template <typename T>
+  using type = gw::named_type<T, "Allocation">;
+
+  template <typename T>
+  static constexpr auto make(T value) noexcept -> type<T> {
+    return gw::make_named_type<"Allocation">(value);
+  }
+};
+
+}  // namespace
+
+TEST_CASE("allocations are counted", "[allocation]") {
+  const auto allocations = gw::test::allocation_count();
+  const auto deallocations = gw::test::deallocation_count();
+  {
+    auto vector = std::vector<int>(100U);
+    auto pointer = std::make_unique<int[]>(100U);  // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays)
+    REQUIRE(vector.size() == 100U);
+    REQUIRE(pointer != nullptr);
+  }
+  REQUIRE(gw::test::allocation_count() - allocations == 2U);
+  REQUIRE(gw::test::deallocation_count() - deallocations == 2U);
+}
+
+TEST_CASE("blocks without allocations pass", "[allocation]") {
+  auto sum = 0;
+  GW_ASSERT_NO_ALLOC {
+    for (auto index = 0; index < 10; ++index) {
+      sum += index;
+    }
+  }
+  REQUIRE(sum == 45);
+}
+
+TEST_CASE("blocks with allocations fail", "[allocation][!shouldfail]") {
+  GW_ASSERT_NO_ALLOC {  //
+    g_sink = std::string(100U, 'X');
+  }
+}
+
+TEMPLATE_TEST_CASE("strong_types and named_types do not allocate", "[allocation]", strong_types, skilled_strong_types,
+                   named_types) {
+  using test_t = typename TestType::template type<int>;
+  using bits_t = typename TestType::template type<unsigned int>;
+  using text_t = typename TestType::template type<gw::inplace_string<15U>>;
+
+  auto value = test_t{};
+  auto other = test_t{};
+  auto bits = bits_t{};
+  auto text = text_t{};
+  auto result = std::size_t{};
+  auto buffer = std::array<char, 64U>{};
+
+  GW_ASSERT_NO_ALLOC {
+    value = test_t{6};
+    other = TestType::make(3);
+    auto copy = test_t{value};
+    auto moved = test_t{std::move(copy)};
+    copy = moved;
+    moved = std::move(copy);
+    value.swap(other);
+    std::swap(value, other);
+    value.swap(other);
+    other.reset();
+    other.emplace(7);
+    text = text_t{"Hello"};
+    text = text_t{std::initializer_list<char>{'H', 'e', 'l', 'l', 'o'}};
+    text.emplace("Hello, World!");
+  }
+  REQUIRE(value == test_t{3});
+  REQUIRE(other == test_t{7});
+  REQUIRE(text->view() == "Hello, World!");
+
+  GW_ASSERT_NO_ALLOC {
+    const auto& const_value = value;
+    result += static_cast<std::size_t>(value.value() + const_value.value() + test_t{1}.value() +
+                                       std::move(const_value).value());  // NOLINT(*-move-const-arg)
+    result += static_cast<std::size_t>(*value + *const_value + *test_t{1} +
+                                       *std::move(const_value));  // NOLINT(*-move-const-arg)
+    result += static_cast<std::size_t>(static_cast<int&>(value) + static_cast<const int&>(const_value) +
+                                       static_cast<int&&>(test_t{1}));
+    result += text->size() + static_cast<std::size_t>(std::ranges::distance(text.begin(), text.end()));
+    result += static_cast<std::size_t>(std::ranges::distance(std::as_const(text).begin(), std::as_const(text).end()));
+    const auto increment = [](int number) { return number + 1; };
+    value = value.transform(increment);
+    value = const_value.transform(increment);
+    value = std::move(const_value).transform(increment);  // NOLINT(*-move-const-arg)
+    value = test_t{value}.transform(increment);
+  }
+  REQUIRE(value == test_t{7});
+  REQUIRE(result > 0U);
+
+  GW_ASSERT_NO_ALLOC {
+    ++value;
+    value++;
+    --value;
+    value--;
+    value = -(+value);
+    value = (value + other - test_t{1}) * test_t{2} / test_t{3} % test_t{5};
+    value += other;
+    value -= test_t{1};
+    value *= test_t{2};
+    value /= test_t{2};
+    value %= test_t{100};
+    bits = ((bits_t{0xF0U} & bits_t{0x3CU}) | bits_t{0x01U}) ^ ~bits_t{};
+    bits = (bits << bits_t{1U}) >> bits_t{2U};
+    bits &= bits_t{0xFFU};
+    bits |= bits_t{0x100U};
+    bits ^= bits_t{0x1U};
+    bits <<= bits_t{1U};
+    bits >>= bits_t{1U};
+  }
+  REQUIRE(bits != bits_t{});
+
+  GW_ASSERT_NO_ALLOC {
+    result += (value == other ? 1U : 0U) + (value != other ? 1U : 0U) + (value < other ? 1U : 0U) +
+              (value <= other ? 1U : 0U) + (value > other ? 1U : 0U) + (value >= other ? 1U : 0U) +
+              (value <=> other == 0 ? 1U : 0U);
+    result += std::hash<test_t>{}(value) + std::hash<text_t>{}(text);
+    result += static_cast<std::size_t>(std::format_to(buffer.data(), "{} {}", value, text) - buffer.data());
+  }
+  REQUIRE(result > 0U);
+}
+
+TEST_CASE("strong_type arithmetic policies and spans do not allocate", "[allocation]") {
+  struct saturating_tag {
+    using arithmetic_policy = gw::saturating_arithmetic;
+  };
+  struct wrapping_tag {
+    using arithmetic_policy = gw::wrapping_arithmetic;
+  };
+  struct checked_tag {
+    using arithmetic_policy = gw::checked_arithmetic;
+  };
+  using test_t = gw::strong_type<int, allocation_tag>;
+  using saturating_t = gw::strong_type<int, saturating_tag>;
+  using wrapping_t = gw::strong_type<int, wrapping_tag>;
+  using checked_t = gw::strong_type<int, checked_tag>;
+  constexpr auto k_max = std::numeric_limits<int>::max();
+
+  auto saturating = saturating_t{};
+  auto wrapping = wrapping_t{};
+  auto checked = checked_t{};
+  auto values = std::array{test_t{1}, test_t{2}, test_t{3}};
+  auto raw = std::array{1, 2, 3};
+  auto result = std::size_t{};
+
+  GW_ASSERT_NO_ALLOC {
+    saturating = saturating_t{k_max} + saturating_t{1};
+    saturating -= saturating_t{1};
+    wrapping = wrapping_t{k_max} + wrapping_t{1};
+    wrapping *= wrapping_t{2};
+    checked = checked_t{2} * checked_t{3};
+    checked += checked_t{1};
+    checked /= checked_t{7};
+  }
+  REQUIRE(saturating == saturating_t{k_max - 1});
+  REQUIRE(wrapping == wrapping_t{0});
+  REQUIRE(checked == checked_t{1});
+
+  GW_ASSERT_NO_ALLOC {
+    const auto ones = std::array{test_t{1}, test_t{1}, test_t{1}};
+    gw::batch_add(std::span{values}, ones);
+    gw::batch_subtract(std::span{values}, ones);
+    gw::batch_multiply(std::span{values}, ones);
+    gw::batch_divide(std::span{values}, ones);
+    gw::batch_add<gw::saturating_arithmetic>(std::span{raw}, std::array{1, 1, 1});
+    gw::batch_add<gw::checked_arithmetic>(std::span{raw}, std::array{1, 1, 1});
+    result += gw::as_underlying(std::span{values}).size() + gw::as_underlying(std::span{std::as_const(values)}).size();
+    result += gw::as_strong<allocation_tag>(std::span{raw}).size();
+    result += gw::as_strong<allocation_tag>(std::span{std::as_const(raw)}).size();
+  }
+  REQUIRE(values[0] == test_t{1});
+  REQUIRE(raw == std::array{3, 4, 5});
+  REQUIRE(result == 12U);
+}
@@ -0,0 +1,178 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/atomic_strong_type.hpp"
+
+#include <array>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "gw/arithmetic.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+using count_t = gw::strong_type<std::uint64_t, struct count_tag>;
+
+struct saturating_tag {
+  using arithmetic_policy = gw::saturating_arithmetic;
+};
+using saturating_t = gw::strong_type<std::uint8_t, saturating_tag>;
+
+template <typename Atomic, typename Value>
+concept fetch_addable = requires(Atomic atomic, Value value) { atomic.fetch_add(value); };
+
+}  // namespace
+
+TEST_CASE("atomic_strong_types are constructed", "[atomic_strong_type]") {
+  using test_t = gw::atomic_strong_type<std::uint64_t, struct count_tag>;
+
+  STATIC_REQUIRE(std::is_same_v<test_t::value_type, count_t>);
+  STATIC_REQUIRE(std::is_same_v<test_t::underlying_type, std::uint64_t>);
+  STATIC_REQUIRE(!std::is_copy_constructible_v<test_t>);
+  STATIC_REQUIRE(!std::is_copy_assignable_v<test_t>);
+  STATIC_REQUIRE(sizeof(test_t) == sizeof(std::atomic<std::uint64_t>));
+
+  const auto value = test_t{count_t{42U}};
+  REQUIRE(value.load() == count_t{42U});
+  REQUIRE(test_t{}.load() == count_t{0U});
+}
+
+TEST_CASE("atomic_strong_types are padded to cache lines", "[atomic_strong_type]") {
+  using test_t = gw::padded_atomic_strong_type<std::uint64_t, struct count_tag>;
+
+  STATIC_REQUIRE(alignof(test_t) == gw::k_cache_line_size);
+  STATIC_REQUIRE(sizeof(test_t) == gw::k_cache_line_size);
+
+  auto counters = std::array<test_t, 2>{};
+  const auto distance = reinterpret_cast<std::uintptr_t>(&counters[1]) -  // NOLINT
+                        reinterpret_cast<std::uintptr_t>(&counters[0]);   // NOLINT
+  REQUIRE(distance == gw::k_cache_line_size);
+}
+
+TEST_CASE("atomic_strong_types are loaded and stored", "[atomic_strong_type]") {
+  auto value = gw::atomic_strong_type<std::uint64_t, struct count_tag>{};
+
+  value.store(count_t{1U}, std::memory_order_release);
+  REQUIRE(value.load(std::memory_order_acquire) == count_t{1U});
+
+  value = count_t{2U};
+  REQUIRE(static_cast<count_t>(value) == count_t{2U});
+
+  REQUIRE(value.exchange(count_t{3U}) == count_t{2U});
+  REQUIRE(value.load() == count_t{3U});
+}
+
+TEST_CASE("atomic_strong_types are compared and exchanged", "[atomic_strong_type]") {
+  auto value = gw::atomic_strong_type<std::uint64_t, struct count_tag>{count_t{1U}};
+
+  auto expected = count_t{2U};
+  REQUIRE_FALSE(value.compare_exchange_strong(expected, count_t{3U}));
+  REQUIRE(expected == count_t{1U});
+
+  REQUIRE(value.compare_exchange_strong(expected, count_t{3U}, std::memory_order_acq_rel, std::memory_order_relaxed));
+  REQUIRE(value.load() == count_t{3U});
+
+  while (!value.compare_exchange_weak(expected, count_t{4U})) {
+  }
+  REQUIRE(value.load() == count_t{4U});
+}
+
+TEST_CASE("atomic_strong_types are modified", "[atomic_strong_type]") {
+  SECTION("arithmetic") {
+    auto value = gw::atomic_strong_type<std::uint64_t, struct count_tag>{};
+
+    STATIC_REQUIRE(fetch_addable<decltype(value)&, count_t>);
+    STATIC_REQUIRE(!fetch_addable<decltype(value)&, std::uint64_t>);
+
+    REQUIRE(value.fetch_add(count_t{5U}, std::memory_order_relaxed) == count_t{0U});
+    REQUIRE(value.fetch_sub(count_t{2U}) == count_t{5U});
+    REQUIRE((value += count_t{4U}) == count_t{7U});
+    REQUIRE((value -= count_t{1U}) == count_t{6U});
+  }
+
+  SECTION("bitwise") {
+    auto value = gw::atomic_strong_type<std::uint64_t, struct count_tag>{count_t{0b1100U}};
+
+    REQUIRE(value.fetch_and(count_t{0b0100U}) == count_t{0b1100U});
+    REQUIRE(value.fetch_or(count_t{0b0011U}) == count_t{0b0100U});
+    REQUIRE(value.fetch_xor(count_t{0b0001U}) == count_t{0b0111U});
+    REQUIRE(value.load() == count_t{0b0110U});
+  }
+
+  SECTION("arithmetic policy") {
+    auto value = gw::atomic_strong_type<std::uint8_t, saturating_tag>{saturating_t{std::uint8_t{250}}};
+
+    REQUIRE(value.fetch_add(saturating_t{std::uint8_t{10}}) == saturating_t{std::uint8_t{250}});
+    REQUIRE(value.load() == saturating_t{std::numeric_limits<std::uint8_t>::max()});
+    REQUIRE((value += saturating_t{std::uint8_t{1}}) == saturating_t{std::numeric_limits<std::uint8_t>::max()});
+  }
+
+  SECTION("signed overflow") {
+    using signed_t = gw::strong_type<std::int32_t, struct signed_tag>;
+    constexpr auto k_max = std::numeric_limits<std::int32_t>::max();
+    constexpr auto k_min = std::numeric_limits<std::int32_t>::min();
+    auto value = gw::atomic_strong_type<std::int32_t, struct signed_tag>{signed_t{k_max}};
+
+    REQUIRE((value += signed_t{1}) == signed_t{k_min});
+    REQUIRE((value -= signed_t{1}) == signed_t{k_max});
+    REQUIRE(value.load() == signed_t{k_max});
+  }
+}
+
+TEST_CASE("atomic_strong_types are updated concurrently", "[atomic_strong_type]") {
+  constexpr auto k_threads = 4U;
+  constexpr auto k_increments = 10'000U;
+
+  auto value = gw::padded_atomic_strong_type<std::uint64_t, struct count_tag>{};
+  {
+    auto threads = std::vector<std::jthread>{};
+    for (auto thread = 0U; thread < k_threads; ++thread) {
+      threads.emplace_back([&value] {
+        for (auto increment = 0U; increment < k_increments; ++increment) {
+          value.fetch_add(count_t{1U}, std::memory_order_relaxed);
+        }
+      });
+    }
+  }
+  REQUIRE(value.load() == count_t{k_threads * k_increments});
+}
+
+TEST_CASE("atomic_strong_types are waited on", "[atomic_strong_type]") {
+  auto value = gw::atomic_strong_type<std::uint64_t, struct count_tag>{};
+
+  auto waiter = std::jthread{[&value] { value.wait(count_t{0U}); }};
+  value.store(count_t{1U});
+  value.notify_all();
+  waiter.join();
+
+  REQUIRE(value.load() == count_t{1U});
+}
+
+TEST_CASE("atomic_strong_type_refs operate on strong_type storage", "[atomic_strong_type]") {
+  auto counters = std::array{count_t{}, count_t{}};
+  {
+    auto threads = std::vector<std::jthread>{};
+    for (auto& counter : counters) {
+      threads.emplace_back([&counter] {
+        const auto ref = gw::atomic_strong_type_ref{counter};
+        for (auto increment = 0U; increment < 1'000U; ++increment) {
+          ref.fetch_add(count_t{1U}, std::memory_order_relaxed);
+        }
+      });
+    }
+  }
+  REQUIRE(counters[0] == count_t{1'000U});
+  REQUIRE(counters[1] == count_t{1'000U});
+
+  const auto ref = gw::atomic_strong_type_ref{counters[0]};
+  auto expected = count_t{1'000U};
+  REQUIRE(ref.compare_exchange_strong(expected, count_t{0U}));
+  REQUIRE(ref.exchange(count_t{7U}) == count_t{0U});
+  REQUIRE(counters[0] == count_t{7U});
+}
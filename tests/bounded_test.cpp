@@ -0,0 +1,173 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/bounded.hpp"
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "gw/strong_type.hpp"
+
+namespace {
+
+using percent_t = gw::bounded<int, 0, 100, struct percent_tag>;
+using delta_t = gw::bounded<int, -10, 10, struct percent_tag>;
+using slot_t = gw::bounded<std::size_t, 0, 7, struct slot_tag>;
+using byte_t = gw::bounded<std::uint8_t, 0, 255, struct byte_tag>;
+
+template <typename Lhs, typename Rhs>
+concept addable = requires(Lhs lhs, Rhs rhs) { lhs + rhs; };
+
+template <typename Lhs, typename Rhs>
+concept dividable = requires(Lhs lhs, Rhs rhs) { lhs / rhs; };
+
+template <typename Range, typename Index>
+concept indexable = requires(Range range, Index index) { gw::index(range, index); };
+
+template <typename T, T Min, T Max, typename Tag>
+constexpr auto bounds(const gw::bounded<T, Min, Max, Tag>& /*bounded*/) noexcept {
+  return std::array{Min, Max};
+}
+
+}  // namespace
+
+TEST_CASE("bounded values are constructed", "[bounded]") {
+  STATIC_REQUIRE(sizeof(percent_t) == sizeof(int));
+  STATIC_REQUIRE(percent_t::min_value == 0);
+  STATIC_REQUIRE(percent_t::max_value == 100);
+  STATIC_REQUIRE(percent_t{}.value() == 0);
+  STATIC_REQUIRE(gw::bounded<int, 5, 10, struct test_tag>{}.value() == 5);
+  STATIC_REQUIRE(gw::bounded<int, -10, -5, struct test_tag>{}.value() == -5);
+  STATIC_REQUIRE(percent_t{42}.value() == 42);
+  STATIC_REQUIRE(!std::is_convertible_v<int, percent_t>);
+
+  REQUIRE_THROWS_AS(percent_t{101}, std::out_of_range);
+  REQUIRE_THROWS_AS(percent_t{-1}, std::out_of_range);
+
+  STATIC_REQUIRE(percent_t::clamp(150).value() == 100);
+  STATIC_REQUIRE(percent_t::clamp(-5).value() == 0);
+  STATIC_REQUIRE(percent_t::contains(100));
+  STATIC_REQUIRE(!percent_t::contains(101));
+}
+
+TEST_CASE("bounded values are converted between ranges", "[bounded]") {
+  using half_t = gw::bounded<int, 0, 50, struct percent_tag>;
+
+  // Widening is implicit and unchecked
+  STATIC_REQUIRE(std::is_convertible_v<half_t, percent_t>);
+  constexpr percent_t widened = half_t{25};
+  STATIC_REQUIRE(widened.value() == 25);
+
+  // Narrowing is explicit and checked
+  STATIC_REQUIRE(!std::is_convertible_v<percent_t, half_t>);
+  STATIC_REQUIRE(half_t{percent_t{50}}.value() == 50);
+  REQUIRE_THROWS_AS(half_t{percent_t{51}}, std::out_of_range);
+
+  // Tags do not mix
+  STATIC_REQUIRE(!std::is_constructible_v<percent_t, slot_t>);
+  STATIC_REQUIRE(!addable<percent_t, gw::bounded<int, 0, 100, struct other_tag>>);
+
+  STATIC_REQUIRE(std::is_same_v<decltype(percent_t{1}.to_strong_type()), gw::strong_type<int, percent_tag>>);
+}
+
+TEST_CASE("bounded values propagate their bounds", "[bounded]") {
+  SECTION("addition") {
+    constexpr auto sum = percent_t{60} + delta_t{-5};
+    STATIC_REQUIRE(sum.value() == 55);
+    STATIC_REQUIRE(bounds(sum) == std::array{-10, 110});
+  }
+
+  SECTION("subtraction") {
+    constexpr auto difference = percent_t{60} - delta_t{-5};
+    STATIC_REQUIRE(difference.value() == 65);
+    STATIC_REQUIRE(bounds(difference) == std::array{-10, 110});
+  }
+
+  SECTION("multiplication") {
+    constexpr auto product = percent_t{3} * delta_t{-4};
+    STATIC_REQUIRE(product.value() == -12);
+    STATIC_REQUIRE(bounds(product) == std::array{-1'000, 1'000});
+  }
+
+  SECTION("division") {
+    using divisor_t = gw::bounded<int, 2, 4, struct percent_tag>;
+    constexpr auto quotient = percent_t{90} / divisor_t{3};
+    STATIC_REQUIRE(quotient.value() == 30);
+    STATIC_REQUIRE(bounds(quotient) == std::array{0, 50});
+
+    // A divisor that may be zero is rejected at compile time
+    STATIC_REQUIRE(dividable<percent_t, divisor_t>);
+    STATIC_REQUIRE(!dividable<percent_t, percent_t>);
+    STATIC_REQUIRE(!dividable<percent_t, delta_t>);
+  }
+
+  SECTION("negation") {
+    constexpr auto negated = -delta_t{3};
+    STATIC_REQUIRE(negated.value() == -3);
+    STATIC_REQUIRE(bounds(-percent_t{}) == std::array{-100, 0});
+  }
+
+  SECTION("constants") {
+    constexpr auto next = slot_t{6} + gw::bounded_constant<std::size_t{1}, slot_tag>;
+    STATIC_REQUIRE(next.value() == 7U);
+    STATIC_REQUIRE(bounds(next) == std::array<std::size_t, 2>{1U, 8U});
+  }
+
+  SECTION("overflowing bounds") {
+    using small_byte_t = gw::bounded<std::uint8_t, 0, 100, struct byte_tag>;
+    constexpr auto sum = small_byte_t{std::uint8_t{100}} + small_byte_t{std::uint8_t{100}};
+    STATIC_REQUIRE(sum.value() == 200U);
+    STATIC_REQUIRE(!addable<decltype(sum), small_byte_t>);
+    STATIC_REQUIRE(!addable<byte_t, byte_t>);
+  }
+}
+
+TEST_CASE("bounded values are compared", "[bounded]") {
+  STATIC_REQUIRE(percent_t{5} == delta_t{5});
+  STATIC_REQUIRE(percent_t{5} != percent_t{6});
+  STATIC_REQUIRE(delta_t{-5} < percent_t{0});
+  STATIC_REQUIRE(percent_t{100} >= percent_t{100});
+}
+
+TEST_CASE("bounded values index ranges", "[bounded]") {
+  auto array = std::array<int, 8>{0, 1, 2, 3, 4, 5, 6, 7};
+  auto vector = std::vector<int>{0, 1, 2};
+
+  SECTION("proven indices") {
+    STATIC_REQUIRE(indexable<std::array<int, 8>&, slot_t>);
+    STATIC_REQUIRE(indexable<std::span<int, 8>, slot_t>);
+    STATIC_REQUIRE(!indexable<std::array<int, 7>&, slot_t>);
+    STATIC_REQUIRE(!indexable<std::vector<int>&, slot_t>);
+    STATIC_REQUIRE(!indexable<std::array<int, 8>&, delta_t>);
+
+    gw::index(array, slot_t{3}) = 42;
+    REQUIRE(array[3] == 42);
+    REQUIRE(gw::at(array, slot_t{7}) == 7);
+  }
+
+  SECTION("checked indices") {
+    REQUIRE(gw::at(vector, slot_t{2}) == 2);
+    REQUIRE_THROWS_AS(gw::at(vector, slot_t{3}), std::out_of_range);
+    REQUIRE_THROWS_AS(gw::at(array, delta_t{-1}), std::out_of_range);
+    REQUIRE_THROWS_AS(gw::at(std::array<int, 4>{}, slot_t{4}), std::out_of_range);
+  }
+}
+
+TEST_CASE("bounded values are hashed and formatted", "[bounded]") {
+  REQUIRE(std::hash<percent_t>{}(percent_t{5}) == std::hash<gw::strong_type<int, percent_tag>>{}(
+                                                       gw::strong_type<int, percent_tag>{5}));
+  REQUIRE(std::format("{}", percent_t{42}) == "42");
+
+  auto stream = std::ostringstream{};
+  stream << delta_t{-3};
+  REQUIRE(stream.str() == "-3");
+}
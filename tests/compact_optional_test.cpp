@@ -0,0 +1,164 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/compact_optional.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "gw/inplace_string.hpp"
+#include "gw/named_type.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+struct id_tag {
+  static constexpr auto sentinel = std::numeric_limits<std::uint32_t>::max();
+};
+using user_id_t = gw::strong_type<std::uint32_t, id_tag>;
+using optional_id_t = gw::compact_optional<user_id_t>;
+
+using symbol_t = gw::inplace_string<7>;
+using optional_symbol_t = gw::compact_optional<symbol_t>;
+
+using name_t = gw::named_type<gw::inplace_string<15>, "name">;
+using optional_name_t = gw::compact_optional<name_t>;
+
+using level_t = gw::compact_optional<int, gw::sentinel_value<int, -1>>;
+
+/// Leave non-null bytes on the stack, where a string that does not initialize its characters would pick them up.
+[[gnu::noinline]] void dirty_stack() {
+  volatile char bytes[256];  // NOLINT(*-avoid-c-arrays)
+  for (auto& byte : bytes) {
+    byte = 'X';
+  }
+}
+
+[[gnu::noinline]] auto concatenate(const gw::inplace_string<3>& lhs, const gw::inplace_string<4>& rhs)
+    -> optional_symbol_t {
+  return optional_symbol_t{lhs + rhs};
+}
+
+}  // namespace
+
+TEST_CASE("compact_optionals have the size of the value", "[compact_optional]") {
+  STATIC_REQUIRE(sizeof(optional_id_t) == sizeof(user_id_t));
+  STATIC_REQUIRE(sizeof(std::optional<user_id_t>) == 2U * sizeof(user_id_t));
+  STATIC_REQUIRE(sizeof(optional_symbol_t) == sizeof(symbol_t));
+  STATIC_REQUIRE(sizeof(optional_name_t) == sizeof(name_t));
+  STATIC_REQUIRE(sizeof(level_t) == sizeof(int));
+  STATIC_REQUIRE(std::is_trivially_copyable_v<optional_id_t>);
+
+  STATIC_REQUIRE(gw::has_sentinel<user_id_t>);
+  STATIC_REQUIRE(gw::has_sentinel<gw::strong_type<symbol_t, struct symbol_tag>>);
+  STATIC_REQUIRE(!gw::has_sentinel<gw::strong_type<std::uint32_t, struct plain_tag>>);
+  STATIC_REQUIRE(!gw::has_sentinel<int>);
+}
+
+TEST_CASE("compact_optionals are constructed", "[compact_optional]") {
+  STATIC_REQUIRE(!optional_id_t{}.has_value());
+  STATIC_REQUIRE(!optional_id_t{std::nullopt}.has_value());
+  STATIC_REQUIRE(optional_id_t{user_id_t{42U}}.has_value());
+  STATIC_REQUIRE(*optional_id_t{user_id_t{42U}} == user_id_t{42U});
+  STATIC_REQUIRE(optional_id_t{std::optional{user_id_t{1U}}}.value() == user_id_t{1U});
+  STATIC_REQUIRE(!optional_id_t{std::optional<user_id_t>{}});
+
+  REQUIRE_THROWS_AS(optional_id_t{user_id_t{id_tag::sentinel}}, std::invalid_argument);
+  REQUIRE_THROWS_AS(level_t{-1}, std::invalid_argument);
+}
+
+TEST_CASE("compact_optionals are observed", "[compact_optional]") {
+  const auto empty = optional_id_t{};
+  const auto full = optional_id_t{user_id_t{7U}};
+
+  REQUIRE_THROWS_AS(empty.value(), std::bad_optional_access);
+  REQUIRE(full.value() == user_id_t{7U});
+  REQUIRE(empty.value_or(user_id_t{1U}) == user_id_t{1U});
+  REQUIRE(full.value_or(user_id_t{1U}) == user_id_t{7U});
+  REQUIRE(full->value() == 7U);
+  REQUIRE(empty.to_optional() == std::nullopt);
+  REQUIRE(full.to_optional() == std::optional{user_id_t{7U}});
+}
+
+TEST_CASE("compact_optionals are modified", "[compact_optional]") {
+  auto optional = optional_id_t{};
+
+  REQUIRE(optional.emplace(3U) == user_id_t{3U});
+  REQUIRE(optional == user_id_t{3U});
+
+  optional.reset();
+  REQUIRE(optional == std::nullopt);
+
+  optional = user_id_t{5U};
+  auto other = optional_id_t{};
+  optional.swap(other);
+  REQUIRE_FALSE(optional);
+  REQUIRE(other == user_id_t{5U});
+
+  REQUIRE_THROWS_AS(optional.emplace(id_tag::sentinel), std::invalid_argument);
+  REQUIRE_FALSE(optional);
+}
+
+TEST_CASE("compact_optionals are compared and hashed", "[compact_optional]") {
+  STATIC_REQUIRE(optional_id_t{} == optional_id_t{});
+  STATIC_REQUIRE(optional_id_t{} != optional_id_t{user_id_t{1U}});
+  STATIC_REQUIRE(optional_id_t{user_id_t{1U}} == optional_id_t{user_id_t{1U}});
+  STATIC_REQUIRE(optional_id_t{user_id_t{1U}} != optional_id_t{user_id_t{2U}});
+  STATIC_REQUIRE(optional_id_t{} == std::nullopt);
+  STATIC_REQUIRE(optional_id_t{} != user_id_t{1U});
+
+  using hash_t = std::hash<std::optional<user_id_t>>;
+  REQUIRE(std::hash<optional_id_t>{}(optional_id_t{user_id_t{1U}}) == hash_t{}(user_id_t{1U}));
+  REQUIRE(std::hash<optional_id_t>{}(optional_id_t{}) == hash_t{}(std::nullopt));
+}
+
+TEST_CASE("compact_optionals of strings use the terminator", "[compact_optional]") {
+  // Every string, including a full one, is a value
+  const auto full = optional_symbol_t{symbol_t{"ABCDEFG"}};
+  REQUIRE(full.has_value());
+  REQUIRE(full->view() == "ABCDEFG");
+  REQUIRE(optional_symbol_t{symbol_t{}}.has_value());
+  REQUIRE_FALSE(optional_symbol_t{}.has_value());
+
+  const auto name = optional_name_t{name_t{gw::inplace_string<15>{"Alice"}}};
+  REQUIRE(name.has_value());
+  REQUIRE(name->value().view() == "Alice");
+  REQUIRE_FALSE(optional_name_t{}.has_value());
+}
+
+TEST_CASE("compact_optionals of strings hold concatenated and resized strings", "[compact_optional]") {
+  dirty_stack();
+  const auto concatenated = concatenate(gw::inplace_string<3>{"ABC"}, gw::inplace_string<4>{"DE"});
+  REQUIRE(concatenated.has_value());
+  REQUIRE(concatenated->view() == "ABCDE");
+
+  auto resized = symbol_t{"ABC"};
+  resized.resize(7U, 'X');
+  resized.resize(5U);
+  REQUIRE(optional_symbol_t{resized}.has_value());
+  REQUIRE(optional_symbol_t{resized}->view() == "ABCXX");
+
+  auto erased = symbol_t{"ABCDEFG"};
+  erased.erase(1U, 3U);
+  REQUIRE(optional_symbol_t{erased}.has_value());
+  REQUIRE(optional_symbol_t{erased}->view() == "AEFG");
+}
+
+TEST_CASE("compact_optionals fill sparse columns", "[compact_optional]") {
+  auto column = std::vector<optional_id_t>(100U);
+  column[10] = user_id_t{10U};
+  column[90] = user_id_t{90U};
+
+  auto count = 0;
+  for (const auto& cell : column) {
+    count += cell.has_value() ? 1 : 0;
+  }
+  REQUIRE(count == 2);
+  REQUIRE(column.capacity() * sizeof(optional_id_t) == column.capacity() * sizeof(std::uint32_t));
+}
@@ -0,0 +1,274 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/decimal.hpp"
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "gw/arithmetic.hpp"
+#include "gw/concepts.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+using price_t = gw::decimal<std::int64_t, 4, struct usd_tag>;
+using cents_t = gw::decimal<std::int64_t, 2, struct usd_tag>;
+using rate_t = gw::decimal<std::int64_t, 6, struct usd_tag>;
+using euro_t = gw::decimal<std::int64_t, 4, struct eur_tag>;
+using even_t = gw::decimal<std::int32_t, 2, struct even_tag, gw::rounding::half_even>;
+using units_t = gw::decimal<std::uint32_t, 3, struct units_tag>;
+
+struct checked_tag {
+  using arithmetic_policy = gw::checked_arithmetic;
+};
+using checked_t = gw::decimal<std::int32_t, 2, checked_tag>;
+
+struct saturating_tag {
+  using arithmetic_policy = gw::saturating_arithmetic;
+};
+using saturating_t = gw::decimal<std::int32_t, 2, saturating_tag>;
+using counts_t = gw::decimal<std::int32_t, 0, struct count_tag>;
+
+template <typename Lhs, typename Rhs>
+concept multipliable = requires(Lhs lhs, Rhs rhs) { lhs * rhs; };
+
+template <typename Lhs, typename Rhs>
+concept addable = requires(Lhs lhs, Rhs rhs) { lhs + rhs; };
+
+template <typename Decimal>
+auto to_string(const Decimal& decimal) -> std::string {
+  auto buffer = std::array<char, 32>{};
+  const auto result = gw::to_chars(buffer.data(), buffer.data() + buffer.size(), decimal);
+  REQUIRE(result.ec == std::errc{});
+  return std::string{buffer.data(), result.ptr};
+}
+
+template <typename Decimal>
+auto parse(std::string_view text) -> Decimal {
+  auto decimal = Decimal{};
+  const auto result = gw::from_chars(text.data(), text.data() + text.size(), decimal);
+  REQUIRE(result.ec == std::errc{});
+  REQUIRE(result.ptr == text.data() + text.size());
+  return decimal;
+}
+
+}  // namespace
+
+TEST_CASE("decimals are tags", "[decimal]") {
+  STATIC_REQUIRE(gw::decimal_tag<price_t::tag_type>);
+  STATIC_REQUIRE(!gw::decimal_tag<struct test_tag>);
+  STATIC_REQUIRE(sizeof(price_t) == sizeof(std::int64_t));
+  STATIC_REQUIRE(price_t::tag_type::scale == 4);
+  STATIC_REQUIRE(price_t::tag_type::rounding_mode == gw::rounding::half_away_from_zero);
+  STATIC_REQUIRE(!addable<price_t, euro_t>);
+  STATIC_REQUIRE(!multipliable<price_t, euro_t>);
+  STATIC_REQUIRE(multipliable<price_t, cents_t>);
+}
+
+TEST_CASE("decimals are added and compared", "[decimal]") {
+  STATIC_REQUIRE(price_t{12'345} + price_t{5} == price_t{12'350});
+  STATIC_REQUIRE(price_t{12'345} - price_t{45} == price_t{12'300});
+  STATIC_REQUIRE(price_t{1} < price_t{2});
+
+  SECTION("arithmetic policy of the tag") {
+    STATIC_REQUIRE(std::is_same_v<checked_t::arithmetic_policy_type, gw::checked_arithmetic>);
+    REQUIRE_THROWS_AS(checked_t{std::numeric_limits<std::int32_t>::max()} + checked_t{1}, std::overflow_error);
+  }
+}
+
+TEST_CASE("decimals are multiplied and divided", "[decimal]") {
+  SECTION("same scale") {
+    // 1.5000 * 2.2500 = 3.3750
+    STATIC_REQUIRE(price_t{15'000} * price_t{22'500} == price_t{33'750});
+    // 10.0000 / 4.0000 = 2.5000
+    STATIC_REQUIRE(price_t{100'000} / price_t{40'000} == price_t{25'000});
+    // 1.0000 / 3.0000 = 0.3333
+    STATIC_REQUIRE(price_t{10'000} / price_t{30'000} == price_t{3'333});
+    // 2.0000 / 3.0000 = 0.6667
+    STATIC_REQUIRE(price_t{20'000} / price_t{30'000} == price_t{6'667});
+  }
+
+  SECTION("different scales") {
+    // 19.9900 * 0.075000 = 1.499250 -> 1.4993
+    STATIC_REQUIRE(price_t{199'900} * rate_t{75'000} == price_t{14'993});
+    // 1.05 / 0.5000 = 2.10
+    STATIC_REQUIRE(cents_t{105} / price_t{5'000} == cents_t{210});
+  }
+
+  SECTION("integers") {
+    STATIC_REQUIRE(price_t{12'345} * 3 == price_t{37'035});
+    STATIC_REQUIRE(3 * price_t{12'345} == price_t{37'035});
+    STATIC_REQUIRE(cents_t{100} / 3 == cents_t{33});
+    STATIC_REQUIRE(cents_t{-200} / 3 == cents_t{-67});
+  }
+
+  SECTION("compound assignment") {
+    auto price = price_t{10'000};
+    price *= rate_t{1'500'000};
+    REQUIRE(price == price_t{15'000});
+    price /= price_t{30'000};
+    REQUIRE(price == price_t{5'000});
+    price *= 4;
+    REQUIRE(price == price_t{20'000});
+    price /= 8;
+    REQUIRE(price == price_t{2'500});
+  }
+
+  SECTION("wide intermediate products") {
+    // 900000000.0000 * 900000000.0000 does not fit, but 900000000.0000 * 1.0000 does
+    constexpr auto large = price_t{9'000'000'000'000};
+    STATIC_REQUIRE(large * price_t{10'000} == large);
+    STATIC_REQUIRE(large / price_t{10'000} == large);
+    STATIC_REQUIRE(large / large == price_t{10'000});
+  }
+
+  SECTION("unsigned mantissas") {
+    STATIC_REQUIRE(units_t{1'500U} * units_t{1'500U} == units_t{2'250U});
+    STATIC_REQUIRE(units_t{2'000U} / units_t{3'000U} == units_t{667U});
+  }
+
+  SECTION("overflow follows the arithmetic policy") {
+    constexpr auto k_max = std::numeric_limits<std::int32_t>::max();
+    constexpr auto k_min = std::numeric_limits<std::int32_t>::min();
+
+    // 21474836.47 * 2.00 and 21474836.47 / 0.50 do not fit
+    REQUIRE_THROWS_AS(checked_t{k_max} * checked_t{200}, std::overflow_error);
+    REQUIRE_THROWS_AS(checked_t{k_max} / checked_t{50}, std::overflow_error);
+    REQUIRE_THROWS_AS(checked_t{k_max} * 2, std::overflow_error);
+    REQUIRE_THROWS_AS(checked_t{k_min} / -1, std::overflow_error);
+    REQUIRE(checked_t{150} * checked_t{200} == checked_t{300});
+    STATIC_REQUIRE(!noexcept(checked_t{} * checked_t{}));
+    STATIC_REQUIRE(noexcept(cents_t{} * cents_t{}));
+
+    STATIC_REQUIRE(saturating_t{k_max} * saturating_t{200} == saturating_t{k_max});
+    STATIC_REQUIRE(saturating_t{k_max} * saturating_t{-200} == saturating_t{k_min});
+    STATIC_REQUIRE(saturating_t{k_min} / saturating_t{50} == saturating_t{k_min});
+    STATIC_REQUIRE(saturating_t{k_max} * 2 == saturating_t{k_max});
+
+    // Without scale, the product is that of the mantissas, which wraps instead of overflowing
+    STATIC_REQUIRE(counts_t{k_max} * counts_t{2} == counts_t{-2});
+  }
+}
+
+TEST_CASE("decimals are rounded", "[decimal]") {
+  using gw::rounding;
+
+  // 0.25 * 0.10 = 0.025 and -0.25 * 0.10 = -0.025
+  constexpr auto tie = cents_t{25};
+  constexpr auto tenth = cents_t{10};
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::toward_zero>(tie, tenth) == cents_t{2});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::toward_zero>(-tie, tenth) == cents_t{-2});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::downward>(tie, tenth) == cents_t{2});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::downward>(-tie, tenth) == cents_t{-3});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::upward>(tie, tenth) == cents_t{3});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::upward>(-tie, tenth) == cents_t{-2});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::half_away_from_zero>(tie, tenth) == cents_t{3});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::half_away_from_zero>(-tie, tenth) == cents_t{-3});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::half_even>(tie, tenth) == cents_t{2});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::half_even>(-tie, tenth) == cents_t{-2});
+  STATIC_REQUIRE(gw::decimal_multiply<rounding::half_even>(cents_t{35}, tenth) == cents_t{4});
+
+  // 1.00 / -8.00 = -0.125
+  STATIC_REQUIRE(gw::decimal_divide<rounding::downward>(cents_t{100}, cents_t{-800}) == cents_t{-13});
+  STATIC_REQUIRE(gw::decimal_divide<rounding::half_away_from_zero>(cents_t{100}, cents_t{-800}) == cents_t{-13});
+  STATIC_REQUIRE(gw::decimal_divide<rounding::half_even>(cents_t{100}, cents_t{-800}) == cents_t{-12});
+
+  SECTION("rounding mode of the decimal") {
+    STATIC_REQUIRE(even_t{25} * even_t{10} == even_t{2});
+    STATIC_REQUIRE(even_t{35} * even_t{10} == even_t{4});
+  }
+}
+
+TEST_CASE("decimals are converted between scales", "[decimal]") {
+  STATIC_REQUIRE(gw::decimal_cast<price_t>(cents_t{1'234}) == price_t{123'400});
+  STATIC_REQUIRE(gw::decimal_cast<cents_t>(price_t{123'450}) == cents_t{1'235});
+  STATIC_REQUIRE(gw::decimal_cast<cents_t, gw::rounding::toward_zero>(price_t{123'450}) == cents_t{1'234});
+  STATIC_REQUIRE(gw::decimal_cast<cents_t>(price_t{-123'450}) == cents_t{-1'235});
+}
+
+TEST_CASE("decimals are converted to characters", "[decimal]") {
+  REQUIRE(to_string(price_t{123'400}) == "12.3400");
+  REQUIRE(to_string(price_t{-5}) == "-0.0005");
+  REQUIRE(to_string(price_t{0}) == "0.0000");
+  REQUIRE(to_string(gw::decimal<std::int32_t, 0, struct integer_tag>{-42}) == "-42");
+  REQUIRE(to_string(price_t{std::numeric_limits<std::int64_t>::min()}) == "-922337203685477.5808");
+  REQUIRE(to_string(units_t{std::numeric_limits<std::uint32_t>::max()}) == "4294967.295");
+
+  SECTION("small buffers") {
+    auto buffer = std::array<char, 6>{};
+    const auto result = gw::to_chars(buffer.data(), buffer.data() + buffer.size(), price_t{123'400});
+    REQUIRE(result.ec == std::errc::value_too_large);
+  }
+
+  SECTION("format and streams") {
+    REQUIRE(std::format("{}", cents_t{-1'999}) == "-19.99");
+
+    auto stream = std::ostringstream{};
+    stream << price_t{10'001};
+    REQUIRE(stream.str() == "1.0001");
+  }
+}
+
+TEST_CASE("decimals are parsed from characters", "[decimal]") {
+  REQUIRE(parse<price_t>("12.34") == price_t{123'400});
+  REQUIRE(parse<price_t>("-0.0005") == price_t{-5});
+  REQUIRE(parse<price_t>("7") == price_t{70'000});
+  REQUIRE(parse<price_t>("7.") == price_t{70'000});
+  REQUIRE(parse<price_t>(".5") == price_t{5'000});
+  REQUIRE(parse<price_t>("-922337203685477.5808") == price_t{std::numeric_limits<std::int64_t>::min()});
+
+  SECTION("extra decimal places are rounded") {
+    REQUIRE(parse<cents_t>("0.125") == cents_t{13});
+    REQUIRE(parse<cents_t>("-0.125") == cents_t{-13});
+    REQUIRE(parse<cents_t>("0.12499") == cents_t{12});
+    REQUIRE(parse<even_t>("0.125") == even_t{12});
+    REQUIRE(parse<even_t>("0.12501") == even_t{13});
+    REQUIRE(parse<even_t>("0.135") == even_t{14});
+  }
+
+  SECTION("errors") {
+    constexpr auto parse_error = [](std::string_view text) {
+      auto decimal = price_t{42};
+      const auto result = gw::from_chars(text.data(), text.data() + text.size(), decimal);
+      REQUIRE(decimal == price_t{42});
+      return result.ec;
+    };
+    REQUIRE(parse_error("") == std::errc::invalid_argument);
+    REQUIRE(parse_error("-") == std::errc::invalid_argument);
+    REQUIRE(parse_error(".") == std::errc::invalid_argument);
+    REQUIRE(parse_error("abc") == std::errc::invalid_argument);
+    REQUIRE(parse_error("922337203685477.5808") == std::errc::result_out_of_range);
+    REQUIRE(parse_error("99999999999999999999") == std::errc::result_out_of_range);
+
+    auto units = units_t{};
+    const auto text = std::string_view{"-1"};
+    REQUIRE(gw::from_chars(text.data(), text.data() + text.size(), units).ec == std::errc::invalid_argument);
+  }
+
+  SECTION("trailing characters") {
+    auto decimal = price_t{};
+    const auto text = std::string_view{"1.5 USD"};
+    const auto result = gw::from_chars(text.data(), text.data() + text.size(), decimal);
+    REQUIRE(result.ec == std::errc{});
+    REQUIRE(std::string_view{result.ptr} == " USD");
+    REQUIRE(decimal == price_t{15'000});
+  }
+
+  SECTION("streams") {
+    auto stream = std::istringstream{"3.1415 x"};
+    auto decimal = price_t{};
+    REQUIRE(stream >> decimal);
+    REQUIRE(decimal == price_t{31'415});
+    REQUIRE_FALSE(stream >> decimal);
+  }
+}
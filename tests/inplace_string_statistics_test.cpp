@@ -0,0 +1,218 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/inplace_string_statistics.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gw/inplace_string.hpp"
+
+#include "support/allocation.hpp"
+
+namespace {
+
+using namespace std::string_view_literals;
+
+struct event {
+  std::string_view kind;
+  std::size_t capacity;
+  std::size_t value;
+
+  friend auto operator==(const event&, const event&) -> bool = default;
+};
+
+class recording_sink final : public gw::inplace_string_sink {
+ public:
+  void size_scanned(std::size_t capacity, std::size_t length) noexcept override {
+    m_events.push_back({"size_scanned", capacity, length});
+  }
+  void bytes_copied(std::size_t capacity, std::size_t bytes) noexcept override {
+    m_events.push_back({"bytes_copied", capacity, bytes});
+  }
+  void overflowed(std::size_t capacity, std::size_t requested) noexcept override {
+    m_events.push_back({"overflowed", capacity, requested});
+  }
+  void length_reached(std::size_t capacity, std::size_t length) noexcept override {
+    m_events.push_back({"length_reached", capacity, length});
+  }
+
+  [[nodiscard]] auto count(std::string_view kind) const -> std::size_t {
+    return static_cast<std::size_t>(std::ranges::count(m_events, kind, &event::kind));
+  }
+  [[nodiscard]] auto contains(const event& expected) const -> bool {
+    return std::ranges::find(m_events, expected) != m_events.end();
+  }
+  void clear() { m_events.clear(); }
+
+ private:
+  std::vector<event> m_events;
+};
+
+/// \brief Sets a sink for the lifetime of the object.
+class scoped_sink {
+ public:
+  explicit scoped_sink(gw::inplace_string_sink& sink) : m_previous(gw::set_inplace_string_sink(&sink)) {}
+  scoped_sink(const scoped_sink&) = delete;
+  scoped_sink(scoped_sink&&) = delete;
+  auto operator=(const scoped_sink&) -> scoped_sink& = delete;
+  auto operator=(scoped_sink&&) -> scoped_sink& = delete;
+  ~scoped_sink() { gw::set_inplace_string_sink(m_previous); }
+
+ private:
+  gw::inplace_string_sink* m_previous;
+};
+
+}  // namespace
+
+TEST_CASE("inplace_string is instrumented", "[inplace_string_statistics]") {
+  STATIC_REQUIRE(gw::k_inplace_string_instrumentation);
+
+  auto sink = recording_sink{};
+  const auto scope = scoped_sink{sink};
+  REQUIRE(gw::get_inplace_string_sink() == &sink);
+
+  SECTION("size") {
+    const auto str = gw::inplace_string<7>{"abc"sv};
+    sink.clear();
+    REQUIRE(str.size() == 3U);
+    REQUIRE(sink.contains({"size_scanned", 7U, 3U}));
+  }
+
+  SECTION("insert and append") {
+    auto str = gw::inplace_string<15>{"abcd"sv};
+    REQUIRE(sink.contains({"length_reached", 15U, 4U}));
+
+    sink.clear();
+    str.insert(1U, "xy");
+    REQUIRE(sink.contains({"bytes_copied", 15U, 5U}));
+    REQUIRE(sink.contains({"length_reached", 15U, 6U}));
+
+    sink.clear();
+    str.append(gw::inplace_string<3>{"ghi"sv});
+    REQUIRE(sink.contains({"bytes_copied", 15U, 3U}));
+    REQUIRE(sink.contains({"length_reached", 15U, 9U}));
+
+    sink.clear();
+    str += gw::inplace_string<3>{"jk"sv};
+    REQUIRE(sink.contains({"bytes_copied", 15U, 2U}));
+    REQUIRE(sink.contains({"length_reached", 15U, 11U}));
+  }
+
+  SECTION("operator+") {
+    const auto lhs = gw::inplace_string<4>{"ab"sv};
+    const auto rhs = gw::inplace_string<3>{"cde"sv};
+    sink.clear();
+    const auto result = lhs + rhs;
+    REQUIRE(result.view() == "abcde"sv);
+    REQUIRE(sink.contains({"bytes_copied", 7U, 5U}));
+    REQUIRE(sink.contains({"length_reached", 7U, 5U}));
+  }
+
+  SECTION("overflow") {
+    auto str = gw::inplace_string<3>{"abc"sv};
+    sink.clear();
+    REQUIRE_THROWS_AS(str.push_back('d'), std::length_error);
+    REQUIRE(sink.contains({"overflowed", 3U, 4U}));
+    REQUIRE_THROWS_AS(gw::inplace_string<3>{"abcdef"sv}, std::length_error);
+    REQUIRE(sink.contains({"overflowed", 3U, 6U}));
+    REQUIRE(sink.count("length_reached") == 0U);
+  }
+
+  SECTION("constant evaluation") {
+    sink.clear();
+    constexpr auto str = gw::inplace_string<7>{"abc"sv};
+    STATIC_REQUIRE(str.size() == 3U);
+    REQUIRE(sink.count("size_scanned") == 0U);
+  }
+
+  SECTION("no sink") {
+    gw::set_inplace_string_sink(nullptr);
+    auto str = gw::inplace_string<7>{"abc"sv};
+    str.push_back('d');
+    gw::set_inplace_string_sink(&sink);
+    REQUIRE(sink.count("length_reached") == 0U);
+  }
+}
+
+TEST_CASE("inplace_string_statistics aggregates the events", "[inplace_string_statistics]") {
+  const auto suffix = gw::inplace_string<1>{"!"sv};
+  const auto long_suffix = gw::inplace_string<7>{"defghij"sv};
+
+  auto statistics = gw::inplace_string_statistics{};
+  {
+    const auto scope = scoped_sink{statistics};
+    for (const auto text : {"a"sv, "ab"sv, "abc"sv, "abcd"sv}) {
+      auto str = gw::inplace_string<7>{text};
+      str.append(suffix);
+    }
+    auto str = gw::inplace_string<3>{"abc"sv};
+    REQUIRE_THROWS_AS(str.append(long_suffix), std::length_error);
+  }
+
+  REQUIRE(statistics.size_scans() > 0U);
+  REQUIRE(statistics.scanned_characters() > 0U);
+  REQUIRE(statistics.bytes_copied() == 4U);
+  REQUIRE(statistics.overflows() == 1U);
+
+  const auto capacities = statistics.capacities();
+  REQUIRE(capacities.size() == 2U);
+
+  REQUIRE(capacities[0].capacity == 3U);
+  REQUIRE(capacities[0].high_water() == 3U);
+  REQUIRE(capacities[0].overflows == 1U);
+  REQUIRE(capacities[0].max_requested == 10U);
+
+  REQUIRE(capacities[1].capacity == 7U);
+  REQUIRE(capacities[1].high_water() == 5U);
+  REQUIRE(capacities[1].percentile(0.5) == 3U);
+  REQUIRE(capacities[1].percentile(1.0) == 5U);
+  REQUIRE(capacities[1].overflows == 0U);
+  REQUIRE(capacities[1].max_requested == 5U);
+
+  auto ostream = std::ostringstream{};
+  statistics.report(ostream);
+  REQUIRE(ostream.str().find("1 overflows") != std::string::npos);
+  REQUIRE(ostream.str().find("capacity") != std::string::npos);
+
+  statistics.reset();
+  REQUIRE(statistics.overflows() == 0U);
+  REQUIRE(statistics.capacities().empty());
+}
+
+TEST_CASE("inplace_string_statistics records reserved capacities without allocating", "[inplace_string_statistics]") {
+  auto statistics = gw::inplace_string_statistics{};
+  REQUIRE(statistics.reserve(7U));
+  REQUIRE(statistics.reserve(15U));
+  REQUIRE(statistics.capacities().empty());
+
+  GW_ASSERT_NO_ALLOC {
+    statistics.length_reached(7U, 3U);
+    statistics.length_reached(15U, 12U);
+    statistics.overflowed(7U, 9U);
+  }
+
+  auto capacities = statistics.capacities();
+  REQUIRE(capacities.size() == 2U);
+  REQUIRE(capacities[0].capacity == 7U);
+  REQUIRE(capacities[0].high_water() == 3U);
+  REQUIRE(capacities[0].overflows == 1U);
+  REQUIRE(capacities[0].max_requested == 9U);
+  REQUIRE(capacities[1].capacity == 15U);
+  REQUIRE(capacities[1].high_water() == 12U);
+  REQUIRE(statistics.dropped_events() == 0U);
+
+  // The storage is kept by reset
+  statistics.reset();
+  REQUIRE(statistics.capacities().empty());
+  GW_ASSERT_NO_ALLOC { statistics.length_reached(7U, 5U); }
+  capacities = statistics.capacities();
+  REQUIRE(capacities.size() == 1U);
+  REQUIRE(capacities[0].high_water() == 5U);
+}
@@ -4,7 +4,9 @@
 #include "gw/inplace_string.hpp"
 
 #include <algorithm>
+#include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <cstddef>
 #include <cstring>
 #include <format>
 #include <functional>
@@ -13,6 +15,8 @@
 #include <string_view>
 #include <type_traits>
 
+#include "support/allocation.hpp"
+
 namespace gw {
 
 using namespace std::string_view_literals;
@@ -382,6 +386,12 @@ TEST_CASE("inplace_string is erased from", "[inplace_string]") {
     REQUIRE(value == "Hello");
   }
 
+  SECTION("more than the remaining characters") {
+    value.erase(7U, 100U);
+    REQUIRE(value == "Hello, ");
+    REQUIRE(value.size() == 7U);
+  }
+
   SECTION("out of range") {  //
     REQUIRE_THROWS_AS(value.erase(13U), std::out_of_range);
   }
@@ -553,6 +563,27 @@ TEST_CASE("inplace_string is searched for any character", "[inplace_string]") {
   }
 }
 
+TEST_CASE("inplace_string is compared", "[inplace_string]") {
+  constexpr auto value = inplace_string<13U>{"Hello, World!"};
+
+  SECTION("with an inplace_string") {
+    STATIC_REQUIRE(value == inplace_string<13U>{"Hello, World!"});
+    STATIC_REQUIRE(value != inplace_string<13U>{"Hello"});
+    STATIC_REQUIRE(inplace_string<13U>{"Hello"} != value);
+  }
+
+  SECTION("with a string_view") {
+    STATIC_REQUIRE(value == "Hello, World!"sv);
+    STATIC_REQUIRE(value != "Hello"sv);
+    STATIC_REQUIRE(value != "Hello, World!!"sv);
+  }
+
+  SECTION("with a character string") {
+    STATIC_REQUIRE(value != "Hello");
+    STATIC_REQUIRE(inplace_string<13U>{"Hello"} != "Hello, World!");
+  }
+}
+
 TEST_CASE("inplace_string is streamed out", "[inplace_string]") {
   constexpr auto value = inplace_string<13U>{"Hello, World!"};
   auto stream = std::ostringstream{};
@@ -590,4 +621,112 @@ TEST_CASE("inplace_string is formatted", "[inplace_string]") {
   }
 }
 
+TEST_CASE("inplace_string does not allocate", "[inplace_string][allocation]") {
+  constexpr auto k_text = "Hello, World!"sv;
+  auto value = inplace_string<31U>{};
+  auto other = inplace_string<31U>{};
+  auto result = std::size_t{};
+  auto buffer = std::array<char, 32U>{};
+
+  GW_ASSERT_NO_ALLOC {
+    value = inplace_string<31U>{"Hello, World!"};
+    value = inplace_string<31U>{5U, 'X'};
+    value = inplace_string<31U>{k_text.data()};
+    value = inplace_string<31U>{k_text.data(), 5U};
+    value = inplace_string<31U>{k_text.begin(), k_text.end()};
+    value = inplace_string<31U>{k_text};
+    other = value;
+  }
+  REQUIRE(other == k_text);
+
+  GW_ASSERT_NO_ALLOC {
+    result += static_cast<std::size_t>(value.at(0U) + value[1U] + value.front() + value.back());
+    result += value.view().size() + std::strlen(value.data()) + std::strlen(value.c_str());
+    result += static_cast<std::size_t>(std::distance(value.begin(), value.end()) +
+                                       std::distance(value.rbegin(), value.rend()));
+    result += value.size() + value.length() + value.max_size() + value.capacity() + (value.empty() ? 1U : 0U);
+  }
+  REQUIRE(result > 0U);
+
+  GW_ASSERT_NO_ALLOC {
+    value.reserve(16U);
+    value.shrink_to_fit();
+    value.insert(7U, 2U, 'X');
+    value.insert(7U, "YY");
+    value.insert(7U, "ZZZ", 2U);
+    value.insert(value.cbegin(), 'A');
+    value.insert(value.cbegin(), 2U, 'B');
+    value.insert(value.cbegin(), k_text.begin(), std::next(k_text.begin(), 2));
+    value.insert_range(value.cbegin(), "C"sv);
+    value.erase(0U, 6U);
+    value.push_back('!');
+    value.pop_back();
+    value.append(inplace_string<1U>{"!"});
+    value += inplace_string<1U>{"?"};
+    value.resize(13U);
+    value.resize(14U, '.');
+    value.swap(other);
+    other.clear();
+  }
+  REQUIRE(value == k_text);
+  REQUIRE(other.empty());
+
+  GW_ASSERT_NO_ALLOC {
+    const auto concatenated = inplace_string<7U>{"Hello, "} + inplace_string<6U>{"World!"};
+    result = concatenated.size() + value.find(inplace_string<5U>{"World"}) + value.find("World"sv) +
+             value.find("World") + value.find('W') + value.rfind("o"sv) + value.find_first_of("W"sv);
+    result += (value == other ? 1U : 0U) + (value != "Hello"sv ? 1U : 0U) + (value == "Hello, World!" ? 1U : 0U);
+    result += std::hash<inplace_string<31U>>{}(value);
+    result += static_cast<std::size_t>(std::format_to(buffer.data(), "{}", value) - buffer.data());
+  }
+  REQUIRE(result > 0U);
+
+  GW_ASSERT_NO_ALLOC {
+    const auto& const_value = value;
+    result = static_cast<std::size_t>(const_value.at(0U) + const_value[1U] + const_value.front() + const_value.back());
+    result += static_cast<std::string_view>(const_value).size() + std::strlen(const_value.data());
+    result += static_cast<std::size_t>(std::distance(const_value.begin(), const_value.end()) +
+                                       std::distance(value.cbegin(), value.cend()) +
+                                       std::distance(const_value.rbegin(), const_value.rend()) +
+                                       std::distance(value.crbegin(), value.crend()));
+    result += value.find("World", 0U, 5U) + value.rfind(inplace_string<1U>{"o"}) + value.rfind("o") +
+              value.rfind("o", inplace_string<31U>::npos, 1U) + value.rfind('o');
+    result += value.find_first_of(inplace_string<1U>{"W"}) + value.find_first_of("W");
+    result += ("Hello, World!"sv == value ? 1U : 0U) + ("Hello, World!" == value ? 1U : 0U) +
+              (value != other ? 1U : 0U) + ("Hello"sv != value ? 1U : 0U) + (value != "Hello" ? 1U : 0U) +
+              ("Hello" != value ? 1U : 0U);
+    other.insert(0U, inplace_string<5U>{"Hello"});
+    other.erase();
+  }
+  REQUIRE(result > 0U);
+  REQUIRE(other.empty());
+}
+
+namespace {
+
+class counting_sink final : public inplace_string_sink {
+ public:
+  void size_scanned(std::size_t /*capacity*/, std::size_t /*length*/) noexcept override { ++events; }
+  void bytes_copied(std::size_t /*capacity*/, std::size_t /*bytes*/) noexcept override { ++events; }
+  void overflowed(std::size_t /*capacity*/, std::size_t /*requested*/) noexcept override { ++events; }
+  void length_reached(std::size_t /*capacity*/, std::size_t /*length*/) noexcept override { ++events; }
+
+  std::size_t events{};
+};
+
+}  // namespace
+
+TEST_CASE("inplace_string reports to the sink only when instrumented", "[inplace_string]") {
+  auto sink = counting_sink{};
+  auto* const previous = set_inplace_string_sink(&sink);
+
+  auto value = inplace_string<7U>{"Hello"sv};
+  value.append(inplace_string<1U>{"!"});
+  REQUIRE(value.size() == 6U);
+  REQUIRE_THROWS_AS(value.append(inplace_string<2U>{"!!"}), std::length_error);
+
+  REQUIRE(set_inplace_string_sink(previous) == &sink);
+  REQUIRE((sink.events != 0U) == k_inplace_string_instrumentation);
+}
+
 }  // namespace gw
@@ -0,0 +1,83 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+
+import gw.crtp;
+import gw.inplace_string;
+import gw.named_type;
+import gw.strong_type;
+
+namespace {
+
+using namespace std::string_view_literals;
+
+template <typename Derived>
+struct doubler : gw::crtp<doubler, Derived> {
+  [[nodiscard]] constexpr auto doubled() const noexcept -> int { return this->self().value() * 2; }
+};
+
+}  // namespace
+
+TEST_CASE("gw.inplace_string", "[modules]") {
+  auto str = gw::inplace_string<7>{"abc"sv};
+  str.push_back('d');
+  REQUIRE(str.view() == "abcd"sv);
+  REQUIRE(std::hash<gw::inplace_string<7>>{}(str) == std::hash<std::string_view>{}("abcd"sv));
+  REQUIRE(std::format("{}", str) == "abcd");
+
+  auto statistics = gw::inplace_string_statistics{};
+  REQUIRE(statistics.overflows() == 0U);
+
+  STATIC_REQUIRE(std::is_same_v<gw::error_handler, void (*)(gw::error_kind, std::string_view)>);
+  const auto previous = gw::set_error_handler(nullptr);
+  REQUIRE(gw::get_error_handler() == nullptr);
+  gw::set_error_handler(previous);
+}
+
+TEST_CASE("gw.named_type", "[modules]") {
+  using meters_t = gw::named_type<int, "meters">;
+  const auto meters = gw::make_named_type<"meters", int>(42);
+  STATIC_REQUIRE(std::is_same_v<std::remove_cv_t<decltype(meters)>, meters_t>);
+  REQUIRE(meters.value() == 42);
+  REQUIRE(meters == meters_t{42});
+  REQUIRE(std::format("{}", meters) == "42");
+  REQUIRE(gw::type_hash_v<meters_t> != gw::type_hash_v<int>);
+
+  struct length : gw::name_id<"length"> {};
+  STATIC_REQUIRE(gw::named_type<int, gw::name_of<length>>::name() == "length"sv);
+}
+
+TEST_CASE("gw.strong_type", "[modules]") {
+  using amount_t = gw::strong_type<int, struct amount_tag>;
+  REQUIRE((amount_t{1} + amount_t{2}).value() == 3);
+  REQUIRE(std::unordered_set<amount_t>{amount_t{1}, amount_t{1}}.size() == 1U);
+  REQUIRE(std::format("{}", amount_t{42}) == "42");
+
+  using checked_t = gw::strong_type<std::int8_t, struct checked_tag>;
+  STATIC_REQUIRE(gw::arithmetic_policy<gw::checked_arithmetic>);
+  REQUIRE(checked_t{1}.value() == 1);
+  REQUIRE(gw::get_error_handler() == gw::get_error_handler());
+
+  using skills_t = gw::skills::with<gw::skills::addable, gw::skills::comparable, gw::skills::printable>;
+  using skilled_t = gw::strong_type<int, struct skilled_tag, skills_t>;
+  STATIC_REQUIRE(gw::k_has_skill<gw::skills::addable, gw::skills::addable, gw::skills::comparable>);
+  REQUIRE(skilled_t{1} + skilled_t{2} == skilled_t{3});
+  auto ostream = std::ostringstream{};
+  ostream << skilled_t{42};
+  REQUIRE(ostream.str() == "42");
+}
+
+TEST_CASE("gw.crtp", "[modules]") {
+  struct value_t : doubler<value_t> {
+    [[nodiscard]] constexpr auto value() const noexcept -> int { return 21; }
+  };
+  STATIC_REQUIRE(value_t{}.doubled() == 42);
+}
@@ -8,11 +8,14 @@
 #include <compare>
 #include <concepts>
 #include <format>
+#include <functional>
 #include <ranges>
 #include <sstream>
+#include <string_view>
 #include <type_traits>
 
 #include "gw/concepts.hpp"
+#include "gw/hash.hpp"
 
 TEST_CASE("named_types are constructed", "[named_type]") {
   using test_t = gw::named_type<int, "TestType">;
@@ -159,6 +162,13 @@ TEST_CASE("named_types are compared", "[named_type]") {
     STATIC_REQUIRE(noexcept(test_t{} <= test_t{}));
   }
 
+  SECTION("three-way") {
+    using real_t = gw::named_type<double, "TestType">;
+    STATIC_REQUIRE(std::is_same_v<decltype(test_t{1} <=> test_t{2}), std::strong_ordering>);
+    STATIC_REQUIRE(std::is_same_v<decltype(real_t{1.0} <=> real_t{2.0}), std::partial_ordering>);
+    STATIC_REQUIRE((real_t{1.0} <=> real_t{2.0}) == std::partial_ordering::less);
+  }
+
   STATIC_REQUIRE(std::equality_comparable<test_t>);
   STATIC_REQUIRE(std::totally_ordered<test_t>);
   STATIC_REQUIRE(std::three_way_comparable<test_t>);
@@ -430,6 +440,20 @@ TEST_CASE("named_types are hashed", "[named_type]") {
   using test_t = gw::named_type<int, "TestType">;
 
   STATIC_REQUIRE(gw::hashable<test_t>);
+
+  SECTION("name identity is computed at compile time") {  //
+    STATIC_REQUIRE(gw::fnv1a(test_t::name()) == gw::fnv1a("TestType"));
+  }
+
+  SECTION("same values with different names hash differently") {
+    using other_t = gw::named_type<int, "OtherType">;
+    REQUIRE(std::hash<test_t>{}(test_t{1}) != std::hash<other_t>{}(other_t{1}));
+  }
+
+  SECTION("composite keys are hashed") {
+    using other_t = gw::named_type<int, "OtherType">;
+    REQUIRE(gw::hash_tuple(test_t{1}, other_t{2}) != gw::hash_tuple(test_t{2}, other_t{1}));
+  }
 }
 
 TEST_CASE("named_types are streamed", "[named_type]") {
@@ -470,3 +494,38 @@ TEST_CASE("named_types are formatted", "[named_type]") {
     REQUIRE(std::format("{:#}", test_t{1}) == "TestType: 1");
   }
 }
+
+namespace {
+
+struct long_name : gw::name_id<"a_long_descriptive_name_that_is_not_part_of_the_symbols"> {};
+
+struct custom_name {
+  static constexpr auto name() noexcept -> std::string_view { return "CustomName"; }
+};
+
+}  // namespace
+
+TEST_CASE("named_types are named by name types", "[named_type]") {
+  using test_t = gw::named_type<int, gw::name_of<long_name>>;
+  using literal_t = gw::named_type<int, "a_long_descriptive_name_that_is_not_part_of_the_symbols">;
+
+  SECTION("the name argument contains no characters") {
+    STATIC_REQUIRE(gw::name_of<long_name>.max_size() == 0U);
+    STATIC_REQUIRE(sizeof(test_t) == sizeof(int));
+  }
+
+  SECTION("name") {
+    STATIC_REQUIRE(test_t::name() == "a_long_descriptive_name_that_is_not_part_of_the_symbols");
+    STATIC_REQUIRE(gw::named_type<int, gw::name_of<custom_name>>::name() == "CustomName");
+  }
+
+  SECTION("distinct from the type named by the characters") {
+    STATIC_REQUIRE_FALSE(std::is_same_v<test_t, literal_t>);
+    STATIC_REQUIRE(test_t{1} == test_t{1});
+  }
+
+  SECTION("hashed and formatted like the type named by the characters") {
+    REQUIRE(std::hash<test_t>{}(test_t{1}) == std::hash<literal_t>{}(literal_t{1}));
+    REQUIRE(std::format("{:#}", test_t{1}) == std::format("{:#}", literal_t{1}));
+  }
+}
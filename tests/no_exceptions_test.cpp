@@ -0,0 +1,49 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+// Built with exceptions and RTTI disabled, which Catch2 does not support, so this test has its own main. It passes if
+// the error handler is called with the message of the error.
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include "gw/error.hpp"
+#include "gw/named_type.hpp"
+#include "gw/slot_map.hpp"
+#include "gw/strong_type.hpp"
+#include "gw/strong_vector.hpp"
+
+#if !defined(GW_NO_EXCEPTIONS)
+#error "no_exceptions_test must be built with exceptions disabled"
+#endif  // !defined(GW_NO_EXCEPTIONS)
+
+namespace {
+
+[[noreturn]] void exiting_error_handler(gw::error_kind kind, std::string_view message) {
+  std::printf("error %d: %.*s\n", static_cast<int>(kind), static_cast<int>(message.size()), message.data());
+  std::exit(kind == gw::error_kind::out_of_range ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+}  // namespace
+
+auto main() -> int {
+  gw::set_error_handler(exiting_error_handler);
+
+  // The tags are hashed without RTTI
+  using price_t = gw::strong_type<int, struct price_tag>;
+  using name_t = gw::named_type<std::string, "name">;
+  auto prices = std::unordered_set<price_t>{price_t{1}, price_t{2}};
+  auto names = std::unordered_set<name_t>{name_t{"a"}};
+
+  auto orders = gw::slot_map<std::string, struct order_id_tag>{};
+  const auto key = orders.emplace("order");
+  orders.erase(key);
+
+  auto counts = gw::strong_vector<int, struct count_tag>{};
+  static_cast<void>(counts.at(prices.size() + names.size()));
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/packed_record.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "gw/named_type.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+enum class side : std::uint8_t { buy, sell };
+
+using quantity_t = gw::strong_type<std::uint32_t, struct quantity_tag>;
+using venue_t = gw::named_type<std::uint32_t, "venue">;
+using offset_t = gw::strong_type<std::int32_t, struct offset_tag>;
+
+using order_t = gw::packed_record<gw::field<"qty", quantity_t, 20>, gw::field<"venue", venue_t, 12>,
+                                  gw::field<"side", side, 1>, gw::field<"offset", offset_t, 7>>;
+
+using wide_t = gw::packed_record<gw::field<"low", std::uint64_t, 60>, gw::field<"middle", std::uint32_t, 32>,
+                                 gw::field<"flag", bool, 1>, gw::field<"high", std::int64_t, 35>>;
+
+template <typename Record>
+concept has_qty = requires(Record record) { record.template get<"qty">(); };
+
+}  // namespace
+
+TEST_CASE("packed records are laid out", "[packed_record]") {
+  STATIC_REQUIRE(order_t::field_count == 4U);
+  STATIC_REQUIRE(order_t::bit_count == 40U);
+  STATIC_REQUIRE(sizeof(order_t) == sizeof(std::uint64_t));
+  STATIC_REQUIRE(sizeof(gw::packed_record<gw::field<"a", int, 5>, gw::field<"b", int, 3>>) == 1U);
+  STATIC_REQUIRE(sizeof(gw::packed_record<gw::field<"a", int, 20>>) == sizeof(std::uint32_t));
+  STATIC_REQUIRE(sizeof(wide_t) == 2U * sizeof(std::uint64_t));
+  STATIC_REQUIRE(std::is_trivially_copyable_v<order_t>);
+
+  STATIC_REQUIRE(std::is_same_v<order_t::field_type<"qty">, quantity_t>);
+  STATIC_REQUIRE(std::is_same_v<order_t::field_type<"venue">, venue_t>);
+  STATIC_REQUIRE(has_qty<order_t>);
+  STATIC_REQUIRE(!has_qty<wide_t>);
+}
+
+TEST_CASE("packed records keep the types of their fields", "[packed_record]") {
+  constexpr auto order = order_t{quantity_t{1'000'000U}, venue_t{4095U}, side::sell, offset_t{-64}};
+
+  STATIC_REQUIRE(std::is_same_v<decltype(order.get<"qty">()), quantity_t>);
+  STATIC_REQUIRE(order.get<"qty">() == quantity_t{1'000'000U});
+  STATIC_REQUIRE(order.get<"venue">() == venue_t{4095U});
+  STATIC_REQUIRE(order.get<"side">() == side::sell);
+  STATIC_REQUIRE(order.get<"offset">() == offset_t{-64});
+  STATIC_REQUIRE(gw::get<"qty">(order) == quantity_t{1'000'000U});
+
+  STATIC_REQUIRE(order_t{}.get<"qty">() == quantity_t{0U});
+  STATIC_REQUIRE(order_t{}.get<"offset">() == offset_t{0});
+}
+
+TEST_CASE("packed records set fields independently", "[packed_record]") {
+  auto order = order_t{quantity_t{5U}, venue_t{7U}, side::buy, offset_t{3}};
+
+  order.set<"venue">(venue_t{100U});
+  REQUIRE(order.get<"qty">() == quantity_t{5U});
+  REQUIRE(order.get<"venue">() == venue_t{100U});
+  REQUIRE(order.get<"side">() == side::buy);
+  REQUIRE(order.get<"offset">() == offset_t{3});
+
+  order.set<"offset">(offset_t{-1});
+  order.set<"side">(side::sell);
+  REQUIRE(order.get<"venue">() == venue_t{100U});
+  REQUIRE(order.get<"side">() == side::sell);
+  REQUIRE(order.get<"offset">() == offset_t{-1});
+}
+
+TEST_CASE("packed records reject values that do not fit", "[packed_record]") {
+  STATIC_REQUIRE(order_t::fits<"qty">(quantity_t{(1U << 20U) - 1U}));
+  STATIC_REQUIRE(!order_t::fits<"qty">(quantity_t{1U << 20U}));
+  STATIC_REQUIRE(order_t::fits<"offset">(offset_t{63}));
+  STATIC_REQUIRE(order_t::fits<"offset">(offset_t{-64}));
+  STATIC_REQUIRE(!order_t::fits<"offset">(offset_t{64}));
+  STATIC_REQUIRE(!order_t::fits<"offset">(offset_t{-65}));
+
+  auto order = order_t{};
+  REQUIRE_THROWS_AS(order.set<"qty">(quantity_t{1U << 20U}), std::out_of_range);
+  REQUIRE_THROWS_AS(order.set<"offset">(offset_t{64}), std::out_of_range);
+  REQUIRE_THROWS_AS((order_t{quantity_t{}, venue_t{4096U}, side::buy, offset_t{}}), std::out_of_range);
+  REQUIRE(order == order_t{});
+}
+
+TEST_CASE("packed records span two words", "[packed_record]") {
+  auto record = wide_t{};
+  record.set<"low">(0x0FFF'FFFF'FFFF'FFFFULL);
+  record.set<"middle">(0xDEAD'BEEFU);
+  record.set<"flag">(true);
+  record.set<"high">(-(std::int64_t{1} << 34U));
+
+  REQUIRE(record.get<"low">() == 0x0FFF'FFFF'FFFF'FFFFULL);
+  REQUIRE(record.get<"middle">() == 0xDEAD'BEEFU);
+  REQUIRE(record.get<"flag">());
+  REQUIRE(record.get<"high">() == -(std::int64_t{1} << 34U));
+
+  record.set<"middle">(1U);
+  REQUIRE(record.get<"low">() == 0x0FFF'FFFF'FFFF'FFFFULL);
+  REQUIRE(record.get<"middle">() == 1U);
+  REQUIRE(record.get<"flag">());
+}
+
+TEST_CASE("packed records are compared and hashed", "[packed_record]") {
+  constexpr auto lhs = order_t{quantity_t{1U}, venue_t{2U}, side::buy, offset_t{3}};
+  constexpr auto rhs = order_t{quantity_t{1U}, venue_t{2U}, side::buy, offset_t{-3}};
+
+  STATIC_REQUIRE(lhs == lhs);
+  STATIC_REQUIRE(lhs != rhs);
+  REQUIRE(std::hash<order_t>{}(lhs) == std::hash<order_t>{}(lhs));
+  REQUIRE(std::hash<order_t>{}(lhs) != std::hash<order_t>{}(rhs));
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/sharded_counter.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "gw/arithmetic.hpp"
+#include "gw/atomic_strong_type.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+using requests_t = gw::strong_type<std::uint64_t, struct requests_tag>;
+
+struct saturating_tag {
+  using arithmetic_policy = gw::saturating_arithmetic;
+};
+using saturating_t = gw::strong_type<std::uint8_t, saturating_tag>;
+
+}  // namespace
+
+TEST_CASE("sharded_counters are constructed", "[sharded_counter]") {
+  using test_t = gw::sharded_counter<requests_t>;
+
+  STATIC_REQUIRE(std::is_same_v<test_t::value_type, requests_t>);
+  STATIC_REQUIRE(test_t::sharding == gw::shard_by::cpu);
+  STATIC_REQUIRE(alignof(test_t::shard_type) == gw::k_cache_line_size);
+  STATIC_REQUIRE(!std::is_copy_constructible_v<test_t>);
+
+  SECTION("default shard count") {
+    const auto counter = test_t{};
+    REQUIRE(counter.shard_count() >= std::thread::hardware_concurrency());
+    REQUIRE(counter.load() == requests_t{0U});
+  }
+
+  SECTION("shard count is rounded up to a power of two") {
+    REQUIRE(test_t{5U}.shard_count() == 8U);
+    REQUIRE(test_t{0U}.shard_count() == 1U);
+  }
+}
+
+TEST_CASE("sharded_counters are incremented", "[sharded_counter]") {
+  auto counter = gw::sharded_counter<requests_t, gw::shard_by::thread>{4U};
+
+  ++counter;
+  counter += requests_t{2U};
+  counter.add(requests_t{3U});
+  REQUIRE(counter.load() == requests_t{6U});
+  REQUIRE(static_cast<requests_t>(counter) == requests_t{6U});
+
+  counter.reset();
+  REQUIRE(counter.load() == requests_t{0U});
+}
+
+TEST_CASE("sharded_counters are incremented concurrently", "[sharded_counter]") {
+  constexpr auto k_threads = 8U;
+  constexpr auto k_increments = 10'000U;
+
+  auto test = [](auto& counter) {
+    {
+      auto threads = std::vector<std::jthread>{};
+      for (auto thread = 0U; thread < k_threads; ++thread) {
+        threads.emplace_back([&counter] {
+          for (auto increment = 0U; increment < k_increments; ++increment) {
+            ++counter;
+          }
+        });
+      }
+    }
+    return counter.load();
+  };
+
+  SECTION("shard_by::cpu") {
+    auto counter = gw::sharded_counter<requests_t, gw::shard_by::cpu>{};
+    REQUIRE(test(counter) == requests_t{k_threads * k_increments});
+  }
+
+  SECTION("shard_by::thread") {
+    auto counter = gw::sharded_counter<requests_t, gw::shard_by::thread>{2U};
+    REQUIRE(test(counter) == requests_t{k_threads * k_increments});
+  }
+}
+
+TEST_CASE("sharded_counters follow the arithmetic policy of their tag", "[sharded_counter]") {
+  auto counter = gw::sharded_counter<saturating_t, gw::shard_by::thread>{1U};
+
+  counter += saturating_t{std::uint8_t{200}};
+  counter += saturating_t{std::uint8_t{200}};
+  REQUIRE(counter.load() == saturating_t{std::numeric_limits<std::uint8_t>::max()});
+}
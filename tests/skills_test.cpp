@@ -0,0 +1,295 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/skills.hpp"
+
+#include <array>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "gw/arithmetic.hpp"
+#include "gw/concepts.hpp"
+#include "gw/crtp.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+template <typename T>
+concept has_plus = requires(T lhs, T rhs) { lhs + rhs; };
+
+template <typename T>
+concept has_plus_assign = requires(T lhs, T rhs) { lhs += rhs; };
+
+template <typename T>
+concept has_minus = requires(T lhs, T rhs) { lhs - rhs; };
+
+template <typename T>
+concept has_multiplies = requires(T lhs, T rhs) { lhs * rhs; };
+
+template <typename T>
+concept has_modulus = requires(T lhs, T rhs) { lhs % rhs; };
+
+template <typename T>
+concept has_negate = requires(T value) { -value; };
+
+template <typename T>
+concept has_increment = requires(T value) { ++value; };
+
+template <typename T>
+concept has_bit_and = requires(T lhs, T rhs) { lhs & rhs; };
+
+template <typename T>
+concept has_less = requires(T lhs, T rhs) { lhs < rhs; };
+
+template <typename T>
+concept has_three_way = requires(T lhs, T rhs) { lhs <=> rhs; };
+
+template <typename T>
+concept has_batch_add = requires(std::span<T> lhs, std::span<const T> rhs) { gw::batch_add(lhs, rhs); };
+
+template <typename T>
+concept has_batch_multiply = requires(std::span<T> lhs, std::span<const T> rhs) { gw::batch_multiply(lhs, rhs); };
+
+struct checked_tag {
+  using arithmetic_policy = gw::checked_arithmetic;
+};
+
+/// \brief A custom skill, which calls the member functions of its own object.
+template <typename Derived>
+struct doublable : gw::crtp<doublable, Derived> {
+  [[nodiscard]] constexpr auto doubled() const noexcept -> Derived { return Derived{this->self().value() * 2}; }
+};
+
+}  // namespace
+
+TEST_CASE("strong_types have the operators of their skills only", "[skills]") {
+  using amount_t = gw::strong_type<int, struct amount_tag,
+                                   gw::skills::with<gw::skills::addable, gw::skills::comparable, gw::skills::hashable,
+                                                    gw::skills::printable>>;
+  using id_type = gw::strong_type<std::uint32_t, struct id_tag,
+                                  gw::skills::with<gw::skills::equality_comparable, gw::skills::hashable>>;
+
+  SECTION("layout") {
+    STATIC_REQUIRE(sizeof(amount_t) == sizeof(int));
+    STATIC_REQUIRE(sizeof(id_type) == sizeof(std::uint32_t));
+    STATIC_REQUIRE(std::is_standard_layout_v<amount_t>);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<amount_t>);
+  }
+
+  SECTION("requested operators") {
+    STATIC_REQUIRE(has_plus<amount_t>);
+    STATIC_REQUIRE(has_plus_assign<amount_t>);
+    STATIC_REQUIRE(has_less<amount_t>);
+    STATIC_REQUIRE(has_three_way<amount_t>);
+    STATIC_REQUIRE(std::equality_comparable<id_type>);
+    STATIC_REQUIRE(gw::hashable<amount_t>);
+    STATIC_REQUIRE(gw::hashable<id_type>);
+    STATIC_REQUIRE(gw::ostreamable<amount_t>);
+  }
+
+  SECTION("operators that are not requested") {
+    STATIC_REQUIRE_FALSE(has_minus<amount_t>);
+    STATIC_REQUIRE_FALSE(has_multiplies<amount_t>);
+    STATIC_REQUIRE_FALSE(has_modulus<amount_t>);
+    STATIC_REQUIRE_FALSE(has_negate<amount_t>);
+    STATIC_REQUIRE_FALSE(has_increment<amount_t>);
+    STATIC_REQUIRE_FALSE(has_bit_and<amount_t>);
+    STATIC_REQUIRE_FALSE(has_plus<id_type>);
+    STATIC_REQUIRE_FALSE(has_less<id_type>);
+    STATIC_REQUIRE_FALSE(has_three_way<id_type>);
+    STATIC_REQUIRE_FALSE(gw::ostreamable<id_type>);
+    using addable_t = gw::strong_type<int, struct addable_tag, gw::skills::with<gw::skills::addable>>;
+    STATIC_REQUIRE_FALSE(std::equality_comparable<addable_t>);
+    STATIC_REQUIRE_FALSE(gw::hashable<addable_t>);
+
+    using bare_t = gw::strong_type<int, struct bare_tag, gw::skills::with<>>;
+    STATIC_REQUIRE_FALSE(std::equality_comparable<bare_t>);
+    STATIC_REQUIRE_FALSE(has_plus<bare_t>);
+    STATIC_REQUIRE(sizeof(bare_t) == sizeof(int));
+  }
+
+  SECTION("strong_types without skills keep all operators") {
+    using plain_t = gw::strong_type<int, struct plain_tag>;
+    STATIC_REQUIRE(has_minus<plain_t>);
+    STATIC_REQUIRE(has_negate<plain_t>);
+    STATIC_REQUIRE(gw::hashable<plain_t>);
+  }
+}
+
+TEMPLATE_TEST_CASE("strong_types with and without skills have the same accessors", "[skills]",
+                   (gw::strong_type<int, struct accessor_tag>),
+                   (gw::strong_type<int, struct accessor_tag, gw::skills::with<gw::skills::addable>>)) {
+  using lvalue_t = TestType&;
+  using const_lvalue_t = const TestType&;
+  using rvalue_t = TestType&&;
+  using const_rvalue_t = const TestType&&;
+
+  STATIC_REQUIRE(std::is_same_v<decltype(*std::declval<lvalue_t>()), int&>);
+  STATIC_REQUIRE(std::is_same_v<decltype(*std::declval<const_lvalue_t>()), const int&>);
+  STATIC_REQUIRE(std::is_same_v<decltype(*std::declval<rvalue_t>()), int&&>);
+  STATIC_REQUIRE(std::is_same_v<decltype(*std::declval<const_rvalue_t>()), const int&&>);
+
+  STATIC_REQUIRE(std::is_same_v<decltype(std::declval<lvalue_t>().value()), int&>);
+  STATIC_REQUIRE(std::is_same_v<decltype(std::declval<const_lvalue_t>().value()), const int&>);
+  STATIC_REQUIRE(std::is_same_v<decltype(std::declval<rvalue_t>().value()), int&&>);
+  STATIC_REQUIRE(std::is_same_v<decltype(std::declval<const_rvalue_t>().value()), const int&&>);
+
+  STATIC_REQUIRE(std::is_same_v<decltype(static_cast<int&>(std::declval<lvalue_t>())), int&>);
+  STATIC_REQUIRE(std::is_same_v<decltype(static_cast<const int&>(std::declval<const_lvalue_t>())), const int&>);
+  STATIC_REQUIRE(std::is_same_v<decltype(static_cast<int&&>(std::declval<rvalue_t>())), int&&>);
+  STATIC_REQUIRE(std::is_same_v<decltype(static_cast<const int&&>(std::declval<const_rvalue_t>())), const int&&>);
+
+  const auto increment = [](auto&& value) { return value + 1; };
+  auto value = TestType{1};
+  const auto const_value = TestType{2};
+  REQUIRE(value.transform(increment).value() == 2);
+  REQUIRE(const_value.transform(increment).value() == 3);
+  REQUIRE(std::move(value).transform(increment).value() == 2);
+  REQUIRE(std::move(const_value).transform(increment).value() == 3);  // NOLINT(*-move-const-arg)
+}
+
+TEST_CASE("skills operate on the contained values", "[skills]") {
+  SECTION("comparable") {
+    using test_t = gw::strong_type<int, struct test_tag, gw::skills::with<gw::skills::comparable>>;
+    STATIC_REQUIRE(test_t{1} == test_t{1});
+    STATIC_REQUIRE(test_t{1} != test_t{2});
+    STATIC_REQUIRE(test_t{1} < test_t{2});
+    STATIC_REQUIRE(test_t{2} >= test_t{1});
+    STATIC_REQUIRE((test_t{1} <=> test_t{2}) == std::strong_ordering::less);
+  }
+
+  SECTION("incrementable and decrementable") {
+    using test_t =
+        gw::strong_type<int, struct test_tag, gw::skills::with<gw::skills::incrementable, gw::skills::decrementable>>;
+    auto value = test_t{1};
+    REQUIRE((++value).value() == 2);
+    REQUIRE((value++).value() == 2);
+    REQUIRE((--value).value() == 2);
+    REQUIRE((value--).value() == 2);
+    REQUIRE(value.value() == 1);
+  }
+
+  SECTION("arithmetic") {
+    using skills_t = gw::skills::with<gw::skills::negatable, gw::skills::addable, gw::skills::subtractable,
+                                      gw::skills::multipliable, gw::skills::dividable, gw::skills::modulable>;
+    using test_t = gw::strong_type<int, struct test_tag, skills_t>;
+    STATIC_REQUIRE((test_t{2} + test_t{3}).value() == 5);
+    STATIC_REQUIRE((test_t{2} - test_t{3}).value() == -1);
+    STATIC_REQUIRE((test_t{2} * test_t{3}).value() == 6);
+    STATIC_REQUIRE((test_t{7} / test_t{2}).value() == 3);
+    STATIC_REQUIRE((test_t{7} % test_t{2}).value() == 1);
+    STATIC_REQUIRE((-test_t{2}).value() == -2);
+    STATIC_REQUIRE((+test_t{2}).value() == 2);
+    STATIC_REQUIRE(std::same_as<decltype(test_t{2} + test_t{3}), test_t>);
+    STATIC_REQUIRE(noexcept(test_t{2} + test_t{3}));
+
+    auto value = test_t{2};
+    value += test_t{3};
+    value -= test_t{1};
+    value *= test_t{3};
+    value /= test_t{2};
+    value %= test_t{4};
+    REQUIRE(value.value() == 2);
+  }
+
+  SECTION("arithmetic policy") {
+    using test_t = gw::strong_type<int, checked_tag, gw::skills::with<gw::skills::addable>>;
+    STATIC_REQUIRE_FALSE(noexcept(test_t{2} + test_t{3}));
+    REQUIRE_THROWS_AS(test_t{std::numeric_limits<int>::max()} + test_t{1}, std::overflow_error);
+    auto value = test_t{std::numeric_limits<int>::max()};
+    REQUIRE_THROWS_AS(value += test_t{1}, std::overflow_error);
+  }
+
+  SECTION("bitwise") {
+    using test_t = gw::strong_type<std::uint32_t, struct test_tag, gw::skills::with<gw::skills::bitwise>>;
+    STATIC_REQUIRE((test_t{0b1100U} & test_t{0b1010U}).value() == 0b1000U);
+    STATIC_REQUIRE((test_t{0b1100U} | test_t{0b1010U}).value() == 0b1110U);
+    STATIC_REQUIRE((test_t{0b1100U} ^ test_t{0b1010U}).value() == 0b0110U);
+    STATIC_REQUIRE((test_t{0b0001U} << test_t{2U}).value() == 0b0100U);
+    STATIC_REQUIRE((test_t{0b0100U} >> test_t{2U}).value() == 0b0001U);
+    STATIC_REQUIRE((~test_t{0x0000'FFFFU}).value() == 0xFFFF'0000U);
+
+    auto value = test_t{0b1100U};
+    value &= test_t{0b0100U};
+    value |= test_t{0b0001U};
+    value ^= test_t{0b0101U};
+    value <<= test_t{1U};
+    value >>= test_t{1U};
+    REQUIRE(value.value() == 0U);
+  }
+
+  SECTION("hashable") {
+    using skills_t = gw::skills::with<gw::skills::equality_comparable, gw::skills::hashable>;
+    using test_t = gw::strong_type<int, struct test_tag, skills_t>;
+    using other_t = gw::strong_type<int, struct other_tag, skills_t>;
+    REQUIRE(std::hash<test_t>{}(test_t{1}) == std::hash<test_t>{}(test_t{1}));
+    REQUIRE(std::hash<test_t>{}(test_t{1}) != std::hash<other_t>{}(other_t{1}));
+
+    auto set = std::unordered_set<test_t>{test_t{1}, test_t{2}, test_t{1}};
+    REQUIRE(set.size() == 2U);
+  }
+
+  SECTION("printable") {
+    using test_t = gw::strong_type<int, struct test_tag, gw::skills::with<gw::skills::printable>>;
+    auto ostream = std::ostringstream{};
+    ostream << test_t{42};
+    REQUIRE(ostream.str() == "42");
+    REQUIRE(std::format("{}", test_t{42}) == "42");
+  }
+
+  SECTION("ranges") {
+    using test_t =
+        gw::strong_type<std::vector<int>, struct test_tag, gw::skills::with<gw::skills::equality_comparable>>;
+    auto value = test_t{std::vector{1, 2, 3}};
+    REQUIRE(value.size() == 3U);
+    REQUIRE(value == test_t{std::vector{1, 2, 3}});
+  }
+
+  SECTION("custom skills") {
+    using test_t = gw::strong_type<int, struct test_tag, gw::skills::with<doublable, gw::skills::comparable>>;
+    STATIC_REQUIRE(sizeof(test_t) == sizeof(int));
+    STATIC_REQUIRE(test_t{21}.doubled() == test_t{42});
+    STATIC_REQUIRE(test_t{1} < test_t{2});
+  }
+}
+
+TEST_CASE("spans of strong_types with skills", "[skills]") {
+  using skills_t = gw::skills::with<gw::skills::addable, gw::skills::equality_comparable>;
+  using test_t = gw::strong_type<int, struct test_tag, skills_t>;
+
+  SECTION("as_underlying and as_strong") {
+    auto values = std::array{test_t{1}, test_t{2}, test_t{3}};
+    auto underlying = gw::as_underlying(std::span{values});
+    STATIC_REQUIRE(std::is_same_v<decltype(underlying), std::span<int, 3>>);
+    underlying[1] = 5;
+    REQUIRE(values[1] == test_t{5});
+
+    auto raw = std::array{1, 2, 3};
+    auto strong = gw::as_strong<struct test_tag, skills_t>(std::span{raw});
+    STATIC_REQUIRE(std::is_same_v<decltype(strong), std::span<test_t, 3>>);
+    strong[2] += test_t{4};
+    REQUIRE(raw[2] == 7);
+  }
+
+  SECTION("batch operations of the skills") {
+    STATIC_REQUIRE(has_batch_add<test_t>);
+    STATIC_REQUIRE_FALSE(has_batch_multiply<test_t>);
+
+    auto values = std::array{test_t{1}, test_t{2}, test_t{3}};
+    gw::batch_add(std::span{values}, std::array{test_t{1}, test_t{1}, test_t{1}});
+    REQUIRE(values == std::array{test_t{2}, test_t{3}, test_t{4}});
+  }
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/slot_map.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "gw/strong_type.hpp"
+
+namespace {
+
+using orders_t = gw::slot_map<std::string, struct order_id_tag>;
+using order_key_t = orders_t::key_type;
+
+}  // namespace
+
+TEST_CASE("slot_maps are constructed", "[slot_map]") {
+  STATIC_REQUIRE(std::is_same_v<orders_t::index_type, gw::strong_type<std::uint32_t, order_id_tag>>);
+  STATIC_REQUIRE(std::is_same_v<order_key_t, gw::slot_key<order_id_tag>>);
+
+  const auto orders = orders_t{};
+  REQUIRE(orders.empty());
+  REQUIRE(orders.size() == 0U);  // NOLINT(readability-container-size-empty)
+  REQUIRE_FALSE(orders.contains(order_key_t{}));
+}
+
+TEST_CASE("slot_maps are inserted into and looked up", "[slot_map]") {
+  auto orders = orders_t{};
+
+  const auto first = orders.insert("first");
+  const auto second = orders.emplace(3U, 'x');
+
+  REQUIRE(orders.size() == 2U);
+  REQUIRE(first != second);
+  REQUIRE(orders.contains(first));
+  REQUIRE(orders[first] == "first");
+  REQUIRE(orders.at(second) == "xxx");
+  REQUIRE(*orders.find(second) == "xxx");
+
+  orders[first] = "changed";
+  REQUIRE(orders.at(first) == "changed");
+}
+
+TEST_CASE("slot_maps detect stale keys", "[slot_map]") {
+  auto orders = orders_t{};
+
+  const auto first = orders.insert("first");
+  REQUIRE(orders.erase(first));
+  REQUIRE_FALSE(orders.contains(first));
+  REQUIRE_FALSE(orders.erase(first));
+  REQUIRE(orders.find(first) == nullptr);
+  REQUIRE_THROWS_AS(orders.at(first), std::out_of_range);
+
+  SECTION("reused slot") {
+    const auto second = orders.insert("second");
+    REQUIRE(second.index() == first.index());
+    REQUIRE(second.generation() != first.generation());
+    REQUIRE_FALSE(orders.contains(first));
+    REQUIRE(orders.at(second) == "second");
+  }
+
+  SECTION("forged key to a free slot") {
+    REQUIRE_FALSE(orders.contains(order_key_t{first.index(), first.generation() + 1U}));
+  }
+
+  SECTION("cleared") {
+    const auto second = orders.insert("second");
+    const auto third = orders.insert("third");
+    orders.clear();
+    REQUIRE(orders.empty());
+    REQUIRE_FALSE(orders.contains(second));
+    REQUIRE_FALSE(orders.contains(third));
+  }
+}
+
+TEST_CASE("slot_maps store their elements densely", "[slot_map]") {
+  auto orders = orders_t{};
+  auto keys = std::vector<order_key_t>{};
+  for (const auto* name : {"a", "b", "c", "d", "e"}) {
+    keys.push_back(orders.insert(name));
+  }
+
+  REQUIRE(orders.erase(keys[1]));
+  REQUIRE(orders.erase(keys[3]));
+
+  REQUIRE(orders.size() == 3U);
+  REQUIRE(orders.values().size() == 3U);
+  REQUIRE(std::distance(orders.begin(), orders.end()) == 3);
+
+  auto values = std::vector<std::string>(orders.begin(), orders.end());
+  std::ranges::sort(values);
+  REQUIRE(values == std::vector<std::string>{"a", "c", "e"});
+
+  for (auto position = 0U; position < orders.size(); ++position) {
+    const auto key = orders.key_at(position);
+    REQUIRE(&orders[key] == &orders.values()[position]);
+  }
+
+  REQUIRE(orders.at(keys[0]) == "a");
+  REQUIRE(orders.at(keys[2]) == "c");
+  REQUIRE(orders.at(keys[4]) == "e");
+}
+
+TEST_CASE("slot_keys are hashed", "[slot_map]") {
+  auto orders = orders_t{};
+  auto keys = std::unordered_set<order_key_t>{};
+  for (auto index = 0U; index < 100U; ++index) {
+    const auto key = orders.insert(std::to_string(index));
+    keys.insert(key);
+    if (index % 2U == 0U) {
+      orders.erase(key);
+    }
+  }
+  REQUIRE(keys.size() == 100U);
+  REQUIRE(std::hash<order_key_t>{}(order_key_t{}) != std::hash<order_key_t>{}(*keys.begin()));
+}
@@ -0,0 +1,158 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/strong_bitset.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using permissions_t = gw::strong_bitset<130, struct permission_tag>;
+using features_t = gw::strong_bitset<130, struct feature_tag>;
+using entitlements_t = gw::dynamic_strong_bitset<struct entitlement_tag>;
+
+template <typename Lhs, typename Rhs>
+concept combinable = requires(Lhs lhs, Rhs rhs) { lhs &= rhs; };
+
+template <typename Bitset>
+auto positions(const Bitset& bitset) -> std::vector<std::size_t> {
+  auto result = std::vector<std::size_t>{};
+  for (const auto pos : bitset.set_bits()) {
+    result.push_back(pos);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST_CASE("strong_bitsets are constructed", "[strong_bitset]") {
+  STATIC_REQUIRE(std::is_same_v<permissions_t::tag_type, permission_tag>);
+  STATIC_REQUIRE(permissions_t::size() == 130U);
+  STATIC_REQUIRE(sizeof(permissions_t) == 3U * sizeof(std::uint64_t));
+  STATIC_REQUIRE(std::forward_iterator<gw::set_bit_iterator>);
+
+  constexpr auto bitset = permissions_t{};
+  STATIC_REQUIRE(bitset.none());
+  STATIC_REQUIRE(bitset.count() == 0U);
+  STATIC_REQUIRE(bitset.find_first() == permissions_t::npos);
+}
+
+TEST_CASE("strong_bitsets with different tags do not mix", "[strong_bitset]") {
+  STATIC_REQUIRE(combinable<permissions_t&, permissions_t>);
+  STATIC_REQUIRE(!combinable<permissions_t&, features_t>);
+  STATIC_REQUIRE(!combinable<entitlements_t&, gw::dynamic_strong_bitset<struct feature_tag>>);
+}
+
+TEST_CASE("strong_bitsets are modified", "[strong_bitset]") {
+  auto bitset = permissions_t{};
+
+  bitset.set(0U).set(64U).set(129U);
+  REQUIRE(bitset.test(0U));
+  REQUIRE(bitset[64U]);
+  REQUIRE(bitset.count() == 3U);
+
+  bitset.reset(64U).flip(1U);
+  REQUIRE_FALSE(bitset.test(64U));
+  REQUIRE(bitset.test(1U));
+
+  bitset.set(2U, false);
+  REQUIRE_FALSE(bitset.test(2U));
+
+  REQUIRE_THROWS_AS(bitset.test(130U), std::out_of_range);
+  REQUIRE_THROWS_AS(bitset.set(130U), std::out_of_range);
+  REQUIRE_THROWS_AS(bitset.flip(130U), std::out_of_range);
+
+  // The bits past size() stay zero
+  bitset.set();
+  REQUIRE(bitset.all());
+  REQUIRE(bitset.count() == 130U);
+  bitset.flip();
+  REQUIRE(bitset.none());
+  REQUIRE((~bitset).count() == 130U);
+}
+
+TEST_CASE("strong_bitsets are combined", "[strong_bitset]") {
+  auto lhs = permissions_t{};
+  auto rhs = permissions_t{};
+  lhs.set(1U).set(70U).set(100U);
+  rhs.set(70U).set(100U).set(129U);
+
+  REQUIRE(positions(lhs & rhs) == std::vector<std::size_t>{70U, 100U});
+  REQUIRE(positions(lhs | rhs) == std::vector<std::size_t>{1U, 70U, 100U, 129U});
+  REQUIRE(positions(lhs ^ rhs) == std::vector<std::size_t>{1U, 129U});
+  REQUIRE(positions(and_not(lhs, rhs)) == std::vector<std::size_t>{1U});
+
+  REQUIRE(lhs.intersects(rhs));
+  REQUIRE_FALSE(lhs.is_subset_of(rhs));
+  REQUIRE((lhs & rhs).is_subset_of(rhs));
+  REQUIRE_FALSE(and_not(lhs, rhs).intersects(rhs));
+
+  REQUIRE((lhs | rhs) == (rhs | lhs));
+  REQUIRE(lhs != rhs);
+}
+
+TEST_CASE("strong_bitsets find set bits", "[strong_bitset]") {
+  auto bitset = permissions_t{};
+  bitset.set(3U).set(63U).set(64U).set(129U);
+
+  REQUIRE(bitset.find_first() == 3U);
+  REQUIRE(bitset.find_next(3U) == 63U);
+  REQUIRE(bitset.find_next(63U) == 64U);
+  REQUIRE(bitset.find_next(64U) == 129U);
+  REQUIRE(bitset.find_next(129U) == permissions_t::npos);
+  REQUIRE(bitset.find_next(permissions_t::npos) == permissions_t::npos);
+  REQUIRE(bitset.find_next(bitset.size()) == permissions_t::npos);
+  REQUIRE(positions(bitset) == std::vector<std::size_t>{3U, 63U, 64U, 129U});
+  REQUIRE(positions(permissions_t{}).empty());
+}
+
+TEST_CASE("dynamic_strong_bitsets are constructed", "[strong_bitset]") {
+  REQUIRE(entitlements_t{}.empty());
+
+  const auto bitset = entitlements_t{1'000U, true};
+  REQUIRE(bitset.size() == 1'000U);
+  REQUIRE(bitset.all());
+  REQUIRE(bitset.count() == 1'000U);
+  REQUIRE(bitset.words().size() == 16U);
+}
+
+TEST_CASE("dynamic_strong_bitsets are resized", "[strong_bitset]") {
+  auto bitset = entitlements_t{10U, true};
+
+  bitset.resize(100U);
+  REQUIRE(bitset.count() == 10U);
+
+  bitset.resize(200U, true);
+  REQUIRE(bitset.count() == 110U);
+  REQUIRE_FALSE(bitset.test(99U));
+  REQUIRE(bitset.test(100U));
+
+  bitset.resize(5U);
+  REQUIRE(bitset.all());
+  REQUIRE(bitset.count() == 5U);
+}
+
+TEST_CASE("dynamic_strong_bitsets are combined", "[strong_bitset]") {
+  auto lhs = entitlements_t{1'000U};
+  auto rhs = entitlements_t{1'000U};
+  lhs.set(10U).set(500U).set(999U);
+  rhs.set(500U).set(999U);
+
+  REQUIRE(positions(lhs & rhs) == std::vector<std::size_t>{500U, 999U});
+  REQUIRE(positions(lhs ^ rhs) == std::vector<std::size_t>{10U});
+  REQUIRE(positions(and_not(lhs, rhs)) == std::vector<std::size_t>{10U});
+  REQUIRE((lhs | rhs) == lhs);
+  REQUIRE(rhs.is_subset_of(lhs));
+  REQUIRE(lhs.find_next(10U) == 500U);
+  REQUIRE(lhs.find_next(entitlements_t::npos) == entitlements_t::npos);
+
+  const auto other = entitlements_t{999U};
+  REQUIRE_THROWS_AS(lhs &= other, std::invalid_argument);
+  REQUIRE_THROWS_AS(lhs.intersects(other), std::invalid_argument);
+  REQUIRE_THROWS_AS(lhs.reset(other), std::invalid_argument);
+}
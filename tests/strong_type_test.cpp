@@ -3,16 +3,26 @@
 
 #include "gw/strong_type.hpp"
 
+#include <algorithm>
 #include <array>
 #include <catch2/catch_test_macros.hpp>
 #include <compare>
 #include <concepts>
+#include <cstdint>
 #include <format>
+#include <functional>
+#include <limits>
 #include <ranges>
+#include <span>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
 #include <type_traits>
 
+#include "gw/arithmetic.hpp"
 #include "gw/concepts.hpp"
+#include "gw/hash.hpp"
 
 TEST_CASE("strong_types are constructed", "[strong_type]") {
   using tag_t = struct test_tag;
@@ -156,6 +166,13 @@ TEST_CASE("strong_types are compared", "[strong_type]") {
     STATIC_REQUIRE(noexcept(test_t{} <= test_t{}));
   }
 
+  SECTION("three-way") {
+    using real_t = gw::strong_type<double, struct test_tag>;
+    STATIC_REQUIRE(std::is_same_v<decltype(test_t{1} <=> test_t{2}), std::strong_ordering>);
+    STATIC_REQUIRE(std::is_same_v<decltype(real_t{1.0} <=> real_t{2.0}), std::partial_ordering>);
+    STATIC_REQUIRE((real_t{1.0} <=> real_t{2.0}) == std::partial_ordering::less);
+  }
+
   STATIC_REQUIRE(std::equality_comparable<test_t>);
   STATIC_REQUIRE(std::totally_ordered<test_t>);
   STATIC_REQUIRE(std::three_way_comparable<test_t>);
@@ -218,6 +235,12 @@ TEST_CASE("strong_types are added and subtracted", "[strong_type]") {
     STATIC_REQUIRE(test_t{1} - test_t{1} == test_t{0});
     STATIC_REQUIRE(noexcept(test_t{} - test_t{}));
   }
+
+  SECTION("strong_type + strong_type without -") {
+    using name_t = gw::strong_type<std::string, struct name_tag>;
+    REQUIRE(name_t{"foo"} + name_t{"bar"} == name_t{"foobar"});
+    STATIC_REQUIRE(!noexcept(name_t{} + name_t{}));
+  }
 }
 
 TEST_CASE("strong_types are multiplied and divided", "[strong_type]") {
@@ -265,6 +288,13 @@ TEST_CASE("strong_types are added and subtracted with assignment", "[strong_type
     auto value = test_t{1};
     STATIC_REQUIRE(noexcept(value -= test_t{1}));
   }
+
+  SECTION("strong_type += strong_type without -=") {
+    using name_t = gw::strong_type<std::string, struct name_tag>;
+    auto value = name_t{"foo"};
+    value += name_t{"bar"};
+    REQUIRE(value == name_t{"foobar"});
+  }
 }
 
 TEST_CASE("strong_types are multiplied and divided with assignment", "[strong_type]") {
@@ -293,6 +323,138 @@ TEST_CASE("strong_types are multiplied and divided with assignment", "[strong_ty
   }
 }
 
+TEST_CASE("strong_types follow the arithmetic policy of their tag", "[strong_type]") {
+  SECTION("unchecked") {
+    using test_t = gw::strong_type<int, struct test_tag>;
+
+    STATIC_REQUIRE(std::same_as<test_t::arithmetic_policy_type, gw::unchecked_arithmetic>);
+    STATIC_REQUIRE(std::same_as<test_t::arithmetic_result_type, test_t>);
+  }
+
+  SECTION("saturating") {
+    struct saturating_tag {
+      using arithmetic_policy = gw::saturating_arithmetic;
+    };
+    using test_t = gw::strong_type<std::int32_t, saturating_tag>;
+    constexpr auto k_max = std::numeric_limits<std::int32_t>::max();
+    constexpr auto k_min = std::numeric_limits<std::int32_t>::min();
+
+    STATIC_REQUIRE(test_t{k_max} + test_t{1} == test_t{k_max});
+    STATIC_REQUIRE(test_t{k_min} + test_t{-1} == test_t{k_min});
+    STATIC_REQUIRE(test_t{k_min} - test_t{1} == test_t{k_min});
+    STATIC_REQUIRE(test_t{k_max} - test_t{-1} == test_t{k_max});
+    STATIC_REQUIRE(test_t{k_max} * test_t{2} == test_t{k_max});
+    STATIC_REQUIRE(test_t{k_max} * test_t{-2} == test_t{k_min});
+    STATIC_REQUIRE(test_t{k_min} / test_t{-1} == test_t{k_max});
+    STATIC_REQUIRE(test_t{2} + test_t{3} == test_t{5});
+    STATIC_REQUIRE(noexcept(test_t{} + test_t{}));
+
+    auto value = test_t{k_max - 1};
+    value += test_t{2};
+    REQUIRE(value == test_t{k_max});
+
+    using unsigned_t = gw::strong_type<std::uint32_t, saturating_tag>;
+    STATIC_REQUIRE(unsigned_t{1U} - unsigned_t{2U} == unsigned_t{0U});
+    STATIC_REQUIRE(unsigned_t{~0U} + unsigned_t{1U} == unsigned_t{~0U});
+  }
+
+  SECTION("wrapping") {
+    struct wrapping_tag {
+      using arithmetic_policy = gw::wrapping_arithmetic;
+    };
+    using test_t = gw::strong_type<std::int32_t, wrapping_tag>;
+    constexpr auto k_max = std::numeric_limits<std::int32_t>::max();
+    constexpr auto k_min = std::numeric_limits<std::int32_t>::min();
+
+    STATIC_REQUIRE(test_t{k_max} + test_t{1} == test_t{k_min});
+    STATIC_REQUIRE(test_t{k_min} - test_t{1} == test_t{k_max});
+    STATIC_REQUIRE(test_t{k_min} / test_t{-1} == test_t{k_min});
+  }
+
+  SECTION("checked") {
+    struct checked_tag {
+      using arithmetic_policy = gw::checked_arithmetic;
+    };
+    using test_t = gw::strong_type<std::int32_t, checked_tag>;
+    constexpr auto k_max = std::numeric_limits<std::int32_t>::max();
+
+    STATIC_REQUIRE(test_t{2} * test_t{3} == test_t{6});
+    STATIC_REQUIRE_FALSE(noexcept(test_t{} + test_t{}));
+    REQUIRE_THROWS_AS(test_t{k_max} + test_t{1}, std::overflow_error);
+
+    auto value = test_t{k_max};
+    REQUIRE_THROWS_AS(value *= test_t{2}, std::overflow_error);
+    REQUIRE(value == test_t{k_max});
+  }
+
+#if defined(__cpp_lib_expected)
+  SECTION("expected") {
+    struct expected_tag {
+      using arithmetic_policy = gw::expected_arithmetic;
+    };
+    using test_t = gw::strong_type<std::int32_t, expected_tag>;
+    constexpr auto k_max = std::numeric_limits<std::int32_t>::max();
+
+    STATIC_REQUIRE(std::same_as<test_t::arithmetic_result_type, std::expected<test_t, std::errc>>);
+    REQUIRE(test_t{1} + test_t{2} == test_t{3});
+    REQUIRE((test_t{k_max} + test_t{1}).error() == std::errc::result_out_of_range);
+  }
+#endif  // defined(__cpp_lib_expected)
+}
+
+TEST_CASE("strong_type spans are operated in batch", "[strong_type]") {
+  constexpr auto k_max = std::numeric_limits<std::int32_t>::max();
+
+  SECTION("saturating") {
+    auto lhs = std::array{1, k_max, -k_max, 4};
+    const auto rhs = std::array{2, 1, -2, -4};
+    gw::batch_add<gw::saturating_arithmetic>(std::span{lhs}, rhs);
+    REQUIRE(lhs == std::array{3, k_max, -k_max - 1, 0});
+
+    gw::batch_subtract<gw::saturating_arithmetic>(std::span{lhs}, rhs);
+    REQUIRE(lhs == std::array{1, k_max - 1, -k_max + 1, 4});
+
+    gw::batch_multiply<gw::saturating_arithmetic>(std::span{lhs}, rhs);
+    REQUIRE(lhs == std::array{2, k_max - 1, k_max, -16});
+  }
+
+  SECTION("checked") {
+    auto lhs = std::array{1U, ~0U, 3U};
+    const auto rhs = std::array{1U, 1U, 1U};
+    REQUIRE_THROWS_AS(gw::batch_add<gw::checked_arithmetic>(std::span{lhs}, rhs), std::overflow_error);
+    REQUIRE(lhs == std::array{2U, 0U, 4U});
+  }
+
+#if defined(__cpp_lib_expected)
+  SECTION("expected") {
+    auto lhs = std::array{1, k_max};
+    const auto rhs = std::array{1, 1};
+    REQUIRE(gw::batch_add<gw::expected_arithmetic>(std::span{lhs}, rhs).error() == std::errc::result_out_of_range);
+    REQUIRE(lhs == std::array{2, -k_max - 1});
+    REQUIRE(gw::batch_add<gw::expected_arithmetic>(std::span{lhs}, rhs).has_value());
+  }
+#endif  // defined(__cpp_lib_expected)
+
+  SECTION("size mismatch") {
+    auto lhs = std::array{1, 2, 3};
+    const auto rhs = std::array{1, 2};
+    REQUIRE_THROWS_AS(gw::batch_add<gw::wrapping_arithmetic>(std::span{lhs}, rhs), std::invalid_argument);
+  }
+
+  SECTION("strong_type") {
+    struct counter_tag {
+      using arithmetic_policy = gw::saturating_arithmetic;
+    };
+    using counter_t = gw::strong_type<std::uint16_t, counter_tag>;
+
+    auto counters = std::array{counter_t{std::uint16_t{1}}, counter_t{std::uint16_t{65535}}};
+    const auto increments = std::array{counter_t{std::uint16_t{2}}, counter_t{std::uint16_t{2}}};
+    gw::batch_add(std::span{counters}, increments);
+    REQUIRE(counters[0] == counter_t{std::uint16_t{3}});
+    REQUIRE(counters[1] == counter_t{std::uint16_t{65535}});
+  }
+}
+
 TEST_CASE("strong_types are bitwise operated", "[strong_type]") {
   using test_t = gw::strong_type<unsigned int, struct test_tag>;
 
@@ -409,11 +571,84 @@ TEST_CASE("strong_types are viewable ranges", "[strong_type]") {
   STATIC_REQUIRE(std::ranges::viewable_range<test_t>);
 }
 
+TEST_CASE("strong_type spans are reinterpreted", "[strong_type]") {
+  using test_t = gw::strong_type<double, struct test_tag>;
+
+  STATIC_REQUIRE(sizeof(test_t) == sizeof(double));
+  STATIC_REQUIRE(alignof(test_t) == alignof(double));
+  STATIC_REQUIRE(std::is_standard_layout_v<test_t>);
+
+  SECTION("as_underlying") {
+    auto values = std::array{test_t{1.0}, test_t{2.0}, test_t{3.0}};
+    auto underlying = gw::as_underlying(std::span{values});
+    STATIC_REQUIRE(std::is_same_v<decltype(underlying), std::span<double, 3>>);
+    REQUIRE(underlying.data() == &values[0].value());
+    underlying[1] = 4.0;
+    REQUIRE(values[1] == test_t{4.0});
+
+    const auto& const_values = values;
+    STATIC_REQUIRE(std::is_same_v<decltype(gw::as_underlying(std::span{const_values})), std::span<const double, 3>>);
+  }
+
+  SECTION("as_strong") {
+    auto values = std::array{1.0, 2.0, 3.0};
+    auto strong = gw::as_strong<test_tag>(std::span{values});
+    STATIC_REQUIRE(std::is_same_v<decltype(strong), std::span<test_t, 3>>);
+    REQUIRE(&strong[0].value() == values.data());
+    strong[2] += test_t{1.0};
+    REQUIRE(values[2] == 4.0);
+
+    const auto& const_values = values;
+    STATIC_REQUIRE(
+        std::is_same_v<decltype(gw::as_strong<test_tag>(std::span{const_values})), std::span<const test_t, 3>>);
+  }
+}
+
 TEST_CASE("strong_types are hashed", "[strong_type]") {
   struct test_tag {};
   using test_t = gw::strong_type<int, test_tag>;
 
   STATIC_REQUIRE(gw::hashable<test_t>);
+
+  SECTION("tag identity is computed at compile time") {
+    struct other_tag {};
+    STATIC_REQUIRE(gw::type_hash_v<test_tag> == gw::fnv1a(gw::type_name<test_tag>()));
+    STATIC_REQUIRE(gw::type_hash_v<test_tag> != gw::type_hash_v<other_tag>);
+  }
+
+  SECTION("tag identity of named tags is portable") {
+    struct strong_type_named_tag {
+      static constexpr auto name() noexcept { return "TestType"; }
+    };
+    STATIC_REQUIRE(gw::type_hash_v<strong_type_named_tag> == gw::fnv1a("TestType"));
+  }
+
+  SECTION("incomplete tags are hashable") {  //
+    STATIC_REQUIRE(gw::hashable<gw::strong_type<int, struct incomplete_tag>>);
+  }
+
+  SECTION("same values with different tags hash differently") {
+    using other_t = gw::strong_type<int, struct other_tag>;
+    REQUIRE(std::hash<test_t>{}(test_t{1}) != std::hash<other_t>{}(other_t{1}));
+  }
+
+  SECTION("sequential values spread over the low bits") {
+    constexpr auto k_buckets = std::size_t{1024};
+    auto used = std::array<bool, k_buckets>{};
+    for (auto i = 0; i < static_cast<int>(k_buckets); ++i) {
+      used.at(std::hash<test_t>{}(test_t{i}) & (k_buckets - 1U)) = true;
+    }
+    REQUIRE(std::ranges::count(used, true) > static_cast<std::ptrdiff_t>(k_buckets / 2U));
+  }
+
+  SECTION("composite keys are hashed") {
+    using other_t = gw::strong_type<int, struct other_tag>;
+    const auto key = gw::hash_tuple(test_t{1}, other_t{2});
+    const auto seed = gw::hash_combine(0U, std::hash<test_t>{}(test_t{1}));
+    REQUIRE(key == gw::hash_combine(seed, std::hash<other_t>{}(other_t{2})));
+    REQUIRE(key == gw::hash_tuple(std::tuple{test_t{1}, other_t{2}}));
+    REQUIRE(key != gw::hash_tuple(test_t{2}, other_t{1}));
+  }
 }
 
 TEST_CASE("strong_types are streamed", "[strong_type]") {
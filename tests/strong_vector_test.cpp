@@ -0,0 +1,234 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/strong_vector.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "gw/arithmetic.hpp"
+#include "gw/decimal.hpp"
+#include "gw/strong_type.hpp"
+#include "gw/unit.hpp"
+
+namespace {
+
+using notional_t = gw::strong_type<double, struct notional_tag>;
+using notionals_t = gw::strong_vector<double, notional_tag>;
+using count_t = gw::strong_type<int, struct count_tag>;
+using counts_t = gw::strong_vector<int, count_tag>;
+
+using cents_t = gw::decimal<std::int64_t, 2, struct usd_tag>;
+using amounts_t = gw::strong_vector<std::int64_t, cents_t::tag_type>;
+using meters_t = gw::quantity<double, gw::meter>;
+using distances_t = gw::strong_vector<double, gw::meter>;
+
+template <typename Lhs, typename Rhs>
+concept multipliable = requires(Lhs lhs, Rhs rhs) { lhs * rhs; };
+
+template <typename Lhs, typename Rhs>
+concept dividable = requires(Lhs lhs, Rhs rhs) { lhs / rhs; };
+
+template <typename Lhs, typename Rhs>
+concept multiply_assignable = requires(Lhs lhs, Rhs rhs) { lhs *= rhs; };
+
+template <typename Lhs, typename Rhs>
+concept divide_assignable = requires(Lhs lhs, Rhs rhs) { lhs /= rhs; };
+
+template <typename Lhs, typename Rhs>
+concept dottable = requires(Lhs lhs, Rhs rhs) { lhs.dot(rhs); };
+
+auto make_counts(int count) -> counts_t {
+  auto values = std::vector<int>(static_cast<std::size_t>(count));
+  std::iota(values.begin(), values.end(), 1);
+  return counts_t{std::move(values)};
+}
+
+}  // namespace
+
+TEST_CASE("strong_vectors are constructed", "[strong_vector]") {
+  SECTION("public types") {
+    STATIC_REQUIRE(std::is_same_v<notionals_t::value_type, notional_t>);
+    STATIC_REQUIRE(std::is_same_v<notionals_t::underlying_type, double>);
+    STATIC_REQUIRE(std::is_same_v<notionals_t::tag_type, notional_tag>);
+  }
+
+  SECTION("default constructed") { REQUIRE(notionals_t{}.empty()); }
+
+  SECTION("constructed with count") { REQUIRE(notionals_t(3U).size() == 3U); }
+
+  SECTION("constructed with count and value") {
+    const auto values = notionals_t(2U, notional_t{1.5});
+    REQUIRE(values[0] == notional_t{1.5});
+    REQUIRE(values[1] == notional_t{1.5});
+  }
+
+  SECTION("constructed from initializer list") {
+    const auto values = notionals_t{notional_t{1.0}, notional_t{2.0}};
+    REQUIRE(values.size() == 2U);
+    REQUIRE(values.back() == notional_t{2.0});
+  }
+}
+
+TEST_CASE("strong_vector elements are accessed", "[strong_vector]") {
+  auto values = notionals_t{notional_t{1.0}, notional_t{2.0}, notional_t{3.0}};
+
+  REQUIRE(values.front() == notional_t{1.0});
+  REQUIRE(values.at(1U) == notional_t{2.0});
+  REQUIRE_THROWS_AS(values.at(3U), std::out_of_range);
+  REQUIRE(values.underlying()[2] == 3.0);
+  REQUIRE(&values.underlying()[0] == &values.front().value());
+
+  values.push_back(notional_t{4.0});
+  values.emplace_back(5.0);
+  REQUIRE(values.size() == 5U);
+  REQUIRE(values.back() == notional_t{5.0});
+
+  values.pop_back();
+  REQUIRE(values.size() == 4U);
+
+  auto sum = notional_t{};
+  for (const auto& value : values) {
+    sum += value;
+  }
+  REQUIRE(sum == notional_t{10.0});
+}
+
+TEST_CASE("strong_vectors are combined element-wise", "[strong_vector]") {
+  const auto lhs = notionals_t{notional_t{4.0}, notional_t{6.0}};
+  const auto rhs = notionals_t{notional_t{2.0}, notional_t{3.0}};
+
+  REQUIRE(lhs + rhs == notionals_t{notional_t{6.0}, notional_t{9.0}});
+  REQUIRE(lhs - rhs == notionals_t{notional_t{2.0}, notional_t{3.0}});
+  REQUIRE(lhs * rhs == notionals_t{notional_t{8.0}, notional_t{18.0}});
+  REQUIRE(lhs / rhs == notionals_t{notional_t{2.0}, notional_t{2.0}});
+  REQUIRE_THROWS_AS(lhs + notionals_t(3U), std::invalid_argument);
+
+  STATIC_REQUIRE(std::is_same_v<decltype(lhs + rhs), notionals_t>);
+}
+
+TEST_CASE("strong_vectors of units are not multiplied element-wise", "[strong_vector]") {
+  const auto distances = distances_t{meters_t{1.0}, meters_t{2.0}};
+
+  REQUIRE(distances + distances == distances_t{meters_t{2.0}, meters_t{4.0}});
+  REQUIRE(distances * 2.0 == distances_t{meters_t{2.0}, meters_t{4.0}});
+  REQUIRE(distances.sum() == meters_t{3.0});
+
+  // The product of two lengths is an area, which a vector of gw::meter cannot hold
+  STATIC_REQUIRE(!multipliable<distances_t, distances_t>);
+  STATIC_REQUIRE(!dividable<distances_t, distances_t>);
+  STATIC_REQUIRE(!multiply_assignable<distances_t&, const distances_t&>);
+  STATIC_REQUIRE(!divide_assignable<distances_t&, const distances_t&>);
+  STATIC_REQUIRE(!dottable<distances_t, distances_t>);
+  STATIC_REQUIRE(multipliable<notionals_t, notionals_t>);
+  STATIC_REQUIRE(dottable<notionals_t, notionals_t>);
+}
+
+TEST_CASE("strong_vectors of decimals are not multiplied element-wise", "[strong_vector]") {
+  const auto amounts = amounts_t{cents_t{150}, cents_t{200}};
+
+  REQUIRE(amounts + amounts == amounts_t{cents_t{300}, cents_t{400}});
+  REQUIRE(amounts * 2 == amounts_t{cents_t{300}, cents_t{400}});
+  REQUIRE(amounts.sum() == cents_t{350});
+
+  // 1.50 * 2.00 is 3.00, which the element-wise product of the mantissas would make 300.00
+  STATIC_REQUIRE(cents_t{150} * cents_t{200} == cents_t{300});
+  STATIC_REQUIRE(!multipliable<amounts_t, amounts_t>);
+  STATIC_REQUIRE(!dividable<amounts_t, amounts_t>);
+  STATIC_REQUIRE(!multiply_assignable<amounts_t&, const amounts_t&>);
+  STATIC_REQUIRE(!divide_assignable<amounts_t&, const amounts_t&>);
+  STATIC_REQUIRE(!dottable<amounts_t, amounts_t>);
+
+  // 1.50 / 4 rounds to 0.38, which the element-wise quotient of the mantissas would truncate to 0.37
+  STATIC_REQUIRE(cents_t{150} / 4 == cents_t{38});
+  STATIC_REQUIRE(!dividable<amounts_t, std::int64_t>);
+  STATIC_REQUIRE(!divide_assignable<amounts_t&, std::int64_t>);
+}
+
+TEST_CASE("strong_vectors follow the arithmetic policy of their tag", "[strong_vector]") {
+  constexpr auto k_max = std::numeric_limits<std::int32_t>::max();
+
+  SECTION("checked") {
+    struct checked_tag {
+      using arithmetic_policy = gw::checked_arithmetic;
+    };
+    using checked_t = gw::strong_type<std::int32_t, checked_tag>;
+    using checked_vector_t = gw::strong_vector<std::int32_t, checked_tag>;
+    const auto values = checked_vector_t{checked_t{k_max}, checked_t{1}};
+    const auto ones = checked_vector_t{checked_t{1}, checked_t{1}};
+
+    REQUIRE_THROWS_AS(values + ones, std::overflow_error);
+    REQUIRE_THROWS_AS(values * 2, std::overflow_error);
+    REQUIRE(ones + ones == checked_vector_t{checked_t{2}, checked_t{2}});
+    STATIC_REQUIRE(!noexcept(std::declval<checked_vector_t&>() *= 2));
+  }
+
+  SECTION("saturating") {
+    struct saturating_tag {
+      using arithmetic_policy = gw::saturating_arithmetic;
+    };
+    using saturating_t = gw::strong_type<std::int32_t, saturating_tag>;
+    using saturating_vector_t = gw::strong_vector<std::int32_t, saturating_tag>;
+    const auto values = saturating_vector_t{saturating_t{k_max}, saturating_t{1}};
+    const auto ones = saturating_vector_t{saturating_t{1}, saturating_t{1}};
+
+    REQUIRE(values + ones == saturating_vector_t{saturating_t{k_max}, saturating_t{2}});
+    REQUIRE(values * 2 == saturating_vector_t{saturating_t{k_max}, saturating_t{2}});
+    STATIC_REQUIRE(noexcept(std::declval<saturating_vector_t&>() *= 2));
+  }
+}
+
+TEST_CASE("strong_vectors are scaled", "[strong_vector]") {
+  const auto values = notionals_t{notional_t{1.0}, notional_t{2.0}};
+
+  REQUIRE(values * 2.0 == notionals_t{notional_t{2.0}, notional_t{4.0}});
+  REQUIRE(2.0 * values == notionals_t{notional_t{2.0}, notional_t{4.0}});
+  REQUIRE(values / 2.0 == notionals_t{notional_t{0.5}, notional_t{1.0}});
+}
+
+TEST_CASE("strong_vectors are reduced", "[strong_vector]") {
+  const auto counts = make_counts(100);
+
+  REQUIRE(counts.sum() == count_t{5050});
+  REQUIRE(counts.min() == count_t{1});
+  REQUIRE(counts.max() == count_t{100});
+  REQUIRE(counts.dot(counts) == count_t{338350});
+  REQUIRE_THROWS_AS(counts.dot(make_counts(3)), std::invalid_argument);
+
+  STATIC_REQUIRE(std::is_same_v<decltype(counts.sum()), count_t>);
+
+  SECTION("fewer elements than lanes") {
+    const auto few = make_counts(3);
+    REQUIRE(few.sum() == count_t{6});
+    REQUIRE(few.min() == count_t{1});
+    REQUIRE(few.max() == count_t{3});
+  }
+}
+
+TEST_CASE("strong_vectors are prefix summed", "[strong_vector]") {
+  const auto prefix = make_counts(4).prefix_sum();
+
+  REQUIRE(prefix == counts_t{count_t{1}, count_t{3}, count_t{6}, count_t{10}});
+}
+
+TEST_CASE("strong_vectors are compared element-wise", "[strong_vector]") {
+  const auto lhs = counts_t{count_t{1}, count_t{2}, count_t{3}};
+  const auto rhs = counts_t{count_t{3}, count_t{2}, count_t{1}};
+  using mask_t = counts_t::mask_type;
+
+  REQUIRE(lhs.equal_to(rhs) == mask_t{0, 1, 0});
+  REQUIRE(lhs.not_equal_to(rhs) == mask_t{1, 0, 1});
+  REQUIRE(lhs.less(rhs) == mask_t{1, 0, 0});
+  REQUIRE(lhs.less_equal(rhs) == mask_t{1, 1, 0});
+  REQUIRE(lhs.greater(rhs) == mask_t{0, 0, 1});
+  REQUIRE(lhs.greater_equal(rhs) == mask_t{0, 1, 1});
+  REQUIRE(lhs.greater(count_t{1}) == mask_t{0, 1, 1});
+  REQUIRE(lhs.equal_to(count_t{2}) == mask_t{0, 1, 0});
+  REQUIRE_THROWS_AS(lhs.less(make_counts(2)), std::invalid_argument);
+}
@@ -0,0 +1,110 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "support/allocation.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local std::size_t t_allocations{};    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::size_t t_deallocations{};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+auto allocate(std::size_t size) noexcept -> void* {
+  ++t_allocations;
+  return std::malloc(size == 0U ? 1U : size);  // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+}
+
+auto allocate(std::size_t size, std::align_val_t alignment) noexcept -> void* {
+  ++t_allocations;
+  const auto align = static_cast<std::size_t>(alignment);
+  const auto rounded = (size + align - 1U) / align * align;
+#if defined(_MSC_VER)
+  return _aligned_malloc(rounded == 0U ? align : rounded, align);
+#else
+  return std::aligned_alloc(align, rounded == 0U ? align : rounded);
+#endif  // defined(_MSC_VER)
+}
+
+void deallocate(void* pointer) noexcept {
+  if (pointer != nullptr) {
+    ++t_deallocations;
+  }
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+}
+
+void deallocate(void* pointer, std::align_val_t /*alignment*/) noexcept {
+  if (pointer != nullptr) {
+    ++t_deallocations;
+  }
+#if defined(_MSC_VER)
+  _aligned_free(pointer);
+#else
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+#endif  // defined(_MSC_VER)
+}
+
+auto checked(void* pointer) -> void* {
+  if (pointer == nullptr) {
+    throw std::bad_alloc{};
+  }
+  return pointer;
+}
+
+}  // namespace
+
+namespace gw::test {
+
+auto allocation_count() noexcept -> std::size_t { return t_allocations; }
+
+auto deallocation_count() noexcept -> std::size_t { return t_deallocations; }
+
+}  // namespace gw::test
+
+//
+// Replaceable allocation functions
+//
+
+// NOLINTBEGIN(cert-dcl54-cpp,hicpp-new-delete-operators,misc-new-delete-overloads)
+auto operator new(std::size_t size) -> void* { return checked(allocate(size)); }
+auto operator new[](std::size_t size) -> void* { return checked(allocate(size)); }
+auto operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept -> void* { return allocate(size); }
+auto operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept -> void* { return allocate(size); }
+auto operator new(std::size_t size, std::align_val_t alignment) -> void* { return checked(allocate(size, alignment)); }
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void* {
+  return checked(allocate(size, alignment));
+}
+auto operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept -> void* {
+  return allocate(size, alignment);
+}
+auto operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept -> void* {
+  return allocate(size, alignment);
+}
+
+//
+// Replaceable deallocation functions
+//
+
+void operator delete(void* pointer) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::size_t /*size*/) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::size_t /*size*/) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, const std::nothrow_t& /*tag*/) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t& /*tag*/) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::align_val_t alignment) noexcept { deallocate(pointer, alignment); }
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept { deallocate(pointer, alignment); }
+void operator delete(void* pointer, std::size_t /*size*/, std::align_val_t alignment) noexcept {
+  deallocate(pointer, alignment);
+}
+void operator delete[](void* pointer, std::size_t /*size*/, std::align_val_t alignment) noexcept {
+  deallocate(pointer, alignment);
+}
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(pointer, alignment);
+}
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(pointer, alignment);
+}
+// NOLINTEND(cert-dcl54-cpp,hicpp-new-delete-operators,misc-new-delete-overloads)
@@ -0,0 +1,58 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+
+/// \brief GW test support namespace
+namespace gw::test {
+
+//
+// Allocation counting
+//
+
+/// \brief Return the number of allocations made by the calling thread through the global `operator new`.
+/// \details The test support library replaces all global allocation functions with counting versions, so every test
+/// that links it counts its allocations.
+[[nodiscard]] auto allocation_count() noexcept -> std::size_t;
+
+/// \brief Return the number of deallocations made by the calling thread through the global `operator delete`.
+[[nodiscard]] auto deallocation_count() noexcept -> std::size_t;
+
+/// \brief The scope of a GW_ASSERT_NO_ALLOC block.
+/// \details The block runs once; when it is left, the number of allocations it made is checked to be zero.
+class no_alloc_scope {
+ public:
+  /// \brief constructs the scope of the block at `file`:`line`
+  constexpr no_alloc_scope(const char* file, std::size_t line) noexcept : m_file(file), m_line(line) {}
+
+  /// \brief starts the block on the first call, and checks it on the second call
+  /// \return True if the block is to be run.
+  auto next() -> bool {
+    if (!m_started) {
+      m_started = true;
+      m_allocations = allocation_count();
+      return true;
+    }
+    const auto allocations = allocation_count() - m_allocations;
+    INFO("GW_ASSERT_NO_ALLOC block at " << m_file << ':' << m_line);
+    REQUIRE(allocations == 0U);
+    return false;
+  }
+
+ private:
+  const char* m_file;
+  std::size_t m_line;
+  std::size_t m_allocations{};
+  bool m_started{};
+};
+
+}  // namespace gw::test
+
+/// \brief Require that the following block does not allocate through the global `operator new`.
+/// \details Use as `GW_ASSERT_NO_ALLOC { ... }`. Assertions inside the block may allocate themselves, so they belong
+/// after it, and the block must not be left with `break`.
+#define GW_ASSERT_NO_ALLOC /* NOLINT(cppcoreguidelines-macro-usage) */                              \
+  for (auto gw_no_alloc_scope = ::gw::test::no_alloc_scope{__FILE__, __LINE__}; gw_no_alloc_scope.next();)
@@ -0,0 +1,38 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include <format>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "gw/error.hpp"
+
+namespace {
+
+// With GW_NO_EXCEPTIONS, gw calls the error handler instead of throwing. The tests run in both configurations, so this
+// handler throws the exception that gw throws without GW_NO_EXCEPTIONS, and the same checks apply to both.
+[[noreturn]] void throwing_error_handler(gw::error_kind kind, std::string_view message) {
+  const auto what = std::string{message};
+  switch (kind) {
+    case gw::error_kind::bad_optional_access:
+      throw std::bad_optional_access{};
+    case gw::error_kind::format_error:
+      throw std::format_error{what};
+    case gw::error_kind::invalid_argument:
+      throw std::invalid_argument{what};
+    case gw::error_kind::length_error:
+      throw std::length_error{what};
+    case gw::error_kind::out_of_range:
+      throw std::out_of_range{what};
+    case gw::error_kind::overflow_error:
+      throw std::overflow_error{what};
+  }
+  throw std::logic_error{what};
+}
+
+// Installed during static initialization, before any test runs
+const auto k_previous_handler = gw::set_error_handler(throwing_error_handler);
+
+}  // namespace
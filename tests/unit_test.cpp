@@ -0,0 +1,114 @@
+// Copyright (c) 2023 Martin Stump
+// SPDX-License-Identifier: BSL-1.0
+
+#include "gw/unit.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <compare>
+#include <concepts>
+#include <ratio>
+#include <type_traits>
+
+#include "gw/concepts.hpp"
+#include "gw/strong_type.hpp"
+
+namespace {
+
+using meters_t = gw::quantity<double, gw::meter>;
+using kilometers_t = gw::quantity<double, gw::kilometer>;
+using seconds_t = gw::quantity<double, gw::second>;
+using hours_t = gw::quantity<double, gw::hour>;
+using millimeters_t = gw::quantity<int, gw::millimeter>;
+using int_meters_t = gw::quantity<int, gw::meter>;
+
+template <typename Lhs, typename Rhs>
+concept multipliable = requires(Lhs lhs, Rhs rhs) { lhs * rhs; };
+
+template <typename Lhs, typename Rhs>
+concept addable = requires(Lhs lhs, Rhs rhs) { lhs + rhs; };
+
+}  // namespace
+
+TEST_CASE("units are tags", "[unit]") {
+  STATIC_REQUIRE(gw::unit_tag<gw::meter>);
+  STATIC_REQUIRE(!gw::unit_tag<struct test_tag>);
+  STATIC_REQUIRE(sizeof(meters_t) == sizeof(double));
+  STATIC_REQUIRE(std::is_same_v<gw::kilometer::ratio, std::kilo>);
+}
+
+TEST_CASE("units are derived", "[unit]") {
+  SECTION("multiplication") {
+    constexpr auto area = meters_t{2.0} * meters_t{3.0};
+    STATIC_REQUIRE(std::is_same_v<decltype(area)::tag_type::dimension, gw::dimension<2>>);
+    STATIC_REQUIRE(area.value() == 6.0);
+  }
+
+  SECTION("division") {
+    constexpr auto speed = meters_t{10.0} / seconds_t{2.0};
+    using speed_unit = decltype(speed)::tag_type;
+    STATIC_REQUIRE(std::is_same_v<speed_unit::dimension, gw::dimension<1, 0, -1>>);
+    STATIC_REQUIRE(std::is_same_v<speed_unit::ratio, std::ratio<1>>);
+    STATIC_REQUIRE(speed.value() == 5.0);
+  }
+
+  SECTION("ratios are derived") {
+    constexpr auto speed = kilometers_t{90.0} / hours_t{1.0};
+    using speed_unit = decltype(speed)::tag_type;
+    STATIC_REQUIRE(std::is_same_v<speed_unit::ratio, std::ratio<5, 18>>);
+    using meters_per_second = gw::unit_divide<gw::meter, gw::second>;
+    STATIC_REQUIRE(gw::quantity_cast<meters_per_second>(speed).value() == 25.0);
+  }
+
+  SECTION("dimensionless results") {
+    constexpr auto ratio = meters_t{6.0} / meters_t{3.0};
+    STATIC_REQUIRE(std::is_same_v<decltype(ratio)::tag_type::dimension, gw::dimensionless>);
+    STATIC_REQUIRE(ratio.value() == 2.0);
+  }
+
+  SECTION("inverse units") {
+    constexpr auto frequency = 1.0 / seconds_t{0.5};
+    STATIC_REQUIRE(std::is_same_v<decltype(frequency)::tag_type::dimension, gw::dimension<0, 0, -1>>);
+    STATIC_REQUIRE(frequency.value() == 2.0);
+  }
+
+  SECTION("untagged strong_types keep their tag") {
+    using test_t = gw::strong_type<int, struct test_tag>;
+    STATIC_REQUIRE(std::is_same_v<decltype(test_t{2} * test_t{3}), test_t>);
+    STATIC_REQUIRE(!multipliable<test_t, int_meters_t>);
+  }
+}
+
+TEST_CASE("quantities are scaled", "[unit]") {
+  STATIC_REQUIRE(meters_t{2.0} * 3.0 == meters_t{6.0});
+  STATIC_REQUIRE(3.0 * meters_t{2.0} == meters_t{6.0});
+  STATIC_REQUIRE(meters_t{6.0} / 3.0 == meters_t{2.0});
+}
+
+TEST_CASE("quantities are converted", "[unit]") {
+  STATIC_REQUIRE(gw::quantity_cast<gw::meter>(kilometers_t{1.5}) == meters_t{1500.0});
+  STATIC_REQUIRE(gw::quantity_cast<gw::kilometer>(meters_t{500.0}) == kilometers_t{0.5});
+  STATIC_REQUIRE(gw::quantity_cast<gw::millimeter>(int_meters_t{2}) == millimeters_t{2000});
+  STATIC_REQUIRE(gw::quantity_cast<gw::meter>(millimeters_t{2500}) == int_meters_t{2});
+  STATIC_REQUIRE(gw::quantity_cast<gw::hour>(gw::quantity<int, gw::second>{7200}).value() == 2);
+}
+
+TEST_CASE("quantities of different ratios are combined", "[unit]") {
+  SECTION("addition in the common unit") {
+    constexpr auto length = kilometers_t{1.0} + meters_t{500.0};
+    STATIC_REQUIRE(std::is_same_v<decltype(length), const meters_t>);
+    STATIC_REQUIRE(length == meters_t{1500.0});
+  }
+
+  SECTION("subtraction in the common unit") {
+    constexpr auto length = int_meters_t{1} - millimeters_t{250};
+    STATIC_REQUIRE(length == millimeters_t{750});
+  }
+
+  SECTION("comparison in the common unit") {
+    STATIC_REQUIRE(kilometers_t{1.0} == meters_t{1000.0});
+    STATIC_REQUIRE(kilometers_t{1.0} > meters_t{999.0});
+    STATIC_REQUIRE(int_meters_t{1} < millimeters_t{1001});
+  }
+
+  SECTION("different dimensions are not combined") { STATIC_REQUIRE(!addable<meters_t, seconds_t>); }
+}